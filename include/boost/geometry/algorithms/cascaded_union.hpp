@@ -0,0 +1,389 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_CASCADED_UNION_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_CASCADED_UNION_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/multi_polygon.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+
+#include <boost/geometry/algorithms/detail/space_filling_curve.hpp>
+
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/relate.hpp>
+
+#include <boost/geometry/util/parallel.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace cascaded_union
+{
+
+
+// The union of a group of input geometries and its bounding box
+template <typename MultiPolygon, typename Box>
+struct part
+{
+    MultiPolygon polygons;
+    Box box;
+};
+
+
+template <typename Geometry, typename MultiPolygon>
+inline void append_polygons(Geometry const& geometry, MultiPolygon& multi_polygon)
+{
+    MultiPolygon converted;
+    geometry::convert(geometry, converted);
+    multi_polygon.insert(multi_polygon.end(), converted.begin(), converted.end());
+}
+
+// The geometries whose boxes are disjoint are gathered without calculating
+// the union.
+template
+<
+    typename Geometry1, typename Geometry2,
+    typename Box, typename MultiPolygon, typename Strategy
+>
+inline void union_pair(Geometry1 const& geometry1, Box const& box1,
+                       Geometry2 const& geometry2, Box const& box2,
+                       part<MultiPolygon, Box>& result,
+                       Strategy const& strategy)
+{
+    result.box = box1;
+    geometry::expand(result.box, box2,
+                     typename Strategy::expand_box_strategy_type());
+
+    if (detail::disjoint::disjoint_box_box(box1, box2,
+            typename Strategy::disjoint_box_box_strategy_type()))
+    {
+        append_polygons(geometry1, result.polygons);
+        append_polygons(geometry2, result.polygons);
+    }
+    else
+    {
+        geometry::union_(geometry1, geometry2, result.polygons, strategy);
+    }
+}
+
+
+// Unions the pairs of the input geometries in the order of the Hilbert
+// curve, the last one is converted if the number of geometries is odd.
+template <typename Iterator, typename Box, typename Part, typename Strategy>
+struct first_level
+{
+    first_level(std::vector<Iterator> const& items,
+                std::vector<Box> const& boxes,
+                std::vector<std::size_t> const& order,
+                std::vector<Part>& parts,
+                Strategy const& strategy)
+        : m_items(items), m_boxes(boxes), m_order(order)
+        , m_parts(parts), m_strategy(strategy)
+    {}
+
+    inline bool operator()(std::size_t i) const
+    {
+        std::size_t const i1 = m_order[2 * i];
+        if (2 * i + 1 < m_order.size())
+        {
+            std::size_t const i2 = m_order[2 * i + 1];
+            union_pair(*m_items[i1], m_boxes[i1], *m_items[i2], m_boxes[i2],
+                       m_parts[i], m_strategy);
+        }
+        else
+        {
+            append_polygons(*m_items[i1], m_parts[i].polygons);
+            m_parts[i].box = m_boxes[i1];
+        }
+        return true;
+    }
+
+    std::vector<Iterator> const& m_items;
+    std::vector<Box> const& m_boxes;
+    std::vector<std::size_t> const& m_order;
+    std::vector<Part>& m_parts;
+    Strategy const& m_strategy;
+};
+
+// Unions the pairs of the neighbouring parts of the previous level,
+// the last one is moved if the number of parts is odd.
+template <typename Part, typename Strategy>
+struct next_level
+{
+    next_level(std::vector<Part>& previous,
+               std::vector<Part>& parts,
+               Strategy const& strategy)
+        : m_previous(previous), m_parts(parts), m_strategy(strategy)
+    {}
+
+    inline bool operator()(std::size_t i) const
+    {
+        Part& part1 = m_previous[2 * i];
+        if (2 * i + 1 < m_previous.size())
+        {
+            Part& part2 = m_previous[2 * i + 1];
+            union_pair(part1.polygons, part1.box, part2.polygons, part2.box,
+                       m_parts[i], m_strategy);
+            // release the memory as soon as possible
+            part1.polygons.clear();
+            part2.polygons.clear();
+        }
+        else
+        {
+            m_parts[i].polygons.swap(part1.polygons);
+            m_parts[i].box = part1.box;
+        }
+        return true;
+    }
+
+    std::vector<Part>& m_previous;
+    std::vector<Part>& m_parts;
+    Strategy const& m_strategy;
+};
+
+
+template <typename Range, typename Collection, typename Strategy>
+inline void apply(Range const& geometries,
+                  Collection& output_collection,
+                  Strategy const& strategy)
+{
+    typedef typename boost::range_value<Range>::type geometry_type;
+    typedef typename boost::range_iterator<Range const>::type iterator_type;
+    typedef typename geometry::detail::output_geometry_value
+        <
+            Collection
+        >::type single_out;
+    typedef model::multi_polygon<single_out> multi_polygon_type;
+    typedef model::box<typename point_type<geometry_type>::type> box_type;
+    typedef part<multi_polygon_type, box_type> part_type;
+
+    // The strategy used to union the parts of a level of the reduction if
+    // there is more than one pair. The threads of the parallel strategy are
+    // used to union the pairs at the same time so each of them uses
+    // the strategy without the parallel wrappers, nested at any level,
+    // e.g. plane_sweep<parallel<S> > is replaced with plane_sweep<S>.
+    typedef detail::get_turns::strategy_wrappers<Strategy> strategy_wrappers;
+    typedef typename strategy_wrappers::sequential_type strategy_type;
+
+    std::vector<iterator_type> items;
+    std::vector<box_type> boxes;
+    for (iterator_type it = boost::begin(geometries); it != boost::end(geometries); ++it)
+    {
+        if (! geometry::is_empty(*it))
+        {
+            box_type box;
+            geometry::envelope(*it, box, strategy.get_envelope_strategy());
+            items.push_back(it);
+            boxes.push_back(box);
+        }
+    }
+
+    if (items.empty())
+    {
+        return;
+    }
+
+    // The geometries are sorted along the Hilbert curve like the values of
+    // the packed rtree so the neighbouring geometries are close to each other.
+    box_type bounds = boxes.front();
+    for (std::size_t i = 1; i < boxes.size(); ++i)
+    {
+        geometry::expand(bounds, boxes[i],
+                         typename Strategy::expand_box_strategy_type());
+    }
+
+    std::vector<std::pair<boost::uint64_t, std::size_t> > codes(items.size());
+    for (std::size_t i = 0; i < boxes.size(); ++i)
+    {
+        codes[i] = std::make_pair(detail::space_filling_curve::hilbert_code(boxes[i], bounds), i);
+    }
+    std::sort(codes.begin(), codes.end());
+
+    std::vector<std::size_t> order(codes.size());
+    for (std::size_t i = 0; i < codes.size(); ++i)
+    {
+        order[i] = codes[i].second;
+    }
+
+    std::size_t const threads = strategy_wrappers::threads(strategy);
+    strategy_type const pair_strategy = strategy_wrappers::sequential(strategy);
+
+    std::vector<part_type> parts((order.size() + 1) / 2);
+    if (parts.size() > 1)
+    {
+        geometry::detail::parallel::for_each_index(parts.size(), threads,
+            first_level<iterator_type, box_type, part_type, strategy_type>(
+                items, boxes, order, parts, pair_strategy));
+    }
+    else
+    {
+        // the threads of the parallel strategy are used by the only union
+        first_level<iterator_type, box_type, part_type, Strategy>(
+            items, boxes, order, parts, strategy)(0);
+    }
+
+    while (parts.size() > 1)
+    {
+        std::vector<part_type> next((parts.size() + 1) / 2);
+        if (next.size() > 1)
+        {
+            geometry::detail::parallel::for_each_index(next.size(), threads,
+                next_level<part_type, strategy_type>(
+                    parts, next, pair_strategy));
+        }
+        else
+        {
+            next_level<part_type, Strategy>(parts, next, strategy)(0);
+        }
+        parts.swap(next);
+    }
+
+    multi_polygon_type const& result = parts.front().polygons;
+    for (typename boost::range_iterator<multi_polygon_type const>::type
+            it = boost::begin(result); it != boost::end(result); ++it)
+    {
+        range::push_back(output_collection, *it);
+    }
+}
+
+
+}} // namespace detail::cascaded_union
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace resolve_strategy {
+
+struct cascaded_union
+{
+    template <typename Range, typename Collection, typename Strategy>
+    static inline void apply(Range const& geometries,
+                             Collection& output_collection,
+                             Strategy const& strategy)
+    {
+        detail::cascaded_union::apply(geometries, output_collection, strategy);
+    }
+
+    template <typename Range, typename Collection>
+    static inline void apply(Range const& geometries,
+                             Collection& output_collection,
+                             default_strategy)
+    {
+        typedef typename boost::range_value<Range>::type geometry_type;
+        typedef typename strategy::relate::services::default_strategy
+            <
+                geometry_type,
+                geometry_type
+            >::type strategy_type;
+
+        detail::cascaded_union::apply(geometries, output_collection, strategy_type());
+    }
+};
+
+} // resolve_strategy
+
+
+/*!
+\brief Combines all geometries of a range with each other
+\ingroup union
+\details Calculates the union of all areal geometries of a range, e.g. of
+    a vector of polygons. The geometries are sorted along the Hilbert curve
+    and the union is calculated level by level for the pairs of neighbouring
+    groups of geometries, so the partial results stay small until the last
+    levels. The groups whose bounding boxes are disjoint are gathered without
+    calculating the union. If strategy::intersection::parallel is passed
+    the pairs of a level are combined by several threads and the last union
+    uses the threads to calculate the turns.
+\tparam Range \tparam_range{areal geometries}
+\tparam Collection output collection, either a multi-geometry,
+    or a std::vector<Geometry> / std::deque<Geometry> etc
+\tparam Strategy \tparam_strategy{Union_}
+\param geometries the range of geometries
+\param output_collection the output collection
+\param strategy \param_strategy{union_}
+
+\qbk{distinguish,with strategy}
+*/
+template <typename Range, typename Collection, typename Strategy>
+inline void cascaded_union(Range const& geometries,
+                           Collection& output_collection,
+                           Strategy const& strategy)
+{
+    typedef typename boost::range_value<Range>::type geometry_type;
+
+    concepts::check<geometry_type const>();
+
+    BOOST_MPL_ASSERT_MSG
+        (
+            (boost::is_same
+                <
+                    typename tag_cast<typename tag<geometry_type>::type, areal_tag>::type,
+                    areal_tag
+                >::value),
+            ONLY_AREAL_GEOMETRIES_ARE_SUPPORTED,
+            (types<geometry_type>)
+        );
+
+    resolve_strategy::cascaded_union::apply(geometries, output_collection, strategy);
+}
+
+
+/*!
+\brief Combines all geometries of a range with each other
+\ingroup union
+\details Calculates the union of all areal geometries of a range, e.g. of
+    a vector of polygons. The geometries are sorted along the Hilbert curve
+    and the union is calculated level by level for the pairs of neighbouring
+    groups of geometries, so the partial results stay small until the last
+    levels. The groups whose bounding boxes are disjoint are gathered without
+    calculating the union.
+\tparam Range \tparam_range{areal geometries}
+\tparam Collection output collection, either a multi-geometry,
+    or a std::vector<Geometry> / std::deque<Geometry> etc
+\param geometries the range of geometries
+\param output_collection the output collection
+*/
+template <typename Range, typename Collection>
+inline void cascaded_union(Range const& geometries,
+                           Collection& output_collection)
+{
+    cascaded_union(geometries, output_collection, default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_CASCADED_UNION_HPP
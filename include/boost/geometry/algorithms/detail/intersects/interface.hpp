@@ -80,9 +80,8 @@ inline bool intersects(Geometry1 const& geometry1,
                        Geometry2 const& geometry2,
                        Strategy const& strategy)
 {
-    concepts::check<Geometry1 const>();
-    concepts::check<Geometry2 const>();
-
+    // the geometries are checked by disjoint() which also handles
+    // the prepared geometries
     return ! geometry::disjoint(geometry1, geometry2, strategy);
 }
 
@@ -102,9 +101,7 @@ inline bool intersects(Geometry1 const& geometry1,
 template <typename Geometry1, typename Geometry2>
 inline bool intersects(Geometry1 const& geometry1, Geometry2 const& geometry2)
 {
-    concepts::check<Geometry1 const>();
-    concepts::check<Geometry2 const>();
-
+    // the geometries are checked by disjoint()
     return ! geometry::disjoint(geometry1, geometry2);
 }
 
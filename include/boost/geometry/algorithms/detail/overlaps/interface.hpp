@@ -28,6 +28,7 @@
 
 #include <boost/geometry/algorithms/detail/relate/relate_impl.hpp>
 
+#include <boost/geometry/strategies/default_strategy.hpp>
 #include <boost/geometry/strategies/relate.hpp>
 
 
@@ -60,6 +61,64 @@ struct overlaps
 #endif // DOXYGEN_NO_DISPATCH
 
 
+namespace resolve_strategy
+{
+
+struct overlaps
+{
+    template <typename Geometry1, typename Geometry2, typename Strategy>
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Strategy const& strategy)
+    {
+        return dispatch::overlaps
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, strategy);
+    }
+
+    template <typename Geometry1, typename Geometry2>
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             default_strategy)
+    {
+        typedef typename strategy::relate::services::default_strategy
+            <
+                Geometry1,
+                Geometry2
+            >::type strategy_type;
+
+        return dispatch::overlaps
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, strategy_type());
+    }
+};
+
+} // namespace resolve_strategy
+
+
+namespace resolve_variant
+{
+
+template <typename Geometry1, typename Geometry2>
+struct overlaps
+{
+    template <typename Strategy>
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Strategy const& strategy)
+    {
+        concepts::check<Geometry1 const>();
+        concepts::check<Geometry2 const>();
+
+        return resolve_strategy::overlaps::apply(geometry1, geometry2, strategy);
+    }
+};
+
+} // namespace resolve_variant
+
+
 /*!
 \brief \brief_check2{overlap}
 \ingroup overlaps
@@ -79,13 +138,9 @@ inline bool overlaps(Geometry1 const& geometry1,
                      Geometry2 const& geometry2,
                      Strategy const& strategy)
 {
-    concepts::check<Geometry1 const>();
-    concepts::check<Geometry2 const>();
-
-    return dispatch::overlaps
+    return resolve_variant::overlaps
         <
-            Geometry1,
-            Geometry2
+            Geometry1, Geometry2
         >::apply(geometry1, geometry2, strategy);
 }
 
@@ -108,20 +163,10 @@ inline bool overlaps(Geometry1 const& geometry1,
 template <typename Geometry1, typename Geometry2>
 inline bool overlaps(Geometry1 const& geometry1, Geometry2 const& geometry2)
 {
-    concepts::check<Geometry1 const>();
-    concepts::check<Geometry2 const>();
-
-    typedef typename strategy::relate::services::default_strategy
-            <
-                Geometry1,
-                Geometry2
-            >::type strategy_type;
-
-    return dispatch::overlaps
+    return resolve_variant::overlaps
         <
-            Geometry1,
-            Geometry2
-        >::apply(geometry1, geometry2, strategy_type());
+            Geometry1, Geometry2
+        >::apply(geometry1, geometry2, default_strategy());
 }
 
 }} // namespace boost::geometry
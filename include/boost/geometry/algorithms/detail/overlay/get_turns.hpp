@@ -16,8 +16,11 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_GET_TURNS_HPP
 
 
+#include <algorithm>
 #include <cstddef>
 #include <map>
+#include <utility>
+#include <vector>
 
 #include <boost/array.hpp>
 #include <boost/concept_check.hpp>
@@ -38,6 +41,8 @@
 #include <boost/geometry/geometries/concepts/check.hpp>
 
 #include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/parallel.hpp>
+#include <boost/geometry/util/range.hpp>
 #include <boost/geometry/views/closeable_view.hpp>
 #include <boost/geometry/views/reversible_view.hpp>
 #include <boost/geometry/views/detail/range_type.hpp>
@@ -47,6 +52,8 @@
 
 #include <boost/geometry/iterators/ever_circling_iterator.hpp>
 
+#include <boost/geometry/strategies/intersection_parallel.hpp>
+#include <boost/geometry/strategies/intersection_plane_sweep.hpp>
 #include <boost/geometry/strategies/intersection_strategies.hpp>
 #include <boost/geometry/strategies/intersection_result.hpp>
 
@@ -57,6 +64,7 @@
 #include <boost/geometry/algorithms/detail/partition.hpp>
 #include <boost/geometry/algorithms/detail/recalculate.hpp>
 #include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_sweep.hpp>
 
 #include <boost/geometry/algorithms/detail/overlay/get_turn_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_turn_info_ll.hpp>
@@ -540,6 +548,266 @@ struct section_visitor
 
 };
 
+// The intersection strategy possibly wrapped in the parallel and plane_sweep
+// strategies, nested in any order. The wrappers are unwrapped through base().
+// The sequential strategy is the strategy without the parallel wrappers
+// which may be used by one of the threads.
+template <typename IntersectionStrategy>
+struct strategy_wrappers
+{
+    typedef IntersectionStrategy sequential_type;
+
+    static const bool plane_sweep = false;
+
+    static inline std::size_t threads(IntersectionStrategy const& )
+    {
+        return 1;
+    }
+
+    static inline sequential_type sequential(IntersectionStrategy const& strategy)
+    {
+        return strategy;
+    }
+};
+
+template <typename IntersectionStrategy>
+struct strategy_wrappers<strategy::intersection::parallel<IntersectionStrategy> >
+{
+    typedef strategy_wrappers<IntersectionStrategy> base_type;
+    typedef typename base_type::sequential_type sequential_type;
+
+    static const bool plane_sweep = base_type::plane_sweep;
+
+    static inline std::size_t threads(
+            strategy::intersection::parallel<IntersectionStrategy> const& strategy)
+    {
+        return strategy.threads();
+    }
+
+    static inline sequential_type sequential(
+            strategy::intersection::parallel<IntersectionStrategy> const& strategy)
+    {
+        return base_type::sequential(strategy.base());
+    }
+};
+
+template <typename IntersectionStrategy>
+struct strategy_wrappers<strategy::intersection::plane_sweep<IntersectionStrategy> >
+{
+    typedef strategy_wrappers<IntersectionStrategy> base_type;
+    typedef strategy::intersection::plane_sweep
+        <
+            typename base_type::sequential_type
+        > sequential_type;
+
+    static const bool plane_sweep = true;
+
+    static inline std::size_t threads(
+            strategy::intersection::plane_sweep<IntersectionStrategy> const& strategy)
+    {
+        return base_type::threads(strategy.base());
+    }
+
+    static inline sequential_type sequential(
+            strategy::intersection::plane_sweep<IntersectionStrategy> const& strategy)
+    {
+        return sequential_type(base_type::sequential(strategy.base()));
+    }
+};
+
+// The number of threads used to calculate the turns
+template <typename IntersectionStrategy>
+inline std::size_t parallel_threads(IntersectionStrategy const& strategy)
+{
+    return strategy_wrappers<IntersectionStrategy>::threads(strategy);
+}
+
+// Whether the pairs of sections are found with the plane sweep
+template <typename IntersectionStrategy>
+inline bool use_plane_sweep(IntersectionStrategy const& )
+{
+    return strategy_wrappers<IntersectionStrategy>::plane_sweep;
+}
+
+// Gathers the pairs of overlapping sections in the order of visiting
+template <typename Section, typename DisjointBoxBoxStrategy>
+struct section_pairs_visitor
+{
+    typedef std::pair<Section const*, Section const*> pair_type;
+
+    std::vector<pair_type>& m_pairs;
+    DisjointBoxBoxStrategy const& m_strategy;
+
+    section_pairs_visitor(std::vector<pair_type>& pairs,
+                          DisjointBoxBoxStrategy const& strategy)
+        : m_pairs(pairs)
+        , m_strategy(strategy)
+    {}
+
+    inline bool apply(Section const& sec1, Section const& sec2)
+    {
+        if (! detail::disjoint::disjoint_box_box(sec1.bounding_box,
+                                                 sec2.bounding_box,
+                                                 m_strategy))
+        {
+            m_pairs.push_back(pair_type(&sec1, &sec2));
+        }
+        return true;
+    }
+};
+
+// The pairs of overlapping sections are gathered first, by the partition or
+// by the plane sweep, and then divided into contiguous tasks. The threads take the tasks one by one and calculate
+// the turns of each task into a separate buffer. The buffers are appended to
+// the turns in the order of the tasks, so the turns are in the same order
+// as calculated by the sequential algorithm. If the interrupt policy is
+// enabled it's applied to the turns of each task and the turns of
+// the following tasks are discarded if the process is interrupted.
+// The tasks themselves aren't interrupted, all of them are performed. Unlike
+// in self_turns() the interrupt policy can't be copied into the tasks because
+// the interrupt policies of relate update the result shared by all of them.
+template
+<
+    typename Geometry1, typename Geometry2,
+    bool Reverse1, bool Reverse2,
+    typename TurnPolicy,
+    typename Sections,
+    typename IntersectionStrategy,
+    typename RobustPolicy,
+    typename Turns
+>
+class parallel_turns_in_sections
+{
+    typedef typename boost::range_value<Sections>::type section_type;
+    typedef std::pair<section_type const*, section_type const*> pair_type;
+    typedef std::vector<typename boost::range_value<Turns>::type> buffer_type;
+
+public:
+    static const std::size_t tasks_per_thread = 8;
+
+    template <typename InterruptPolicy>
+    static inline void apply(
+            int source_id1, Geometry1 const& geometry1, Sections const& sec1,
+            int source_id2, Geometry2 const& geometry2, Sections const& sec2,
+            IntersectionStrategy const& intersection_strategy,
+            RobustPolicy const& robust_policy,
+            std::size_t threads,
+            Turns& turns,
+            InterruptPolicy& interrupt_policy)
+    {
+        typedef typename IntersectionStrategy::disjoint_box_box_strategy_type
+            disjoint_box_box_strategy_type;
+        typedef detail::section::get_section_box
+            <
+                typename IntersectionStrategy::expand_box_strategy_type
+            > get_section_box_type;
+        typedef detail::section::overlaps_section_box
+            <
+                disjoint_box_box_strategy_type
+            > overlaps_section_box_type;
+        typedef typename Sections::box_type box_type;
+
+        std::vector<pair_type> pairs;
+        disjoint_box_box_strategy_type const disjoint_strategy
+            = intersection_strategy.get_disjoint_box_box_strategy();
+        section_pairs_visitor
+            <
+                section_type, disjoint_box_box_strategy_type
+            > visitor(pairs, disjoint_strategy);
+
+        if (use_plane_sweep(intersection_strategy))
+        {
+            detail::section::sweep_sections(sec1, sec2, visitor);
+        }
+        else
+        {
+            geometry::partition
+                <
+                    box_type
+                >::apply(sec1, sec2, visitor,
+                         get_section_box_type(),
+                         overlaps_section_box_type());
+        }
+
+        std::size_t const tasks_count
+            = (std::min)(pairs.size(), threads * tasks_per_thread);
+        std::vector<buffer_type> buffers(tasks_count);
+        geometry::detail::parallel::for_each_index(tasks_count, threads,
+            turns_of_task(source_id1, geometry1, source_id2, geometry2,
+                          intersection_strategy, robust_policy,
+                          pairs, buffers));
+
+        for (std::size_t i = 0; i < buffers.size(); ++i)
+        {
+            std::size_t const size_before = boost::size(turns);
+
+            std::copy(buffers[i].begin(), buffers[i].end(),
+                      std::back_inserter(turns));
+
+            if (InterruptPolicy::enabled)
+            {
+                if (interrupt_policy.apply(
+                        std::make_pair(range::pos(turns, size_before),
+                                       boost::end(turns))))
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+private:
+    // Calculates the turns of the pairs of the task into its buffer.
+    struct turns_of_task
+    {
+        turns_of_task(int id1, Geometry1 const& g1,
+                      int id2, Geometry2 const& g2,
+                      IntersectionStrategy const& intersection_strategy,
+                      RobustPolicy const& robust_policy,
+                      std::vector<pair_type> const& p,
+                      std::vector<buffer_type>& b)
+            : source_id1(id1), geometry1(g1)
+            , source_id2(id2), geometry2(g2)
+            , strategy(intersection_strategy)
+            , rescale_policy(robust_policy)
+            , pairs(p), buffers(b)
+        {}
+
+        bool operator()(std::size_t i) const
+        {
+            std::size_t const count = buffers.size();
+            std::size_t const first = pairs.size() * i / count;
+            std::size_t const last = pairs.size() * (i + 1) / count;
+            no_interrupt_policy interrupt_policy;
+            for (std::size_t j = first; j < last; ++j)
+            {
+                get_turns_in_sections
+                    <
+                        Geometry1,
+                        Geometry2,
+                        Reverse1, Reverse2,
+                        section_type, section_type,
+                        TurnPolicy
+                    >::apply(source_id1, geometry1, *pairs[j].first,
+                             source_id2, geometry2, *pairs[j].second,
+                             false, false,
+                             strategy, rescale_policy,
+                             buffers[i], interrupt_policy);
+            }
+            return true;
+        }
+
+        int source_id1;
+        Geometry1 const& geometry1;
+        int source_id2;
+        Geometry2 const& geometry2;
+        IntersectionStrategy const& strategy;
+        RobustPolicy const& rescale_policy;
+        std::vector<pair_type> const& pairs;
+        std::vector<buffer_type>& buffers;
+    };
+};
+
 template
 <
     typename Geometry1, typename Geometry2,
@@ -585,6 +853,24 @@ public:
         geometry::sectionalize<Reverse2, dimensions>(geometry2, robust_policy,
                 sec2, envelope_strategy, expand_strategy, 1);
 
+        std::size_t const threads = parallel_threads(intersection_strategy);
+        if (threads > 1)
+        {
+            parallel_turns_in_sections
+                <
+                    Geometry1, Geometry2,
+                    Reverse1, Reverse2,
+                    TurnPolicy,
+                    sections_type,
+                    IntersectionStrategy, RobustPolicy,
+                    Turns
+                >::apply(source_id1, geometry1, sec1,
+                         source_id2, geometry2, sec2,
+                         intersection_strategy, robust_policy,
+                         threads, turns, interrupt_policy);
+            return;
+        }
+
         // ... and then partition them, intersecting overlapping sections in visitor method
         section_visitor
             <
@@ -597,6 +883,12 @@ public:
                       intersection_strategy, robust_policy,
                       turns, interrupt_policy);
 
+        if (use_plane_sweep(intersection_strategy))
+        {
+            detail::section::sweep_sections(sec1, sec2, visitor);
+            return;
+        }
+
         typedef detail::section::get_section_box
             <
                 typename IntersectionStrategy::expand_box_strategy_type
@@ -16,7 +16,11 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_SELF_TURN_POINTS_HPP
 
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
 
 #include <boost/mpl/vector_c.hpp>
 #include <boost/range.hpp>
@@ -33,10 +37,13 @@
 #include <boost/geometry/algorithms/detail/overlay/do_reverse.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
 #include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_sweep.hpp>
 
 #include <boost/geometry/geometries/box.hpp>
 
 #include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/parallel.hpp>
+#include <boost/geometry/util/range.hpp>
 
 
 namespace boost { namespace geometry
@@ -126,6 +133,174 @@ struct self_section_visitor
 };
 
 
+// The state shared by the clones of the parallel visitor. The first clone
+// interrupted by its copy of the interrupt policy stores the turns which
+// interrupted it and sets the flag so the other clones stop visiting.
+template <typename Turn>
+class self_section_parallel_interrupt
+{
+    self_section_parallel_interrupt(self_section_parallel_interrupt const&);
+    self_section_parallel_interrupt & operator=(self_section_parallel_interrupt const&);
+
+public:
+    self_section_parallel_interrupt() {}
+
+    inline bool is_interrupted() const
+    {
+        return m_interrupted.is_set();
+    }
+
+    template <typename Iterator>
+    inline void interrupt(Iterator first, Iterator last)
+    {
+        detail::parallel::scoped_lock lock(m_mutex);
+        if (! m_interrupted.is_set())
+        {
+            m_turns.assign(first, last);
+            m_interrupted.set();
+        }
+    }
+
+    // The turns are read after the clones are done
+    inline std::vector<Turn> const& turns() const
+    {
+        return m_turns;
+    }
+
+private:
+    detail::parallel::flag m_interrupted;
+    detail::parallel::mutex m_mutex;
+    std::vector<Turn> m_turns;
+};
+
+
+// The visitor of the parallel partition. Each clone calculates the turns
+// of a part of the pairs of sections into its own buffer. The buffers are
+// appended to the turns in the order of visiting and the interrupt policy
+// is applied to each of them.
+// Each pair of sections is checked with a copy of the interrupt policy so
+// the interrupt policy has to decide on the turns it is applied to, like
+// the policies used with self_turns() do. When a clone is interrupted the
+// other clones stop too. Then the clone merged last, i.e. the first one
+// which was stopped, is followed by the turns which interrupted the process.
+template
+<
+    bool Reverse,
+    typename Geometry,
+    typename Turns,
+    typename TurnPolicy,
+    typename IntersectionStrategy,
+    typename RobustPolicy,
+    typename InterruptPolicy
+>
+class self_section_parallel_visitor
+{
+    typedef typename boost::range_value<Turns>::type turn_type;
+    typedef std::vector<turn_type> buffer_type;
+
+public:
+    typedef self_section_parallel_interrupt<turn_type> interrupt_type;
+
+    inline self_section_parallel_visitor(Geometry const& g,
+                                         IntersectionStrategy const& is,
+                                         RobustPolicy const& rp,
+                                         Turns& turns,
+                                         InterruptPolicy& ip,
+                                         interrupt_type& interrupt,
+                                         int source_index,
+                                         bool skip_adjacent)
+        : m_geometry(&g)
+        , m_intersection_strategy(&is)
+        , m_rescale_policy(&rp)
+        , m_turns(&turns)
+        , m_interrupt_policy(&ip)
+        , m_interrupt(&interrupt)
+        , m_source_index(source_index)
+        , m_skip_adjacent(skip_adjacent)
+        , m_stopped(false)
+    {}
+
+    template <typename Section>
+    inline bool apply(Section const& sec1, Section const& sec2)
+    {
+        if (InterruptPolicy::enabled && m_interrupt->is_interrupted())
+        {
+            m_stopped = true;
+            return false;
+        }
+
+        // The policy isn't changed until the clones are merged
+        InterruptPolicy interrupt_policy(*m_interrupt_policy);
+        std::size_t const size_before = m_buffer.size();
+
+        self_section_visitor
+            <
+                Reverse, Geometry,
+                buffer_type, TurnPolicy, IntersectionStrategy, RobustPolicy,
+                InterruptPolicy
+            > visitor(*m_geometry, *m_intersection_strategy, *m_rescale_policy,
+                      m_buffer, interrupt_policy, m_source_index, m_skip_adjacent);
+        if (visitor.apply(sec1, sec2))
+        {
+            return true;
+        }
+
+        m_interrupt->interrupt(m_buffer.begin() + size_before, m_buffer.end());
+        return false;
+    }
+
+    inline self_section_parallel_visitor clone() const
+    {
+        self_section_parallel_visitor result(*this);
+        result.m_buffer.clear();
+        return result;
+    }
+
+    inline void merge(self_section_parallel_visitor& other)
+    {
+        if (InterruptPolicy::enabled && m_interrupt_policy->has_intersections)
+        {
+            return;
+        }
+
+        append(other.m_buffer);
+
+        if (other.m_stopped)
+        {
+            // The turns of the interrupted clone which may not be merged
+            append(m_interrupt->turns());
+        }
+    }
+
+private:
+    template <typename Buffer>
+    inline void append(Buffer const& buffer)
+    {
+        std::size_t const size_before = boost::size(*m_turns);
+
+        std::copy(buffer.begin(), buffer.end(),
+                  std::back_inserter(*m_turns));
+
+        if (InterruptPolicy::enabled)
+        {
+            m_interrupt_policy->apply(
+                std::make_pair(range::pos(*m_turns, size_before),
+                               boost::end(*m_turns)));
+        }
+    }
+
+    Geometry const* m_geometry;
+    IntersectionStrategy const* m_intersection_strategy;
+    RobustPolicy const* m_rescale_policy;
+    Turns* m_turns;
+    InterruptPolicy* m_interrupt_policy;
+    interrupt_type* m_interrupt;
+    int m_source_index;
+    bool m_skip_adjacent;
+    bool m_stopped;
+    buffer_type m_buffer;
+};
+
 
 template <bool Reverse, typename TurnPolicy>
 struct get_turns
@@ -159,12 +334,6 @@ struct get_turns
                                                     intersection_strategy.get_envelope_strategy(),
                                                     intersection_strategy.get_expand_strategy());
 
-        self_section_visitor
-            <
-                Reverse, Geometry,
-                Turns, TurnPolicy, IntersectionStrategy, RobustPolicy, InterruptPolicy
-            > visitor(geometry, intersection_strategy, robust_policy, turns, interrupt_policy, source_index, skip_adjacent);
-
         typedef detail::section::get_section_box
             <
                 typename IntersectionStrategy::expand_box_strategy_type
@@ -174,6 +343,51 @@ struct get_turns
                 typename IntersectionStrategy::disjoint_box_box_strategy_type
             > overlaps_section_box_type;
 
+        std::size_t const threads
+            = detail::get_turns::parallel_threads(intersection_strategy);
+        if (threads > 1)
+        {
+            typedef self_section_parallel_visitor
+                <
+                    Reverse, Geometry,
+                    Turns, TurnPolicy, IntersectionStrategy, RobustPolicy, InterruptPolicy
+                > visitor_type;
+
+            typename visitor_type::interrupt_type interrupt;
+            visitor_type visitor(geometry, intersection_strategy, robust_policy,
+                                 turns, interrupt_policy, interrupt,
+                                 source_index, skip_adjacent);
+
+            if (detail::get_turns::use_plane_sweep(intersection_strategy))
+            {
+                detail::section::sweep_sections_parallel(sec, visitor, threads);
+            }
+            else
+            {
+                geometry::partition
+                    <
+                        box_type
+                    >::apply_parallel(sec, visitor,
+                                      get_section_box_type(),
+                                      overlaps_section_box_type(),
+                                      threads);
+            }
+
+            return ! interrupt_policy.has_intersections;
+        }
+
+        self_section_visitor
+            <
+                Reverse, Geometry,
+                Turns, TurnPolicy, IntersectionStrategy, RobustPolicy, InterruptPolicy
+            > visitor(geometry, intersection_strategy, robust_policy, turns, interrupt_policy, source_index, skip_adjacent);
+
+        if (detail::get_turns::use_plane_sweep(intersection_strategy))
+        {
+            detail::section::sweep_sections(sec, visitor);
+            return ! interrupt_policy.has_intersections;
+        }
+
         // false if interrupted
         geometry::partition
             <
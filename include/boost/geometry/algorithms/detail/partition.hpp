@@ -18,12 +18,15 @@
 
 #include <cstddef>
 #include <vector>
+#include <boost/optional.hpp>
 #include <boost/range.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <boost/type_traits/is_integral.hpp>
 
 #include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/util/parallel.hpp>
 
 
 namespace boost { namespace geometry
@@ -254,7 +257,8 @@ class partition_one_range
         typename VisitPolicy,
         typename ExpandPolicy,
         typename OverlapsPolicy,
-        typename VisitBoxPolicy
+        typename VisitBoxPolicy,
+        typename Tasks
     >
     static inline bool next_level(Box const& box,
                                   IteratorVector const& input,
@@ -262,7 +266,8 @@ class partition_one_range
                                   VisitPolicy& visitor,
                                   ExpandPolicy const& expand_policy,
                                   OverlapsPolicy const& overlaps_policy,
-                                  VisitBoxPolicy& box_policy)
+                                  VisitBoxPolicy& box_policy,
+                                  Tasks& tasks)
     {
         if (recurse_ok(input, min_elements, level))
         {
@@ -271,11 +276,12 @@ class partition_one_range
                     1 - Dimension,
                     Box
                 >::apply(box, input, level + 1, min_elements,
-                         visitor, expand_policy, overlaps_policy, box_policy);
+                         visitor, expand_policy, overlaps_policy, box_policy,
+                         tasks);
         }
         else
         {
-            return handle_one(input, visitor);
+            return tasks.handle_one(input, visitor);
         }
     }
 
@@ -287,7 +293,8 @@ class partition_one_range
         typename VisitPolicy,
         typename ExpandPolicy,
         typename OverlapsPolicy,
-        typename VisitBoxPolicy
+        typename VisitBoxPolicy,
+        typename Tasks
     >
     static inline bool next_level2(Box const& box,
                                    IteratorVector const& input1,
@@ -296,7 +303,8 @@ class partition_one_range
                                    VisitPolicy& visitor,
                                    ExpandPolicy const& expand_policy,
                                    OverlapsPolicy const& overlaps_policy,
-                                   VisitBoxPolicy& box_policy)
+                                   VisitBoxPolicy& box_policy,
+                                   Tasks& tasks)
     {
         if (recurse_ok(input1, input2, min_elements, level))
         {
@@ -305,11 +313,11 @@ class partition_one_range
                     1 - Dimension, Box
                 >::apply(box, input1, input2, level + 1, min_elements,
                          visitor, expand_policy, overlaps_policy,
-                         expand_policy, overlaps_policy, box_policy);
+                         expand_policy, overlaps_policy, box_policy, tasks);
         }
         else
         {
-            return handle_two(input1, input2, visitor);
+            return tasks.handle_two(input1, input2, visitor);
         }
     }
 
@@ -320,7 +328,8 @@ public :
         typename VisitPolicy,
         typename ExpandPolicy,
         typename OverlapsPolicy,
-        typename VisitBoxPolicy
+        typename VisitBoxPolicy,
+        typename Tasks
     >
     static inline bool apply(Box const& box,
                              IteratorVector const& input,
@@ -329,8 +338,14 @@ public :
                              VisitPolicy& visitor,
                              ExpandPolicy const& expand_policy,
                              OverlapsPolicy const& overlaps_policy,
-                             VisitBoxPolicy& box_policy)
+                             VisitBoxPolicy& box_policy,
+                             Tasks& tasks)
     {
+        if (tasks.template defer_one<Dimension>(box, input, level))
+        {
+            return true;
+        }
+
         box_policy.apply(box, level);
 
         Box lower_box, upper_box;
@@ -349,13 +364,16 @@ public :
                    // Recursively do exceeding elements only, in next dimension they
                    // will probably be less exceeding within the new box
             if (! (next_level(exceeding_box, exceeding, level, min_elements,
-                              visitor, expand_policy, overlaps_policy, box_policy)
+                              visitor, expand_policy, overlaps_policy, box_policy,
+                              tasks)
                    // Switch to two forward ranges, combine exceeding with
                    // lower resp upper, but not lower/lower, upper/upper
                 && next_level2(exceeding_box, exceeding, lower, level, min_elements,
-                               visitor, expand_policy, overlaps_policy, box_policy)
+                               visitor, expand_policy, overlaps_policy, box_policy,
+                               tasks)
                 && next_level2(exceeding_box, exceeding, upper, level, min_elements,
-                               visitor, expand_policy, overlaps_policy, box_policy)) )
+                               visitor, expand_policy, overlaps_policy, box_policy,
+                               tasks)) )
             {
                 return false; // interrupt
             }
@@ -363,9 +381,11 @@ public :
 
         // Recursively call operation both parts
         return next_level(lower_box, lower, level, min_elements,
-                          visitor, expand_policy, overlaps_policy, box_policy)
+                          visitor, expand_policy, overlaps_policy, box_policy,
+                          tasks)
             && next_level(upper_box, upper, level, min_elements,
-                          visitor, expand_policy, overlaps_policy, box_policy);
+                          visitor, expand_policy, overlaps_policy, box_policy,
+                          tasks);
     }
 };
 
@@ -385,7 +405,8 @@ class partition_two_ranges
         typename OverlapsPolicy1,
         typename ExpandPolicy2,
         typename OverlapsPolicy2,
-        typename VisitBoxPolicy
+        typename VisitBoxPolicy,
+        typename Tasks
     >
     static inline bool next_level(Box const& box,
                                   IteratorVector1 const& input1,
@@ -396,14 +417,15 @@ class partition_two_ranges
                                   OverlapsPolicy1 const& overlaps_policy1,
                                   ExpandPolicy2 const& expand_policy2,
                                   OverlapsPolicy2 const& overlaps_policy2,
-                                  VisitBoxPolicy& box_policy)
+                                  VisitBoxPolicy& box_policy,
+                                  Tasks& tasks)
     {
         return partition_two_ranges
             <
                 1 - Dimension, Box
             >::apply(box, input1, input2, level + 1, min_elements,
                      visitor, expand_policy1, overlaps_policy1,
-                     expand_policy2, overlaps_policy2, box_policy);
+                     expand_policy2, overlaps_policy2, box_policy, tasks);
     }
 
     template <typename IteratorVector, typename ExpandPolicy>
@@ -441,7 +463,8 @@ public :
         typename OverlapsPolicy1,
         typename ExpandPolicy2,
         typename OverlapsPolicy2,
-        typename VisitBoxPolicy
+        typename VisitBoxPolicy,
+        typename Tasks
     >
     static inline bool apply(Box const& box,
                              IteratorVector1 const& input1,
@@ -453,8 +476,14 @@ public :
                              OverlapsPolicy1 const& overlaps_policy1,
                              ExpandPolicy2 const& expand_policy2,
                              OverlapsPolicy2 const& overlaps_policy2,
-                             VisitBoxPolicy& box_policy)
+                             VisitBoxPolicy& box_policy,
+                             Tasks& tasks)
     {
+        if (tasks.template defer_two<Dimension>(box, input1, input2, level))
+        {
+            return true;
+        }
+
         box_policy.apply(box, level);
 
         Box lower_box, upper_box;
@@ -479,14 +508,14 @@ public :
                                                 expand_policy1, expand_policy2);
                 if (! next_level(exceeding_box, exceeding1, exceeding2, level,
                                  min_elements, visitor, expand_policy1, overlaps_policy1,
-                                 expand_policy2, overlaps_policy2, box_policy))
+                                 expand_policy2, overlaps_policy2, box_policy, tasks))
                 {
                     return false; // interrupt
                 }
             }
             else
             {
-                if (! handle_two(exceeding1, exceeding2, visitor))
+                if (! tasks.handle_two(exceeding1, exceeding2, visitor))
                 {
                     return false; // interrupt
                 }
@@ -501,18 +530,18 @@ public :
                 Box exceeding_box = get_new_box(exceeding1, expand_policy1);
                 if (! (next_level(exceeding_box, exceeding1, lower2, level,
                                   min_elements, visitor, expand_policy1, overlaps_policy1,
-                                  expand_policy2, overlaps_policy2, box_policy)
+                                  expand_policy2, overlaps_policy2, box_policy, tasks)
                     && next_level(exceeding_box, exceeding1, upper2, level,
                                   min_elements, visitor, expand_policy1, overlaps_policy1,
-                                  expand_policy2, overlaps_policy2, box_policy)) )
+                                  expand_policy2, overlaps_policy2, box_policy, tasks)) )
                 {
                     return false; // interrupt
                 }
             }
             else
             {
-                if (! (handle_two(exceeding1, lower2, visitor)
-                    && handle_two(exceeding1, upper2, visitor)) )
+                if (! (tasks.handle_two(exceeding1, lower2, visitor)
+                    && tasks.handle_two(exceeding1, upper2, visitor)) )
                 {
                     return false; // interrupt
                 }
@@ -527,18 +556,18 @@ public :
                 Box exceeding_box = get_new_box(exceeding2, expand_policy2);
                 if (! (next_level(exceeding_box, lower1, exceeding2, level,
                                   min_elements, visitor, expand_policy1, overlaps_policy1,
-                                  expand_policy2, overlaps_policy2, box_policy)
+                                  expand_policy2, overlaps_policy2, box_policy, tasks)
                     && next_level(exceeding_box, upper1, exceeding2, level,
                                   min_elements, visitor, expand_policy1, overlaps_policy1,
-                                  expand_policy2, overlaps_policy2, box_policy)) )
+                                  expand_policy2, overlaps_policy2, box_policy, tasks)) )
                 {
                     return false; // interrupt
                 }
             }
             else
             {
-                if (! (handle_two(lower1, exceeding2, visitor)
-                    && handle_two(upper1, exceeding2, visitor)) )
+                if (! (tasks.handle_two(lower1, exceeding2, visitor)
+                    && tasks.handle_two(upper1, exceeding2, visitor)) )
                 {
                     return false; // interrupt
                 }
@@ -549,14 +578,14 @@ public :
         {
             if (! next_level(lower_box, lower1, lower2, level,
                              min_elements, visitor, expand_policy1, overlaps_policy1,
-                             expand_policy2, overlaps_policy2, box_policy) )
+                             expand_policy2, overlaps_policy2, box_policy, tasks) )
             {
                 return false; // interrupt
             }
         }
         else
         {
-            if (! handle_two(lower1, lower2, visitor))
+            if (! tasks.handle_two(lower1, lower2, visitor))
             {
                 return false; // interrupt
             }
@@ -566,14 +595,14 @@ public :
         {
             if (! next_level(upper_box, upper1, upper2, level,
                              min_elements, visitor, expand_policy1, overlaps_policy1,
-                             expand_policy2, overlaps_policy2, box_policy) )
+                             expand_policy2, overlaps_policy2, box_policy, tasks) )
             {
                 return false; // interrupt
             }
         }
         else
         {
-            if (! handle_two(upper1, upper2, visitor))
+            if (! tasks.handle_two(upper1, upper2, visitor))
             {
                 return false; // interrupt
             }
@@ -599,6 +628,304 @@ struct include_all_policy
     }
 };
 
+// The pairs are visited by the sequential partition immediately
+struct no_tasks
+{
+    template <int Dimension, typename Box, typename IteratorVector>
+    static inline bool defer_one(Box const&, IteratorVector const&, std::size_t)
+    {
+        return false;
+    }
+
+    template <int Dimension, typename Box, typename IteratorVector1, typename IteratorVector2>
+    static inline bool defer_two(Box const&, IteratorVector1 const&,
+                                 IteratorVector2 const&, std::size_t)
+    {
+        return false;
+    }
+
+    template <typename IteratorVector, typename VisitPolicy>
+    static inline bool handle_one(IteratorVector const& input, VisitPolicy& visitor)
+    {
+        return detail::partition::handle_one(input, visitor);
+    }
+
+    template <typename IteratorVector1, typename IteratorVector2, typename VisitPolicy>
+    static inline bool handle_two(IteratorVector1 const& input1,
+                                  IteratorVector2 const& input2,
+                                  VisitPolicy& visitor)
+    {
+        return detail::partition::handle_two(input1, input2, visitor);
+    }
+};
+
+// The part of the partition performed later, possibly by another thread
+template <typename Box, typename IteratorVector1, typename IteratorVector2>
+struct partition_task
+{
+    enum kind_type { one_range, two_ranges, handle_one_range, handle_two_ranges };
+
+    partition_task()
+        : kind(handle_one_range), dimension(0), level(0)
+    {}
+
+    kind_type kind;
+    int dimension;
+    std::size_t level;
+    Box box;
+    IteratorVector1 input1;
+    IteratorVector2 input2;
+};
+
+// The tasks are gathered instead of the recursion at the level of tasks
+// and instead of visiting the pairs at the lower levels, so the tasks
+// performed one by one visit the pairs in the same order as the sequential
+// partition.
+template <typename Task>
+class gather_tasks
+{
+public:
+    gather_tasks(std::vector<Task>& tasks, std::size_t level)
+        : m_tasks(tasks)
+        , m_level(level)
+    {}
+
+    template <int Dimension, typename Box, typename IteratorVector>
+    inline bool defer_one(Box const& box, IteratorVector const& input,
+                          std::size_t level)
+    {
+        if (level < m_level)
+        {
+            return false;
+        }
+
+        Task& task = push(Task::one_range, Dimension, level);
+        task.box = box;
+        task.input1 = input;
+        return true;
+    }
+
+    template <int Dimension, typename Box, typename IteratorVector1, typename IteratorVector2>
+    inline bool defer_two(Box const& box, IteratorVector1 const& input1,
+                          IteratorVector2 const& input2, std::size_t level)
+    {
+        if (level < m_level)
+        {
+            return false;
+        }
+
+        Task& task = push(Task::two_ranges, Dimension, level);
+        task.box = box;
+        task.input1 = input1;
+        task.input2 = input2;
+        return true;
+    }
+
+    template <typename IteratorVector, typename VisitPolicy>
+    inline bool handle_one(IteratorVector const& input, VisitPolicy& )
+    {
+        if (! boost::empty(input))
+        {
+            push(Task::handle_one_range, 0, 0).input1 = input;
+        }
+        return true;
+    }
+
+    template <typename IteratorVector1, typename IteratorVector2, typename VisitPolicy>
+    inline bool handle_two(IteratorVector1 const& input1,
+                           IteratorVector2 const& input2,
+                           VisitPolicy& )
+    {
+        if (! boost::empty(input1) && ! boost::empty(input2))
+        {
+            Task& task = push(Task::handle_two_ranges, 0, 0);
+            task.input1 = input1;
+            task.input2 = input2;
+        }
+        return true;
+    }
+
+private:
+    inline Task& push(typename Task::kind_type kind, int dimension, std::size_t level)
+    {
+        m_tasks.push_back(Task());
+        Task& task = m_tasks.back();
+        task.kind = kind;
+        task.dimension = dimension;
+        task.level = level;
+        return task;
+    }
+
+    std::vector<Task>& m_tasks;
+    std::size_t m_level;
+};
+
+// The level of the tasks chosen so there are several tasks for each thread
+inline std::size_t tasks_level(std::size_t threads)
+{
+    static const std::size_t tasks_per_thread = 8;
+
+    std::size_t level = 1;
+    while ((std::size_t(1) << level) < threads * tasks_per_thread && level < 16)
+    {
+        ++level;
+    }
+    return level;
+}
+
+// The threads take the tasks one by one. Each task visits the pairs with
+// its own clone of the visitor. Then the clones are merged into the visitor
+// in the order of the tasks. If a task is interrupted, the following tasks
+// are not performed and the following clones are not merged.
+template <typename Box, bool OneRange>
+class parallel_tasks
+{
+public:
+    template
+    <
+        typename Task,
+        typename VisitPolicy,
+        typename ExpandPolicy1,
+        typename OverlapsPolicy1,
+        typename ExpandPolicy2,
+        typename OverlapsPolicy2
+    >
+    static inline bool apply(std::vector<Task> const& tasks,
+                             std::size_t threads,
+                             std::size_t min_elements,
+                             VisitPolicy& visitor,
+                             ExpandPolicy1 const& expand_policy1,
+                             OverlapsPolicy1 const& overlaps_policy1,
+                             ExpandPolicy2 const& expand_policy2,
+                             OverlapsPolicy2 const& overlaps_policy2)
+    {
+        typedef worker
+            <
+                Task, VisitPolicy,
+                ExpandPolicy1, OverlapsPolicy1,
+                ExpandPolicy2, OverlapsPolicy2
+            > worker_type;
+
+        std::vector<boost::optional<VisitPolicy> > visitors(tasks.size());
+        std::size_t const interrupted
+            = geometry::detail::parallel::for_each_index(tasks.size(), threads,
+                worker_type(tasks, visitors, min_elements, visitor,
+                            expand_policy1, overlaps_policy1,
+                            expand_policy2, overlaps_policy2));
+
+        for (std::size_t i = 0; i < visitors.size() && i <= interrupted; ++i)
+        {
+            visitor.merge(*visitors[i]);
+        }
+
+        return interrupted >= tasks.size();
+    }
+
+private:
+    // Visits the pairs of the task with a new clone of the visitor.
+    template
+    <
+        typename Task,
+        typename VisitPolicy,
+        typename ExpandPolicy1,
+        typename OverlapsPolicy1,
+        typename ExpandPolicy2,
+        typename OverlapsPolicy2
+    >
+    struct worker
+    {
+        worker(std::vector<Task> const& t,
+               std::vector<boost::optional<VisitPolicy> >& v,
+               std::size_t min_elem,
+               VisitPolicy const& visitor,
+               ExpandPolicy1 const& e1, OverlapsPolicy1 const& o1,
+               ExpandPolicy2 const& e2, OverlapsPolicy2 const& o2)
+            : tasks(t), visitors(v), min_elements(min_elem)
+            , prototype(visitor)
+            , expand_policy1(e1), overlaps_policy1(o1)
+            , expand_policy2(e2), overlaps_policy2(o2)
+        {}
+
+        bool operator()(std::size_t i) const
+        {
+            visitors[i] = prototype.clone();
+            return execute(tasks[i], *visitors[i],
+                           boost::integral_constant<bool, OneRange>());
+        }
+
+        template <int Dimension>
+        inline bool execute_one(Task const& task, VisitPolicy& visitor) const
+        {
+            visit_no_policy box_policy;
+            no_tasks subtasks;
+            return partition_one_range
+                <
+                    Dimension, Box
+                >::apply(task.box, task.input1, task.level, min_elements,
+                         visitor, expand_policy1, overlaps_policy1,
+                         box_policy, subtasks);
+        }
+
+        template <int Dimension>
+        inline bool execute_two(Task const& task, VisitPolicy& visitor) const
+        {
+            visit_no_policy box_policy;
+            no_tasks subtasks;
+            return partition_two_ranges
+                <
+                    Dimension, Box
+                >::apply(task.box, task.input1, task.input2, task.level,
+                         min_elements, visitor,
+                         expand_policy1, overlaps_policy1,
+                         expand_policy2, overlaps_policy2,
+                         box_policy, subtasks);
+        }
+
+        // The tasks of the partition of one range
+        inline bool execute(Task const& task, VisitPolicy& visitor,
+                            boost::true_type /*one_range*/) const
+        {
+            switch (task.kind)
+            {
+            case Task::one_range:
+                return task.dimension == 0
+                     ? execute_one<0>(task, visitor)
+                     : execute_one<1>(task, visitor);
+            case Task::handle_one_range:
+                return handle_one(task.input1, visitor);
+            default:
+                return execute(task, visitor, boost::false_type());
+            }
+        }
+
+        // The tasks of the partition of two ranges
+        inline bool execute(Task const& task, VisitPolicy& visitor,
+                            boost::false_type /*one_range*/) const
+        {
+            switch (task.kind)
+            {
+            case Task::two_ranges:
+                return task.dimension == 0
+                     ? execute_two<0>(task, visitor)
+                     : execute_two<1>(task, visitor);
+            case Task::handle_two_ranges:
+                return handle_two(task.input1, task.input2, visitor);
+            default:
+                return true;
+            }
+        }
+
+        std::vector<Task> const& tasks;
+        std::vector<boost::optional<VisitPolicy> >& visitors;
+        std::size_t min_elements;
+        VisitPolicy const& prototype;
+        ExpandPolicy1 const& expand_policy1;
+        OverlapsPolicy1 const& overlaps_policy1;
+        ExpandPolicy2 const& expand_policy2;
+        OverlapsPolicy2 const& overlaps_policy2;
+    };
+};
+
 
 }} // namespace detail::partition
 
@@ -699,11 +1026,13 @@ public:
             expand_to_range<IncludePolicy1>(forward_range, total,
                                             iterator_vector, expand_policy);
 
+            detail::partition::no_tasks tasks;
             return detail::partition::partition_one_range
                 <
                     0, Box
                 >::apply(total, iterator_vector, 0, min_elements,
-                         visitor, expand_policy, overlaps_policy, box_visitor);
+                         visitor, expand_policy, overlaps_policy, box_visitor,
+                         tasks);
         }
         else
         {
@@ -834,13 +1163,14 @@ public:
             expand_to_range<IncludePolicy2>(forward_range2, total,
                                             iterator_vector2, expand_policy2);
 
+            detail::partition::no_tasks tasks;
             return detail::partition::partition_two_ranges
                 <
                     0, Box
                 >::apply(total, iterator_vector1, iterator_vector2,
                          0, min_elements, visitor, expand_policy1,
                          overlaps_policy1, expand_policy2, overlaps_policy2,
-                         box_visitor);
+                         box_visitor, tasks);
         }
         else
         {
@@ -862,6 +1192,172 @@ public:
 
         return true;
     }
+
+    // Parallel versions of partition. The parts of the partition are
+    // performed by several threads. The visitor passed by the caller isn't
+    // used to visit the pairs. Instead it has to implement:
+    //   VisitPolicy clone() const
+    //     returning the visitor used by one thread to visit a part of pairs,
+    //   void merge(VisitPolicy& other)
+    //     merging the results of the other visitor returned by clone().
+    // The clones are merged in the order in which the pairs are visited
+    // by the sequential partition. If any of them is interrupted, the
+    // following ones are not merged. The clones which are already visiting
+    // aren't stopped by partition, to stop them early the clones may share
+    // a flag, see self_get_turn_points::self_section_parallel_visitor.
+    template
+    <
+        typename ForwardRange,
+        typename VisitPolicy,
+        typename ExpandPolicy,
+        typename OverlapsPolicy
+    >
+    static inline bool apply_parallel(ForwardRange const& forward_range,
+                                      VisitPolicy& visitor,
+                                      ExpandPolicy const& expand_policy,
+                                      OverlapsPolicy const& overlaps_policy,
+                                      std::size_t threads,
+                                      std::size_t min_elements = default_min_elements)
+    {
+        typedef typename boost::range_iterator
+            <
+                ForwardRange const
+            >::type iterator_type;
+        typedef std::vector<iterator_type> iterator_vector_type;
+        typedef detail::partition::partition_task
+            <
+                Box, iterator_vector_type, iterator_vector_type
+            > task_type;
+
+        std::vector<task_type> tasks;
+        iterator_vector_type iterator_vector;
+
+        if (std::size_t(boost::size(forward_range)) > min_elements)
+        {
+            Box total;
+            assign_inverse(total);
+            expand_to_range<IncludePolicy1>(forward_range, total,
+                                            iterator_vector, expand_policy);
+
+            detail::partition::gather_tasks<task_type> gather(tasks,
+                detail::partition::tasks_level(threads));
+            detail::partition::visit_no_policy box_visitor;
+            detail::partition::partition_one_range
+                <
+                    0, Box
+                >::apply(total, iterator_vector, 0, min_elements,
+                         visitor, expand_policy, overlaps_policy, box_visitor,
+                         gather);
+        }
+        else
+        {
+            for (iterator_type it = boost::begin(forward_range);
+                 it != boost::end(forward_range);
+                 ++it)
+            {
+                iterator_vector.push_back(it);
+            }
+
+            tasks.push_back(task_type());
+            tasks.back().input1 = iterator_vector;
+        }
+
+        return detail::partition::parallel_tasks
+            <
+                Box, true
+            >::apply(tasks, threads, min_elements, visitor,
+                     expand_policy, overlaps_policy,
+                     expand_policy, overlaps_policy);
+    }
+
+    template
+    <
+        typename ForwardRange1,
+        typename ForwardRange2,
+        typename VisitPolicy,
+        typename ExpandPolicy1,
+        typename OverlapsPolicy1,
+        typename ExpandPolicy2,
+        typename OverlapsPolicy2
+    >
+    static inline bool apply_parallel(ForwardRange1 const& forward_range1,
+                                      ForwardRange2 const& forward_range2,
+                                      VisitPolicy& visitor,
+                                      ExpandPolicy1 const& expand_policy1,
+                                      OverlapsPolicy1 const& overlaps_policy1,
+                                      ExpandPolicy2 const& expand_policy2,
+                                      OverlapsPolicy2 const& overlaps_policy2,
+                                      std::size_t threads,
+                                      std::size_t min_elements = default_min_elements)
+    {
+        typedef typename boost::range_iterator
+            <
+                ForwardRange1 const
+            >::type iterator_type1;
+        typedef typename boost::range_iterator
+            <
+                ForwardRange2 const
+            >::type iterator_type2;
+        typedef std::vector<iterator_type1> iterator_vector_type1;
+        typedef std::vector<iterator_type2> iterator_vector_type2;
+        typedef detail::partition::partition_task
+            <
+                Box, iterator_vector_type1, iterator_vector_type2
+            > task_type;
+
+        std::vector<task_type> tasks;
+        iterator_vector_type1 iterator_vector1;
+        iterator_vector_type2 iterator_vector2;
+
+        if (std::size_t(boost::size(forward_range1)) > min_elements
+            && std::size_t(boost::size(forward_range2)) > min_elements)
+        {
+            Box total;
+            assign_inverse(total);
+            expand_to_range<IncludePolicy1>(forward_range1, total,
+                                            iterator_vector1, expand_policy1);
+            expand_to_range<IncludePolicy2>(forward_range2, total,
+                                            iterator_vector2, expand_policy2);
+
+            detail::partition::gather_tasks<task_type> gather(tasks,
+                detail::partition::tasks_level(threads));
+            detail::partition::visit_no_policy box_visitor;
+            detail::partition::partition_two_ranges
+                <
+                    0, Box
+                >::apply(total, iterator_vector1, iterator_vector2,
+                         0, min_elements, visitor, expand_policy1,
+                         overlaps_policy1, expand_policy2, overlaps_policy2,
+                         box_visitor, gather);
+        }
+        else
+        {
+            for (iterator_type1 it = boost::begin(forward_range1);
+                 it != boost::end(forward_range1);
+                 ++it)
+            {
+                iterator_vector1.push_back(it);
+            }
+            for (iterator_type2 it = boost::begin(forward_range2);
+                 it != boost::end(forward_range2);
+                 ++it)
+            {
+                iterator_vector2.push_back(it);
+            }
+
+            tasks.push_back(task_type());
+            tasks.back().kind = task_type::handle_two_ranges;
+            tasks.back().input1 = iterator_vector1;
+            tasks.back().input2 = iterator_vector2;
+        }
+
+        return detail::partition::parallel_tasks
+            <
+                Box, false
+            >::apply(tasks, threads, min_elements, visitor,
+                     expand_policy1, overlaps_policy1,
+                     expand_policy2, overlaps_policy2);
+    }
 };
 
 
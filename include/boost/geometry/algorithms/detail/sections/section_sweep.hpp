@@ -0,0 +1,623 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_SWEEP_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_SWEEP_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/algorithms/detail/sweep.hpp>
+#include <boost/geometry/util/parallel.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace section
+{
+
+// The sections are swept along the second dimension. It's not periodic
+// in any coordinate system so the intervals of the bounding boxes can be
+// compared directly.
+static std::size_t const sweep_dimension = 1;
+
+template <typename Section>
+class sweep_event
+{
+public:
+    typedef Section section_type;
+    typedef typename geometry::coordinate_type
+        <
+            typename Section::box_type
+        >::type time_type;
+
+    sweep_event(Section const& section, std::size_t index, int source,
+                bool start_event = true)
+        : m_section(&section)
+        , m_time(start_event
+                 ? geometry::get<min_corner, sweep_dimension>(section.bounding_box)
+                 : geometry::get<max_corner, sweep_dimension>(section.bounding_box))
+        , m_index(index)
+        , m_source(source)
+        , m_start_event(start_event)
+    {}
+
+    inline bool is_start_event() const
+    {
+        return m_start_event;
+    }
+
+    inline Section const& section() const
+    {
+        return *m_section;
+    }
+
+    inline std::size_t index() const
+    {
+        return m_index;
+    }
+
+    inline int source() const
+    {
+        return m_source;
+    }
+
+    inline time_type const& time() const
+    {
+        return m_time;
+    }
+
+    inline bool operator<(sweep_event const& other) const
+    {
+        if (m_time != other.m_time)
+        {
+            return m_time < other.m_time;
+        }
+        // a start-event is before an end-event with the same event time
+        // so the touching sections are visited
+        if (m_start_event != other.m_start_event)
+        {
+            return m_start_event;
+        }
+        // the events with the same time are processed in the order
+        // of the sections for deterministic results
+        return m_index < other.m_index;
+    }
+
+private:
+    Section const* m_section;
+    // stored to not access the sections while ordering the events
+    time_type m_time;
+    std::size_t m_index;
+    int m_source;
+    bool m_start_event;
+};
+
+template <typename Event>
+struct event_greater
+{
+    inline bool operator()(Event const& event1, Event const& event2) const
+    {
+        return event2 < event1;
+    }
+};
+
+
+// The priority queue of the events. All of the start events are known
+// before the sweep so they're sorted once and only the end events pushed
+// during the sweep are kept in the heap.
+template <typename Event>
+class event_queue
+{
+public:
+    typedef Event value_type;
+
+    event_queue()
+        : m_next(0)
+    {}
+
+    template <typename Range>
+    inline void assign(Range const& range)
+    {
+        m_starts.assign(boost::begin(range), boost::end(range));
+        std::sort(m_starts.begin(), m_starts.end());
+        m_next = 0;
+        m_ends.clear();
+    }
+
+    inline bool empty() const
+    {
+        return m_next == m_starts.size() && m_ends.empty();
+    }
+
+    inline Event const& top() const
+    {
+        return next_is_start() ? m_starts[m_next] : m_ends.front();
+    }
+
+    inline void pop()
+    {
+        if (next_is_start())
+        {
+            ++m_next;
+        }
+        else
+        {
+            std::pop_heap(m_ends.begin(), m_ends.end(), event_greater<Event>());
+            m_ends.pop_back();
+        }
+    }
+
+    inline void push(Event const& event)
+    {
+        m_ends.push_back(event);
+        std::push_heap(m_ends.begin(), m_ends.end(), event_greater<Event>());
+    }
+
+private:
+    inline bool next_is_start() const
+    {
+        return m_next < m_starts.size()
+            && (m_ends.empty() || ! (m_ends.front() < m_starts[m_next]));
+    }
+
+    std::vector<Event> m_starts;
+    std::size_t m_next;
+    std::vector<Event> m_ends;
+};
+
+
+struct initialization_visitor
+{
+    template <typename Range, typename EventQueue, typename EventVisitor>
+    static inline void apply(Range const& range,
+                             EventQueue& queue,
+                             EventVisitor&)
+    {
+        BOOST_GEOMETRY_ASSERT(queue.empty());
+
+        queue.assign(range);
+    }
+};
+
+
+// Divides the first dimension into intervals of equal width. In cartesian
+// coordinate systems there are more intervals so the sections crossing
+// the sweep line far from each other aren't visited. In other coordinate
+// systems the first coordinate may be periodic and there is one interval.
+template <typename Section, bool Cartesian>
+class sweep_buckets
+{
+public:
+    template <typename Events>
+    explicit sweep_buckets(Events const& events)
+        : m_count(1)
+        , m_min(0)
+        , m_scale(0)
+    {
+        if (! Cartesian || events.empty())
+        {
+            return;
+        }
+
+        double min_value = get_min(events.front().section());
+        double max_value = get_max(events.front().section());
+        double widths = 0;
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            double const mn = get_min(events[i].section());
+            double const mx = get_max(events[i].section());
+            min_value = (std::min)(min_value, mn);
+            max_value = (std::max)(max_value, mx);
+            widths += mx - mn;
+        }
+
+        // Roughly the square root of the number of sections, but the
+        // intervals shouldn't be narrower than the sections on average.
+        double const extent = max_value - min_value;
+        double const width = widths / events.size();
+        double count = std::sqrt(static_cast<double>(events.size()));
+        if (width > 0 && extent / width < count)
+        {
+            count = extent / width;
+        }
+
+        if (count >= 2 && extent > 0)
+        {
+            m_count = static_cast<std::size_t>(count);
+            m_min = min_value;
+            m_scale = m_count / extent;
+        }
+    }
+
+    inline std::size_t count() const
+    {
+        return m_count;
+    }
+
+    inline std::size_t first(Section const& section) const
+    {
+        return bucket(get_min(section));
+    }
+
+    inline std::size_t last(Section const& section) const
+    {
+        return bucket(get_max(section));
+    }
+
+    // The index of the interval in which the pair of overlapping sections
+    // is visited. It's overlapped by both of them.
+    inline std::size_t common(Section const& section1, Section const& section2) const
+    {
+        return bucket((std::max)(get_min(section1), get_min(section2)));
+    }
+
+private:
+    static inline double get_min(Section const& section)
+    {
+        return static_cast<double>(geometry::get<min_corner, 0>(section.bounding_box));
+    }
+
+    static inline double get_max(Section const& section)
+    {
+        return static_cast<double>(geometry::get<max_corner, 0>(section.bounding_box));
+    }
+
+    inline std::size_t bucket(double value) const
+    {
+        if (m_count == 1)
+        {
+            return 0;
+        }
+        double const b = (value - m_min) * m_scale;
+        return b <= 0 ? 0
+             : b >= m_count - 1 ? m_count - 1
+             : static_cast<std::size_t>(b);
+    }
+
+    std::size_t m_count;
+    double m_min;
+    double m_scale;
+};
+
+
+// Keeps the sections overlapping the sweep line in the intervals of the first
+// dimension which they overlap. When a section starts it's visited with the
+// active sections of the other source, or with all of the active sections
+// if there is only one source, in the intervals it overlaps.
+template <typename Event, typename VisitPolicy, bool OneRange>
+class event_visitor
+{
+    typedef typename Event::section_type section_type;
+    typedef sweep_buckets
+        <
+            section_type,
+            boost::is_same
+                <
+                    typename geometry::cs_tag<typename section_type::box_type>::type,
+                    cartesian_tag
+                >::value
+        > buckets_type;
+
+    struct active_section
+    {
+        active_section(section_type const* s, std::size_t i)
+            : section(s), index(i)
+        {}
+
+        section_type const* section;
+        std::size_t index;
+    };
+
+    // The intervals overlapped by a section and the position of the first
+    // of them in the positions of the active sections
+    struct section_intervals
+    {
+        section_intervals()
+            : first(0), last(0), offset(0)
+        {}
+
+        std::size_t first;
+        std::size_t last;
+        std::size_t offset;
+    };
+
+    typedef std::vector<active_section> active_sections;
+
+public:
+    template <typename Events>
+    event_visitor(VisitPolicy& visitor, Events const& events)
+        : m_visitor(visitor)
+        , m_buckets(events)
+        , m_intervals(events.size())
+        , m_interrupted(false)
+    {
+        m_active[0].resize(m_buckets.count());
+        m_active[1].resize(OneRange ? 0 : m_buckets.count());
+
+        // the positions of a section in all of the intervals it overlaps
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            section_type const& section = events[i].section();
+            section_intervals& intervals = m_intervals[events[i].index()];
+            intervals.first = m_buckets.first(section);
+            intervals.last = m_buckets.last(section);
+            intervals.offset = offset;
+            offset += intervals.last - intervals.first + 1;
+        }
+        m_positions.resize(offset, 0);
+    }
+
+    template <typename PriorityQueue>
+    inline void apply(Event const& event, PriorityQueue& queue)
+    {
+        std::vector<active_sections>& active = m_active[event.source()];
+        section_type const& section = event.section();
+        section_intervals const& intervals = m_intervals[event.index()];
+        std::size_t const first = intervals.first;
+        std::size_t const last = intervals.last;
+        std::size_t const offset = intervals.offset - first;
+
+        if (event.is_start_event())
+        {
+            visit(event, first, last);
+
+            for (std::size_t b = first; b <= last; ++b)
+            {
+                m_positions[offset + b] = active[b].size();
+                active[b].push_back(active_section(&section, event.index()));
+            }
+            queue.push(Event(section, event.index(), event.source(), false));
+        }
+        else
+        {
+            for (std::size_t b = first; b <= last; ++b)
+            {
+                // swap with the last one and remove
+                std::size_t const pos = m_positions[offset + b];
+                active_section const& moved = active[b].back();
+                section_intervals const& moved_intervals = m_intervals[moved.index];
+                m_positions[moved_intervals.offset - moved_intervals.first + b] = pos;
+                active[b][pos] = moved;
+                active[b].pop_back();
+            }
+        }
+    }
+
+    inline bool interrupted() const
+    {
+        return m_interrupted;
+    }
+
+private:
+    inline void visit(Event const& event, std::size_t first, std::size_t last)
+    {
+        section_type const& section = event.section();
+        bool const reverse = OneRange || event.source() != 0;
+        std::vector<active_sections> const& active = m_active[reverse ? 0 : 1];
+
+        for (std::size_t b = first; b <= last && ! m_interrupted; ++b)
+        {
+            for (std::size_t i = 0; i < active[b].size() && ! m_interrupted; ++i)
+            {
+                section_type const& other = *active[b][i].section;
+                if (m_buckets.count() > 1
+                    && m_buckets.common(section, other) != b)
+                {
+                    continue;
+                }
+
+                m_interrupted = reverse
+                              ? ! m_visitor.apply(other, section)
+                              : ! m_visitor.apply(section, other);
+            }
+        }
+    }
+
+    VisitPolicy& m_visitor;
+    buckets_type m_buckets;
+    std::vector<active_sections> m_active[2];
+    std::vector<section_intervals> m_intervals;
+    std::vector<std::size_t> m_positions;
+    bool m_interrupted;
+};
+
+
+template <typename EventVisitor>
+struct interrupt_policy
+{
+    static bool const enabled = true;
+
+    explicit interrupt_policy(EventVisitor const& visitor)
+        : m_visitor(visitor)
+    {}
+
+    template <typename Event>
+    inline bool apply(Event const&) const
+    {
+        return m_visitor.interrupted();
+    }
+
+    EventVisitor const& m_visitor;
+};
+
+
+template <bool OneRange, typename Events, typename VisitPolicy>
+inline bool sweep_events(Events const& events, VisitPolicy& visitor)
+{
+    typedef typename boost::range_value<Events>::type event_type;
+
+    event_queue<event_type> queue;
+
+    initialization_visitor init_visitor;
+    event_visitor<event_type, VisitPolicy, OneRange> sweep_visitor(visitor, events);
+
+    geometry::sweep(events, queue, init_visitor, sweep_visitor,
+                    interrupt_policy<event_visitor<event_type, VisitPolicy, OneRange> >(sweep_visitor));
+
+    return ! sweep_visitor.interrupted();
+}
+
+
+// Visits the pairs of sections whose bounding boxes overlap in the sweep
+// dimension, like partition visits the pairs of sections. The visitor
+// has to check the overlap of the whole bounding boxes. Returns false
+// if the visitor interrupted the process.
+template <typename Sections, typename VisitPolicy>
+inline bool sweep_sections(Sections const& sections, VisitPolicy& visitor)
+{
+    typedef sweep_event<typename boost::range_value<Sections>::type> event_type;
+
+    std::vector<event_type> events;
+    events.reserve(boost::size(sections));
+    std::size_t index = 0;
+    for (typename boost::range_iterator<Sections const>::type
+            it = boost::begin(sections); it != boost::end(sections); ++it, ++index)
+    {
+        events.push_back(event_type(*it, index, 0));
+    }
+
+    return sweep_events<true>(events, visitor);
+}
+
+template <typename Sections1, typename Sections2, typename VisitPolicy>
+inline bool sweep_sections(Sections1 const& sections1,
+                           Sections2 const& sections2,
+                           VisitPolicy& visitor)
+{
+    typedef sweep_event<typename boost::range_value<Sections1>::type> event_type;
+
+    std::vector<event_type> events;
+    events.reserve(boost::size(sections1) + boost::size(sections2));
+    std::size_t index = 0;
+    for (typename boost::range_iterator<Sections1 const>::type
+            it = boost::begin(sections1); it != boost::end(sections1); ++it, ++index)
+    {
+        events.push_back(event_type(*it, index, 0));
+    }
+    for (typename boost::range_iterator<Sections2 const>::type
+            it = boost::begin(sections2); it != boost::end(sections2); ++it, ++index)
+    {
+        events.push_back(event_type(*it, index, 1));
+    }
+
+    return sweep_events<false>(events, visitor);
+}
+
+
+// Gathers the pairs of sections in the order of visiting
+template <typename Section>
+struct section_pairs_gatherer
+{
+    typedef std::pair<Section const*, Section const*> pair_type;
+
+    explicit section_pairs_gatherer(std::vector<pair_type>& pairs)
+        : m_pairs(pairs)
+    {}
+
+    inline bool apply(Section const& sec1, Section const& sec2)
+    {
+        m_pairs.push_back(pair_type(&sec1, &sec2));
+        return true;
+    }
+
+    std::vector<pair_type>& m_pairs;
+};
+
+// Visits the pairs of a task with a new clone of the visitor
+template <typename Section, typename VisitPolicy>
+struct section_pairs_task
+{
+    typedef std::pair<Section const*, Section const*> pair_type;
+
+    section_pairs_task(std::vector<pair_type> const& pairs,
+                       std::vector<boost::optional<VisitPolicy> >& visitors,
+                       VisitPolicy const& prototype)
+        : m_pairs(pairs), m_visitors(visitors), m_prototype(prototype)
+    {}
+
+    inline bool operator()(std::size_t i) const
+    {
+        std::size_t const count = m_visitors.size();
+        std::size_t const first = m_pairs.size() * i / count;
+        std::size_t const last = m_pairs.size() * (i + 1) / count;
+
+        m_visitors[i] = m_prototype.clone();
+        for (std::size_t j = first; j < last; ++j)
+        {
+            if (! m_visitors[i]->apply(*m_pairs[j].first, *m_pairs[j].second))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<pair_type> const& m_pairs;
+    std::vector<boost::optional<VisitPolicy> >& m_visitors;
+    VisitPolicy const& m_prototype;
+};
+
+// Like sweep_sections() but the pairs of sections are gathered first and
+// then divided into contiguous tasks visited by several threads. Each task
+// is visited with its own clone of the visitor and the clones are merged
+// into the visitor in the order of the tasks, like in
+// partition::apply_parallel(). If a task is interrupted, the following
+// clones are not merged.
+template <typename Sections, typename VisitPolicy>
+inline bool sweep_sections_parallel(Sections const& sections,
+                                    VisitPolicy& visitor,
+                                    std::size_t threads)
+{
+    typedef typename boost::range_value<Sections>::type section_type;
+    typedef std::pair<section_type const*, section_type const*> pair_type;
+
+    std::size_t const tasks_per_thread = 8;
+
+    std::vector<pair_type> pairs;
+    section_pairs_gatherer<section_type> gatherer(pairs);
+    sweep_sections(sections, gatherer);
+
+    std::size_t const tasks_count
+        = (std::min)(pairs.size(), threads * tasks_per_thread);
+    std::vector<boost::optional<VisitPolicy> > visitors(tasks_count);
+    std::size_t const interrupted
+        = geometry::detail::parallel::for_each_index(tasks_count, threads,
+            section_pairs_task<section_type, VisitPolicy>(pairs, visitors, visitor));
+
+    for (std::size_t i = 0; i < visitors.size() && i <= interrupted; ++i)
+    {
+        visitor.merge(*visitors[i]);
+    }
+
+    return interrupted >= tasks_count;
+}
+
+
+}} // namespace detail::section
+#endif
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_SWEEP_HPP
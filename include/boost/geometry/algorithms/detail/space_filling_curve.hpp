@@ -0,0 +1,161 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SPACE_FILLING_CURVE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SPACE_FILLING_CURVE_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace space_filling_curve
+{
+
+// The codes of the positions of the centers of boxes on the space-filling
+// curves covering the bounds, used to sort the boxes so the close ones
+// are next to each other, e.g. by the packing of the rtree.
+
+template <typename Box>
+struct sfc_traits
+{
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+    // number of bits of a cell coordinate in each dimension
+    static const std::size_t bits = 64 / dimension < 32 ? 64 / dimension : 32;
+
+    BOOST_STATIC_ASSERT(0 < dimension && dimension <= 64);
+};
+
+namespace dispatch {
+
+// Calculates the coordinates of a cell of a regular grid covering bounds
+// containing the center of a box.
+template <typename Box,
+          std::size_t CurrentDimension = dimension<Box>::value>
+struct sfc_cell_of_box
+{
+    static inline void apply(Box const& b, Box const& bounds, boost::uint32_t * cell)
+    {
+        sfc_cell_of_box<Box, CurrentDimension - 1>::apply(b, bounds, cell);
+
+        static const std::size_t i = CurrentDimension - 1;
+        static const boost::uint64_t max_cell
+            = (boost::uint64_t(1) << sfc_traits<Box>::bits) - 1;
+
+        double const lo = static_cast<double>(get<min_corner, i>(bounds));
+        double const hi = static_cast<double>(get<max_corner, i>(bounds));
+        double const c = ( static_cast<double>(get<min_corner, i>(b))
+                         + static_cast<double>(get<max_corner, i>(b)) ) / 2;
+
+        double t = hi > lo ? (c - lo) / (hi - lo) : 0;
+        t = t < 0 ? 0 : (t > 1 ? 1 : t);
+
+        cell[i] = static_cast<boost::uint32_t>(t * static_cast<double>(max_cell));
+    }
+};
+
+template <typename Box>
+struct sfc_cell_of_box<Box, 0>
+{
+    static inline void apply(Box const& , Box const& , boost::uint32_t * )
+    {}
+};
+
+} // namespace dispatch
+
+// Interleaves the bits of the cell coordinates, the most significant first.
+template <typename Box>
+inline boost::uint64_t sfc_interleave(boost::uint32_t const* cell)
+{
+    typedef sfc_traits<Box> traits;
+
+    boost::uint64_t result = 0;
+    for ( std::size_t bit = traits::bits ; bit > 0 ; --bit )
+    {
+        for ( std::size_t d = 0 ; d < traits::dimension ; ++d )
+        {
+            result = (result << 1) | ((cell[d] >> (bit - 1)) & 1u);
+        }
+    }
+    return result;
+}
+
+// Returns the position of the center of a box on the Z-order curve (Morton code)
+// covering bounds.
+template <typename Box>
+inline boost::uint64_t morton_code(Box const& b, Box const& bounds)
+{
+    typedef sfc_traits<Box> traits;
+
+    boost::uint32_t cell[traits::dimension];
+    dispatch::sfc_cell_of_box<Box>::apply(b, bounds, cell);
+
+    return sfc_interleave<Box>(cell);
+}
+
+// Returns the position of the center of a box on the Hilbert curve covering bounds.
+// The cell coordinates are transformed into the transposed Hilbert index
+// with the algorithm of J. Skilling, "Programming the Hilbert curve", 2004
+// and then the bits are interleaved.
+template <typename Box>
+inline boost::uint64_t hilbert_code(Box const& b, Box const& bounds)
+{
+    typedef sfc_traits<Box> traits;
+
+    boost::uint32_t cell[traits::dimension];
+    dispatch::sfc_cell_of_box<Box>::apply(b, bounds, cell);
+
+    boost::uint32_t const m = boost::uint32_t(1) << (traits::bits - 1);
+
+    // inverse undo
+    // NOTE: the bits are random so the branches are replaced with masks,
+    //   if the bit q is set the lower bits of the first coordinate are inverted,
+    //   otherwise they are exchanged with the lower bits of d-th coordinate
+    for ( boost::uint32_t q = m ; q > 1 ; q >>= 1 )
+    {
+        boost::uint32_t const p = q - 1;
+        for ( std::size_t d = 0 ; d < traits::dimension ; ++d )
+        {
+            boost::uint32_t const set = 0u - boost::uint32_t((cell[d] & q) != 0);
+            boost::uint32_t const t = (cell[0] ^ cell[d]) & p & ~set;
+            cell[0] ^= (p & set) | t;
+            cell[d] ^= t;
+        }
+    }
+
+    // Gray encode
+    for ( std::size_t d = 1 ; d < traits::dimension ; ++d )
+    {
+        cell[d] ^= cell[d - 1];
+    }
+    boost::uint32_t t = 0;
+    for ( boost::uint32_t q = m ; q > 1 ; q >>= 1 )
+    {
+        t ^= (q - 1) & (0u - boost::uint32_t((cell[traits::dimension - 1] & q) != 0));
+    }
+    for ( std::size_t d = 0 ; d < traits::dimension ; ++d )
+    {
+        cell[d] ^= t;
+    }
+
+    return sfc_interleave<Box>(cell);
+}
+
+}} // namespace detail::space_filling_curve
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SPACE_FILLING_CURVE_HPP
@@ -0,0 +1,769 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_PREPARED_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_PREPARED_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <boost/core/addressof.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/crosses.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/overlaps.hpp>
+#include <boost/geometry/algorithms/relate.hpp>
+#include <boost/geometry/algorithms/relation.hpp>
+#include <boost/geometry/algorithms/touches.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/point_on_border.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/strategies/within.hpp>
+
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/math.hpp>
+
+#include <boost/geometry/views/detail/normalized_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+
+// The polygon the ring belongs to, the rings are stored in the order of the
+// polygons and the exterior ring goes first.
+struct ring_info
+{
+    ring_info(std::size_t p, bool e)
+        : polygon(p), exterior(e)
+    {}
+
+    std::size_t polygon;
+    bool exterior;
+};
+
+// The segments of the rings in the normalized order (closed, clockwise)
+// with the indexes of the rings, so the point in polygon strategy can be
+// applied to the subset of the segments of a ring.
+template <typename Ring, typename Value>
+inline void add_ring(Ring const& ring, std::size_t polygon, bool exterior,
+                     std::vector<Value>& segments,
+                     std::vector<ring_info>& rings)
+{
+    typedef typename Value::first_type segment_type;
+    typedef detail::normalized_view<Ring const> view_type;
+    typedef typename boost::range_iterator<view_type const>::type iterator_type;
+
+    // the same as in point_in_geometry(), too small rings are not taken
+    // into account
+    if (boost::size(ring) < core_detail::closure::minimum_ring_size
+                                <
+                                    geometry::closure<Ring>::value
+                                >::value)
+    {
+        return;
+    }
+
+    std::size_t const ring_index = rings.size();
+    rings.push_back(ring_info(polygon, exterior));
+
+    view_type const view(ring);
+    iterator_type it = boost::begin(view);
+    iterator_type const end = boost::end(view);
+    for (iterator_type previous = it++; it != end; ++previous, ++it)
+    {
+        segments.push_back(Value(segment_type(*previous, *it), ring_index));
+    }
+}
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct add_rings
+    : not_implemented<Tag>
+{};
+
+template <typename Ring>
+struct add_rings<Ring, ring_tag>
+{
+    template <typename Value>
+    static inline void apply(Ring const& ring, std::size_t polygon,
+                             std::vector<Value>& segments,
+                             std::vector<ring_info>& rings)
+    {
+        add_ring(ring, polygon, true, segments, rings);
+    }
+};
+
+template <typename Polygon>
+struct add_rings<Polygon, polygon_tag>
+{
+    template <typename Value>
+    static inline void apply(Polygon const& polygon, std::size_t index,
+                             std::vector<Value>& segments,
+                             std::vector<ring_info>& rings)
+    {
+        add_ring(exterior_ring(polygon), index, true, segments, rings);
+
+        typename interior_return_type<Polygon const>::type
+            interiors = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(interiors); it != boost::end(interiors); ++it)
+        {
+            add_ring(*it, index, false, segments, rings);
+        }
+    }
+};
+
+template <typename MultiPolygon>
+struct add_rings<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Value>
+    static inline void apply(MultiPolygon const& multi_polygon, std::size_t ,
+                             std::vector<Value>& segments,
+                             std::vector<ring_info>& rings)
+    {
+        typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+        typedef typename boost::range_iterator<MultiPolygon const>::type iterator_type;
+
+        std::size_t index = 0;
+        for (iterator_type it = boost::begin(multi_polygon);
+             it != boost::end(multi_polygon); ++it, ++index)
+        {
+            add_rings<polygon_type>::apply(*it, index, segments, rings);
+        }
+    }
+};
+
+
+// Any point of a geometry, used to check on which side of the boundary
+// of the prepared geometry the geometry lies if they don't intersect.
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct any_point
+{
+    template <typename Point>
+    static inline bool apply(Geometry const& geometry, Point& point)
+    {
+        return geometry::point_on_border(point, geometry);
+    }
+};
+
+template <typename Segment>
+struct any_point<Segment, segment_tag>
+{
+    template <typename Point>
+    static inline bool apply(Segment const& segment, Point& point)
+    {
+        detail::assign_point_from_index<0>(segment, point);
+        return true;
+    }
+};
+
+
+// Returns 1 if the geometry is in the interior of the prepared geometry,
+// -1 if it is in the exterior and 0 if it's not known, e.g. because
+// the geometry is close to the boundary.
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct locate
+{
+    template <typename Prepared, typename Box>
+    static inline int apply(Geometry const& geometry, Box const& box,
+                            Prepared const& prepared)
+    {
+        if (geometry::disjoint(box, prepared.envelope()))
+        {
+            return -1;
+        }
+
+        if (prepared.boundary_intersects(box))
+        {
+            return 0;
+        }
+
+        // the boundary of the prepared geometry doesn't go through the box
+        // so the whole geometry is either inside or outside
+        typename geometry::point_type<Geometry>::type point;
+        return any_point<Geometry>::apply(geometry, point)
+             ? prepared.point_in_geometry(point)
+             : 0;
+    }
+};
+
+template <typename Point>
+struct locate<Point, point_tag>
+{
+    template <typename Prepared, typename Box>
+    static inline int apply(Point const& point, Box const& ,
+                            Prepared const& prepared)
+    {
+        // the point on the boundary is handled by the algorithm
+        return prepared.point_in_geometry(point);
+    }
+};
+
+template <typename MultiPoint>
+struct locate<MultiPoint, multi_point_tag>
+{
+    template <typename Prepared, typename Box>
+    static inline int apply(MultiPoint const& multi_point, Box const& ,
+                            Prepared const& prepared)
+    {
+        typedef typename boost::range_iterator<MultiPoint const>::type iterator_type;
+
+        int result = 0;
+        for (iterator_type it = boost::begin(multi_point);
+             it != boost::end(multi_point); ++it)
+        {
+            int const pip = prepared.point_in_geometry(*it);
+            if (pip == 0 || (result != 0 && pip != result))
+            {
+                return 0;
+            }
+            result = pip;
+        }
+        return result;
+    }
+};
+
+
+// The distance from the box big enough to be representable for all
+// coordinates of the box. The coordinates of integral types are exact so
+// one unit is enough. False is returned if the coordinates of the proxy box,
+// at most twice the margin from the box, aren't representable, the margin
+// is compared with the limits so the coordinates aren't calculated if they
+// would overflow.
+template <typename T>
+inline bool margin(T const& min_value, T const& max_value, T& result)
+{
+    typedef std::numeric_limits<T> limits;
+
+    if (BOOST_GEOMETRY_CONDITION(limits::is_integer))
+    {
+        result = 1;
+    }
+    else
+    {
+        result = max_value - min_value + math::abs(min_value) + math::abs(max_value) + 1;
+    }
+
+    if (BOOST_GEOMETRY_CONDITION(! limits::is_bounded))
+    {
+        return true;
+    }
+
+    T const lowest = limits::is_integer ? (limits::min)() : -(limits::max)();
+    return min_value >= lowest + result
+        && max_value <= (limits::max)() - result - result;
+}
+
+// The box strictly containing the box of a geometry lying in the interior
+// of the prepared geometry or the box disjoint with the box of a geometry
+// lying in the exterior. The relation of the geometry and the prepared
+// geometry is the same as the relation of the geometry and this box.
+// Returns false if the coordinates of such box aren't representable.
+template <typename Box>
+inline bool proxy_box(Box const& box, bool interior, Box& result)
+{
+    typedef typename coordinate_type<Box>::type coordinate_type;
+
+    coordinate_type const min_x = geometry::get<min_corner, 0>(box);
+    coordinate_type const min_y = geometry::get<min_corner, 1>(box);
+    coordinate_type const max_x = geometry::get<max_corner, 0>(box);
+    coordinate_type const max_y = geometry::get<max_corner, 1>(box);
+
+    coordinate_type dx = 0, dy = 0;
+    if (! margin(min_x, max_x, dx) || ! margin(min_y, max_y, dy))
+    {
+        return false;
+    }
+
+    geometry::set<min_corner, 0>(result, interior ? min_x - dx : max_x + dx);
+    geometry::set<max_corner, 0>(result, interior ? max_x + dx : max_x + dx + dx);
+    geometry::set<min_corner, 1>(result, min_y - dy);
+    geometry::set<max_corner, 1>(result, max_y + dy);
+    return true;
+}
+
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Areal geometry prepared for repeated spatial predicates and overlays
+\ingroup geometries
+\details The envelope of the geometry, the rings and the segments of the
+    rings indexed by the rtree are calculated once at construction.
+    The prepared geometry can be passed as either argument of within(),
+    covered_by(), intersects(), disjoint(), touches(), overlaps(), crosses(),
+    equals(), relate(), relation() and intersection(). If the other
+    geometry is far from the boundary of the prepared geometry, i.e. no
+    segment of the boundary intersects its envelope, its position is found
+    with the rtree and a point in polygon test of one of its points which
+    visits only the segments crossing the vertical line going through
+    the point. Then the algorithm is called for
+    a box-shaped polygon having the same relation with the other geometry
+    so the cost doesn't depend on the size of the prepared geometry.
+    Otherwise the algorithm is called for the original geometry.
+    Points and multi-points are always located with the rtree.
+\note The prepared geometry keeps a reference to the original geometry
+    which has to be alive and not modified as long as it's used.
+\note The structures are created only for cartesian geometries. For other
+    coordinate systems the algorithms are called for the original geometry.
+\note The prepared geometry is not modified by the algorithms so it can be
+    used by several threads at the same time.
+\note This header isn't included by boost/geometry.hpp, the algorithms
+    accept the prepared geometry if it's included.
+\tparam Geometry \tparam_geometry{Ring, Polygon or MultiPolygon}
+*/
+template <typename Geometry>
+class prepared
+{
+    BOOST_MPL_ASSERT_MSG
+        (
+            (boost::is_same
+                <
+                    typename tag_cast<typename tag<Geometry>::type, areal_tag>::type,
+                    areal_tag
+                >::value),
+            ONLY_AREAL_GEOMETRIES_ARE_SUPPORTED,
+            (types<Geometry>)
+        );
+
+    typedef typename geometry::point_type<Geometry>::type point_type;
+    typedef model::segment<point_type> segment_type;
+    typedef std::pair<segment_type, std::size_t> value_type;
+    typedef index::rtree<value_type, index::rstar<16> > rtree_type;
+
+    static const bool is_cartesian = boost::is_same
+        <
+            typename cs_tag<Geometry>::type,
+            cartesian_tag
+        >::value;
+
+    struct ring_less
+    {
+        inline bool operator()(value_type const& left, value_type const& right) const
+        {
+            return left.second < right.second;
+        }
+    };
+
+public :
+    typedef Geometry geometry_type;
+    typedef model::box<point_type> box_type;
+    typedef model::polygon<point_type> proxy_type;
+
+    /*!
+    \brief Prepares the geometry
+    \param geometry The geometry, it has to be alive and not modified as long
+        as the prepared geometry is used
+    */
+    explicit prepared(Geometry const& geometry)
+        : m_geometry(boost::addressof(geometry))
+    {
+        concepts::check<Geometry const>();
+
+        geometry::envelope(geometry, m_envelope);
+
+        if (BOOST_GEOMETRY_CONDITION(is_cartesian))
+        {
+            std::vector<value_type> segments;
+            detail::prepared::add_rings<Geometry>::apply(geometry, 0, segments, m_rings);
+            // the packing algorithm is used
+            rtree_type(segments).swap(m_rtree);
+        }
+    }
+
+    /// Returns the original geometry
+    inline Geometry const& geometry() const
+    {
+        return *m_geometry;
+    }
+
+    /// Returns the envelope of the geometry
+    inline box_type const& envelope() const
+    {
+        return m_envelope;
+    }
+
+    /// Returns true if a segment of the boundary intersects the box
+    inline bool boundary_intersects(box_type const& box) const
+    {
+        return m_rtree.qbegin(index::intersects(box)) != m_rtree.qend();
+    }
+
+    /*!
+    \brief Checks the relation between the point and the geometry
+    \details Only the segments intersecting the vertical line going through
+        the point are passed into the winding strategy.
+    \return 1 if the point is in the interior, 0 if it's on the boundary
+        and -1 if it's in the exterior of the geometry
+    */
+    template <typename Point>
+    inline int point_in_geometry(Point const& point) const
+    {
+        typedef typename strategy::point_in_geometry::services::default_strategy
+            <
+                Point, Geometry
+            >::type strategy_type;
+
+        if (! geometry::covered_by(point, m_envelope))
+        {
+            return -1;
+        }
+
+        box_type line;
+        geometry::set<min_corner, 0>(line, geometry::get<0>(point));
+        geometry::set<max_corner, 0>(line, geometry::get<0>(point));
+        geometry::set<min_corner, 1>(line, geometry::get<min_corner, 1>(m_envelope));
+        geometry::set<max_corner, 1>(line, geometry::get<max_corner, 1>(m_envelope));
+
+        std::vector<value_type> segments;
+        m_rtree.query(index::intersects(line), std::back_inserter(segments));
+        std::sort(segments.begin(), segments.end(), ring_less());
+
+        strategy_type const strategy;
+
+        // Rings not having any segment crossing the line don't contain
+        // the point, the same rules as in point_in_geometry() are used for
+        // the exterior and interior rings of the polygons.
+        std::size_t const none = m_rings.size();
+        std::size_t inside_polygon = none;
+        for (std::size_t i = 0; i < segments.size(); )
+        {
+            std::size_t const ring = segments[i].second;
+            detail::prepared::ring_info const& info = m_rings[ring];
+
+            if (inside_polygon != none && info.polygon != inside_polygon)
+            {
+                return 1;
+            }
+
+            typename strategy_type::state_type state;
+            bool check = true;
+            for ( ; i < segments.size() && segments[i].second == ring; ++i)
+            {
+                if (check)
+                {
+                    check = strategy.apply(point,
+                                           segments[i].first.first,
+                                           segments[i].first.second,
+                                           state);
+                }
+            }
+
+            int const code = strategy.result(state);
+            if (info.exterior)
+            {
+                if (code == 0)
+                {
+                    return 0;
+                }
+                if (code == 1)
+                {
+                    inside_polygon = info.polygon;
+                }
+            }
+            else if (info.polygon == inside_polygon)
+            {
+                if (code == 0)
+                {
+                    return 0;
+                }
+                if (code == 1)
+                {
+                    // in the hole
+                    inside_polygon = none;
+                }
+            }
+        }
+
+        return inside_polygon != none ? 1 : -1;
+    }
+
+    /*!
+    \brief Sets the box-shaped polygon having the same relation with the other
+        geometry as the prepared geometry if the other geometry is far from
+        the boundary or a point
+    \return false if the original geometry has to be used
+    */
+    template <typename OtherGeometry>
+    inline bool proxy(OtherGeometry const& other, proxy_type& result) const
+    {
+        if (m_rtree.empty() || geometry::is_empty(other))
+        {
+            return false;
+        }
+
+        box_type box;
+        geometry::envelope(other, box);
+
+        int const location = detail::prepared::locate
+            <
+                OtherGeometry
+            >::apply(other, box, *this);
+
+        box_type proxy_box;
+        if (location == 0
+            || ! detail::prepared::proxy_box(box, location > 0, proxy_box))
+        {
+            return false;
+        }
+
+        geometry::convert(proxy_box, result);
+        return true;
+    }
+
+private :
+    Geometry const* m_geometry;
+    box_type m_envelope;
+    std::vector<detail::prepared::ring_info> m_rings;
+    rtree_type m_rtree;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+
+// Calls the Algorithm, the struct handling the variants of an algorithm,
+// for the proxy of the prepared geometry having the same relation with
+// the other geometry or for the original geometry if there is no proxy.
+// The algorithms taking an additional argument, e.g. the mask of relate()
+// or the output of intersection(), and the algorithms returning the matrix
+// taken as the explicit template argument, e.g. relation(), are supported.
+template
+<
+    template <typename, typename> class Algorithm,
+    typename Geometry1, typename Geometry2
+>
+struct dispatch_algorithm
+{};
+
+template
+<
+    template <typename, typename> class Algorithm,
+    typename Geometry1, typename Geometry2
+>
+struct dispatch_algorithm<Algorithm, geometry::prepared<Geometry1>, Geometry2>
+{
+    template <typename Strategy>
+    static inline bool apply(geometry::prepared<Geometry1> const& geometry1,
+                             Geometry2 const& geometry2,
+                             Strategy const& strategy)
+    {
+        typedef typename geometry::prepared<Geometry1>::proxy_type proxy_type;
+
+        proxy_type proxy;
+        return geometry1.proxy(geometry2, proxy)
+             ? Algorithm<proxy_type, Geometry2>::apply(proxy, geometry2, strategy)
+             : Algorithm<Geometry1, Geometry2>::apply(geometry1.geometry(), geometry2, strategy);
+    }
+
+    template <typename Arg, typename Strategy>
+    static inline bool apply(geometry::prepared<Geometry1> const& geometry1,
+                             Geometry2 const& geometry2,
+                             Arg& arg,
+                             Strategy const& strategy)
+    {
+        typedef typename geometry::prepared<Geometry1>::proxy_type proxy_type;
+
+        proxy_type proxy;
+        return geometry1.proxy(geometry2, proxy)
+             ? Algorithm<proxy_type, Geometry2>::apply(proxy, geometry2, arg, strategy)
+             : Algorithm<Geometry1, Geometry2>::apply(geometry1.geometry(), geometry2, arg, strategy);
+    }
+
+    template <typename Matrix, typename Strategy>
+    static inline Matrix apply(geometry::prepared<Geometry1> const& geometry1,
+                               Geometry2 const& geometry2,
+                               Strategy const& strategy)
+    {
+        typedef typename geometry::prepared<Geometry1>::proxy_type proxy_type;
+
+        proxy_type proxy;
+        return geometry1.proxy(geometry2, proxy)
+             ? Algorithm<proxy_type, Geometry2>::template apply<Matrix>(proxy, geometry2, strategy)
+             : Algorithm<Geometry1, Geometry2>::template apply<Matrix>(geometry1.geometry(), geometry2, strategy);
+    }
+};
+
+template
+<
+    template <typename, typename> class Algorithm,
+    typename Geometry1, typename Geometry2
+>
+struct dispatch_algorithm<Algorithm, Geometry1, geometry::prepared<Geometry2> >
+{
+    template <typename Strategy>
+    static inline bool apply(Geometry1 const& geometry1,
+                             geometry::prepared<Geometry2> const& geometry2,
+                             Strategy const& strategy)
+    {
+        typedef typename geometry::prepared<Geometry2>::proxy_type proxy_type;
+
+        proxy_type proxy;
+        return geometry2.proxy(geometry1, proxy)
+             ? Algorithm<Geometry1, proxy_type>::apply(geometry1, proxy, strategy)
+             : Algorithm<Geometry1, Geometry2>::apply(geometry1, geometry2.geometry(), strategy);
+    }
+
+    template <typename Arg, typename Strategy>
+    static inline bool apply(Geometry1 const& geometry1,
+                             geometry::prepared<Geometry2> const& geometry2,
+                             Arg& arg,
+                             Strategy const& strategy)
+    {
+        typedef typename geometry::prepared<Geometry2>::proxy_type proxy_type;
+
+        proxy_type proxy;
+        return geometry2.proxy(geometry1, proxy)
+             ? Algorithm<Geometry1, proxy_type>::apply(geometry1, proxy, arg, strategy)
+             : Algorithm<Geometry1, Geometry2>::apply(geometry1, geometry2.geometry(), arg, strategy);
+    }
+
+    template <typename Matrix, typename Strategy>
+    static inline Matrix apply(Geometry1 const& geometry1,
+                               geometry::prepared<Geometry2> const& geometry2,
+                               Strategy const& strategy)
+    {
+        typedef typename geometry::prepared<Geometry2>::proxy_type proxy_type;
+
+        proxy_type proxy;
+        return geometry2.proxy(geometry1, proxy)
+             ? Algorithm<Geometry1, proxy_type>::template apply<Matrix>(geometry1, proxy, strategy)
+             : Algorithm<Geometry1, Geometry2>::template apply<Matrix>(geometry1, geometry2.geometry(), strategy);
+    }
+};
+
+// Both geometries are prepared, only the second one is used
+template
+<
+    template <typename, typename> class Algorithm,
+    typename Geometry1, typename Geometry2
+>
+struct dispatch_algorithm
+    <
+        Algorithm, geometry::prepared<Geometry1>, geometry::prepared<Geometry2>
+    >
+{
+    typedef Algorithm<Geometry1, geometry::prepared<Geometry2> > algorithm_type;
+
+    template <typename Strategy>
+    static inline bool apply(geometry::prepared<Geometry1> const& geometry1,
+                             geometry::prepared<Geometry2> const& geometry2,
+                             Strategy const& strategy)
+    {
+        return algorithm_type::apply(geometry1.geometry(), geometry2, strategy);
+    }
+
+    template <typename Arg, typename Strategy>
+    static inline bool apply(geometry::prepared<Geometry1> const& geometry1,
+                             geometry::prepared<Geometry2> const& geometry2,
+                             Arg& arg,
+                             Strategy const& strategy)
+    {
+        return algorithm_type::apply(geometry1.geometry(), geometry2, arg, strategy);
+    }
+
+    template <typename Matrix, typename Strategy>
+    static inline Matrix apply(geometry::prepared<Geometry1> const& geometry1,
+                               geometry::prepared<Geometry2> const& geometry2,
+                               Strategy const& strategy)
+    {
+        return algorithm_type::template apply<Matrix>(geometry1.geometry(), geometry2, strategy);
+    }
+};
+
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace resolve_variant
+{
+
+// The specializations of the algorithms for the prepared geometry are defined
+// here so the algorithms don't depend on the prepared geometry and the rtree
+#define BOOST_GEOMETRY_PREPARED_ALGORITHM(Algorithm)                              \
+    template <typename Geometry1, typename Geometry2>                             \
+    struct Algorithm<prepared<Geometry1>, Geometry2>                              \
+        : detail::prepared::dispatch_algorithm                                    \
+            <Algorithm, prepared<Geometry1>, Geometry2>                           \
+    {};                                                                           \
+    template <typename Geometry1, typename Geometry2>                             \
+    struct Algorithm<Geometry1, prepared<Geometry2> >                             \
+        : detail::prepared::dispatch_algorithm                                    \
+            <Algorithm, Geometry1, prepared<Geometry2> >                          \
+    {};                                                                           \
+    template <typename Geometry1, typename Geometry2>                             \
+    struct Algorithm<prepared<Geometry1>, prepared<Geometry2> >                   \
+        : detail::prepared::dispatch_algorithm                                    \
+            <Algorithm, prepared<Geometry1>, prepared<Geometry2> >                \
+    {};
+
+BOOST_GEOMETRY_PREPARED_ALGORITHM(covered_by)
+BOOST_GEOMETRY_PREPARED_ALGORITHM(crosses)
+BOOST_GEOMETRY_PREPARED_ALGORITHM(disjoint)
+BOOST_GEOMETRY_PREPARED_ALGORITHM(equals)
+BOOST_GEOMETRY_PREPARED_ALGORITHM(intersection)
+BOOST_GEOMETRY_PREPARED_ALGORITHM(overlaps)
+BOOST_GEOMETRY_PREPARED_ALGORITHM(relate)
+BOOST_GEOMETRY_PREPARED_ALGORITHM(relation)
+BOOST_GEOMETRY_PREPARED_ALGORITHM(touches)
+BOOST_GEOMETRY_PREPARED_ALGORITHM(within)
+
+#undef BOOST_GEOMETRY_PREPARED_ALGORITHM
+
+} // namespace resolve_variant
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_PREPARED_HPP
@@ -0,0 +1,312 @@
+// Boost.Geometry Index
+//
+// Arena allocator
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_ARENA_ALLOCATOR_HPP
+#define BOOST_GEOMETRY_INDEX_ARENA_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The memory arena.
+
+The arena allocates memory in big blocks called slabs and hands it out in order.
+Deallocation does nothing. All of the memory is freed at once when \c release()
+is called or when the arena is destroyed. \c reset() frees it as well but keeps
+the biggest slab for the following allocations. The arena is used through the
+\c arena_allocator.
+
+The arena isn't thread-safe.
+
+\par Example
+\verbatim
+bgi::arena arena;
+{
+    typedef bgi::rtree<value_t, bgi::rstar<16>, bgi::indexable<value_t>,
+                       bgi::equal_to<value_t>, bgi::arena_allocator<value_t> > rtree_t;
+    rtree_t rt(values, bgi::rstar<16>(), bgi::indexable<value_t>(),
+               bgi::equal_to<value_t>(), bgi::arena_allocator<value_t>(arena));
+    // ...
+}
+arena.reset();
+\endverbatim
+*/
+class arena
+{
+    arena(arena const&);
+    arena & operator=(arena const&);
+
+    struct slab
+    {
+        slab * next;
+        std::size_t size;
+    };
+
+    // the beginning of the memory of a slab is aligned as its header
+    static const std::size_t header_size = sizeof(slab) < sizeof(long double)
+                                         ? sizeof(long double) : sizeof(slab);
+
+    // the slabs grow up to this size unless bigger memory is requested
+    static const std::size_t max_slab_size = 16 * 1024 * 1024;
+
+public:
+    /*!
+    \brief The constructor.
+
+    \param slab_size    The size of the first slab in bytes. The following ones are
+                        twice as big as the previous ones.
+    */
+    explicit arena(std::size_t slab_size = 64 * 1024)
+        : m_slabs(0)
+        , m_current(0)
+        , m_end(0)
+        , m_first_slab_size(slab_size > header_size ? slab_size : 2 * header_size)
+        , m_slab_size(m_first_slab_size)
+    {}
+
+    /*!
+    \brief The destructor. Frees all of the memory.
+    */
+    ~arena()
+    {
+        release();
+    }
+
+    /*!
+    \brief Allocates the memory with the alignment, which must be a power of 2.
+
+    \par Throws
+    If memory allocation throws.
+    */
+    void * allocate(std::size_t bytes, std::size_t alignment)
+    {
+        char * p = align(m_current, alignment);
+        if ( p == 0 || p > m_end || bytes > static_cast<std::size_t>(m_end - p) )
+        {
+            add_slab(bytes + alignment);                                                        // MAY THROW (alloc)
+            p = align(m_current, alignment);
+        }
+        m_current = p + bytes;
+        return p;
+    }
+
+    /*!
+    \brief Frees all of the memory allocated in the arena.
+
+    The objects stored in the memory of the arena must be destroyed before or mustn't
+    be used afterwards.
+    */
+    void release()
+    {
+        while ( m_slabs )
+        {
+            slab * next = m_slabs->next;
+            ::operator delete(m_slabs);
+            m_slabs = next;
+        }
+        m_current = 0;
+        m_end = 0;
+        m_slab_size = m_first_slab_size;
+    }
+
+    /*!
+    \brief Frees all of the memory allocated in the arena but keeps the biggest slab.
+
+    The memory of the kept slab is reused by the following allocations so the arena
+    used for many short-lived containers doesn't request the memory from the system
+    each time. The objects stored in the memory of the arena must be destroyed before
+    or mustn't be used afterwards.
+    */
+    void reset()
+    {
+        slab * biggest = 0;
+        std::size_t biggest_size = 0;
+        for ( slab * s = m_slabs ; s != 0 ; s = s->next )
+        {
+            if ( biggest == 0 || s->size > biggest_size )
+            {
+                biggest = s;
+                biggest_size = s->size;
+            }
+        }
+
+        while ( m_slabs )
+        {
+            slab * next = m_slabs->next;
+            if ( m_slabs != biggest )
+                ::operator delete(m_slabs);
+            m_slabs = next;
+        }
+
+        if ( biggest != 0 )
+        {
+            biggest->next = 0;
+            m_slabs = biggest;
+            m_current = reinterpret_cast<char*>(biggest) + header_size;
+            m_end = reinterpret_cast<char*>(biggest) + biggest_size;
+        }
+        else
+        {
+            m_current = 0;
+            m_end = 0;
+        }
+    }
+
+private:
+    static char * align(char * p, std::size_t alignment)
+    {
+        boost::uintptr_t const a = reinterpret_cast<boost::uintptr_t>(p);
+        return reinterpret_cast<char*>((a + alignment - 1) & ~(boost::uintptr_t(alignment) - 1));
+    }
+
+    void add_slab(std::size_t min_size)
+    {
+        std::size_t size = m_slab_size;
+        if ( size < min_size + header_size )
+            size = min_size + header_size;
+
+        slab * s = static_cast<slab*>(::operator new(size));                                    // MAY THROW (alloc)
+        s->next = m_slabs;
+        s->size = size;
+        m_slabs = s;
+
+        m_current = reinterpret_cast<char*>(s) + header_size;
+        m_end = reinterpret_cast<char*>(s) + size;
+
+        if ( m_slab_size < max_slab_size )
+            m_slab_size *= 2;
+    }
+
+    slab * m_slabs;
+    char * m_current;
+    char * m_end;
+    std::size_t m_first_slab_size;
+    std::size_t m_slab_size;
+};
+
+/*!
+\brief The allocator allocating the memory in the arena.
+
+The allocator refers to the arena which must outlive all of the containers using it.
+Deallocation does nothing so the memory is freed only when the arena is released.
+
+If the rtree uses this allocator and both Value and Box are trivially destructible
+the nodes aren't destroyed one by one when the rtree is cleared or destroyed. So both
+operations are performed in constant time and all of the memory is freed by the arena.
+Since the arena isn't thread-safe the rtree can't be created by several threads.
+Passing \c parallel policy into the packing constructor is a compile-time error.
+The sort-based packing using more than one thread sorts the values concurrently
+but creates the nodes by one thread.
+
+\par Example
+\verbatim
+bgi::arena arena;
+bgi::rtree<value_t, bgi::rstar<16>, bgi::indexable<value_t>,
+           bgi::equal_to<value_t>, bgi::arena_allocator<value_t> >
+    rt(bgi::rstar<16>(), bgi::indexable<value_t>(),
+       bgi::equal_to<value_t>(), bgi::arena_allocator<value_t>(arena));
+\endverbatim
+*/
+template <typename T>
+class arena_allocator
+{
+public:
+    typedef T value_type;
+    typedef T * pointer;
+    typedef T const* const_pointer;
+    typedef T & reference;
+    typedef T const& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef arena_allocator<U> other;
+    };
+
+    /*!
+    \brief The constructor.
+
+    \param a    The arena in which the memory is allocated.
+    */
+    explicit arena_allocator(index::arena & a)
+        : m_arena(&a)
+    {}
+
+    template <typename U>
+    arena_allocator(arena_allocator<U> const& other)
+        : m_arena(&other.get_arena())
+    {}
+
+    pointer allocate(size_type n)
+    {
+        if ( n > max_size() )
+            throw std::bad_alloc();
+
+        return static_cast<pointer>(
+                m_arena->allocate(n * sizeof(T), boost::alignment_of<T>::value));               // MAY THROW (alloc)
+    }
+
+    void deallocate(pointer, size_type)
+    {}
+
+    size_type max_size() const
+    {
+        return size_type(-1) / sizeof(T);
+    }
+
+    /*!
+    \brief Returns the arena in which the memory is allocated.
+    */
+    index::arena & get_arena() const
+    {
+        return *m_arena;
+    }
+
+private:
+    index::arena * m_arena;
+};
+
+template <typename T, typename U>
+inline bool operator==(arena_allocator<T> const& l, arena_allocator<U> const& r)
+{
+    return &l.get_arena() == &r.get_arena();
+}
+
+template <typename T, typename U>
+inline bool operator!=(arena_allocator<T> const& l, arena_allocator<U> const& r)
+{
+    return !(l == r);
+}
+
+namespace detail {
+
+template <typename Allocator>
+struct is_arena_allocator
+    : boost::false_type
+{};
+
+template <typename T>
+struct is_arena_allocator< arena_allocator<T> >
+    : boost::true_type
+{};
+
+} // namespace detail
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_ARENA_ALLOCATOR_HPP
@@ -0,0 +1,54 @@
+// Boost.Geometry Index
+//
+// Query callback
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_CALLBACK_HPP
+#define BOOST_GEOMETRY_INDEX_CALLBACK_HPP
+
+#include <boost/geometry/index/detail/query_output.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief Query callback generator.
+
+Returns an object which may be passed into the query function instead of
+the output iterator. Then each Value found is passed to the function object
+by const reference so it isn't copied. The function object must return
+a value convertible to \c bool. If \c false is returned the query is stopped.
+The query returns the number of Values passed to the function object.
+
+The function object is stored by value. In order to access the state
+of the function object after the query pass it by reference, e.g. wrapped
+with <tt>std::ref()</tt>, or capture the state by reference in a lambda.
+
+\par Example
+\verbatim
+// count the values without copying them
+std::size_t count = 0;
+rt.query(bgi::intersects(box), bgi::callback([&](value_t const&) { ++count; return true; }));
+// check if any value intersects the box
+bool found = rt.query(bgi::intersects(box), bgi::callback([](value_t const&) { return false; })) > 0;
+\endverbatim
+
+\ingroup inserters
+
+\param f    The function object called for each Value found.
+
+\return     The object passing the Values found to the function object.
+*/
+template <typename Function>
+inline detail::query_callback<Function> callback(Function f)
+{
+    return detail::query_callback<Function>(f);
+}
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_CALLBACK_HPP
@@ -0,0 +1,847 @@
+// Boost.Geometry Index
+//
+// R-tree supporting concurrent queries and a single writer
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_CONCURRENT_RTREE_HPP
+#define BOOST_GEOMETRY_INDEX_CONCURRENT_RTREE_HPP
+
+#include <vector>
+
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/core/pointer_traits.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/index/detail/rtree/members_access.hpp>
+#include <boost/geometry/index/detail/rtree/node/copy_on_write.hpp>
+
+#include <boost/geometry/util/parallel.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The R-tree which may be queried concurrently with a modification.
+
+The container is modified by one thread at a time, the modifications are serialized
+internally. The queries are performed on snapshots returned by \c get_snapshot().
+A snapshot is an immutable version of the tree. It isn't affected by the following
+modifications so it may be queried from any number of threads without locking
+while the container is modified.
+
+The nodes are not copied when a snapshot is created. Instead the modification copies
+the nodes on the path from the root to the modified node and the new version of
+the tree shares all other nodes with the previous versions. The replaced nodes are
+destroyed by the writer when there are no more snapshots which can access them.
+Getting a snapshot is cheap, it only copies a reference-counted pointer.
+
+Each operation modifying the container publishes one new version of the tree. So
+a snapshot either contains all values inserted or removed by a call to
+\c insert() or \c remove() with a range of values or none of them.
+
+The snapshots must not outlive the container.
+
+\par Example
+\verbatim
+typedef bgi::concurrent_rtree< value_t, bgi::rstar<16> > rtree_t;
+rtree_t rt;
+// writer thread
+rt.insert(v);
+// reader threads
+rtree_t::snapshot s = rt.get_snapshot();
+s.query(bgi::intersects(box), std::back_inserter(result));
+\endverbatim
+
+\tparam Value           The type of objects stored in the container.
+\tparam Parameters      Compile-time parameters.
+\tparam IndexableGetter The function object extracting Indexable from Value.
+\tparam EqualTo         The function object comparing objects of type Value.
+\tparam Allocator       The allocator used to allocate/deallocate memory,
+                        construct/destroy nodes and Values.
+*/
+template
+<
+    typename Value,
+    typename Parameters,
+    typename IndexableGetter = index::indexable<Value>,
+    typename EqualTo = index::equal_to<Value>,
+    typename Allocator = boost::container::new_allocator<Value>
+>
+class concurrent_rtree
+{
+    concurrent_rtree(concurrent_rtree const&);
+    concurrent_rtree & operator=(concurrent_rtree const&);
+
+    typedef detail::rtree::copy_on_write_allocator<Allocator> rtree_allocator_type;
+    typedef index::rtree<Value, Parameters, IndexableGetter, EqualTo, rtree_allocator_type> rtree_type;
+    typedef detail::rtree::members_access<rtree_type> members_access;
+    typedef typename members_access::members_holder members_holder;
+    typedef typename members_holder::node_pointer node_pointer;
+    typedef typename members_holder::node node;
+
+public:
+    /*! \brief The type of Value stored in the container. */
+    typedef Value value_type;
+    /*! \brief R-tree parameters type. */
+    typedef Parameters parameters_type;
+    /*! \brief The function object extracting Indexable from Value. */
+    typedef IndexableGetter indexable_getter;
+    /*! \brief The function object comparing objects of type Value. */
+    typedef EqualTo value_equal;
+    /*! \brief The type of allocator used by the container. */
+    typedef Allocator allocator_type;
+    /*! \brief The Indexable type to which Value is translated. */
+    typedef typename rtree_type::indexable_type indexable_type;
+    /*! \brief The Box type used by the R-tree. */
+    typedef typename rtree_type::bounds_type bounds_type;
+    /*! \brief Unsigned integral type used by the container. */
+    typedef typename rtree_type::size_type size_type;
+
+private:
+    // The nodes replaced by the next version of the tree.
+    struct retired_nodes
+    {
+        retired_nodes() : next(0) {}
+
+        std::vector<node_pointer> nodes;
+        retired_nodes * next;
+    };
+
+    // The nodes which can't be accessed anymore, destroyed by the writer.
+    struct garbage
+    {
+        garbage() : head(0) {}
+
+        void push(retired_nodes * r)
+        {
+            geometry::detail::parallel::scoped_lock lock(mutex);
+            r->next = head;
+            head = r;
+        }
+
+        retired_nodes * release()
+        {
+            geometry::detail::parallel::scoped_lock lock(mutex);
+            retired_nodes * result = head;
+            head = 0;
+            return result;
+        }
+
+        geometry::detail::parallel::mutex mutex;
+        retired_nodes * head;
+    };
+
+    // The published version of the tree. Each version keeps the next one alive
+    // so the nodes retired by the next version may be destroyed when
+    // there are no more references to this version.
+    struct version
+    {
+        version(members_holder const& m, garbage * g)
+            : root(m.root)
+            , leafs_level(m.leafs_level)
+            , values_count(m.values_count)
+            , retired(0)
+            , trash(g)
+        {}
+
+        ~version()
+        {
+            if ( retired )
+                trash->push(retired);
+
+            // release the chain of versions iteratively to avoid deep recursion
+            boost::shared_ptr<version> n;
+            n.swap(newer);
+            while ( n && n.unique() )
+            {
+                boost::shared_ptr<version> next;
+                next.swap(n->newer);
+                n = next;
+            }
+        }
+
+        node_pointer root;
+        size_type leafs_level;
+        size_type values_count;
+        retired_nodes * retired;
+        boost::shared_ptr<version> newer;
+        garbage * trash;
+    };
+
+public:
+    /*!
+    \brief The immutable version of the container.
+
+    The snapshot may be copied and queried from any thread. It is not affected
+    by the modifications of the container performed after it was created.
+    The snapshot must not outlive the container.
+    */
+    class snapshot
+    {
+        friend class concurrent_rtree;
+
+    public:
+        /*!
+        \brief The constructor of an empty snapshot.
+
+        \par Throws
+        Nothing.
+        */
+        snapshot()
+            : m_members(0)
+        {}
+
+        /*!
+        \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
+
+        The predicates and the results are the same as in the case of
+        <tt>boost::geometry::index::rtree::query()</tt>.
+
+        \par Throws
+        If Value copy constructor or copy assignment throws.
+        If predicates copy throws.
+
+        \param predicates   Predicates.
+        \param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+        \return             The number of values found.
+        */
+        template <typename Predicates, typename OutIter>
+        size_type query(Predicates const& predicates, OutIter out_it) const
+        {
+            if ( !m_version || !m_version->root )
+                return 0;
+
+            static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+            static const bool is_distance_predicate = 0 < distance_predicates_count;
+            BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
+
+            return query_dispatch(predicates, out_it, boost::mpl::bool_<is_distance_predicate>());
+        }
+
+        /*!
+        \brief Returns the number of stored values.
+
+        \par Throws
+        Nothing.
+        */
+        size_type size() const
+        {
+            return m_version ? m_version->values_count : 0;
+        }
+
+        /*!
+        \brief Query if the snapshot is empty.
+
+        \par Throws
+        Nothing.
+        */
+        bool empty() const
+        {
+            return 0 == size();
+        }
+
+        /*!
+        \brief Returns the box able to contain all values stored in the snapshot.
+
+        \par Throws
+        Nothing.
+        */
+        bounds_type bounds() const
+        {
+            bounds_type result;
+            geometry::assign_inverse(result);
+
+            if ( m_version && m_version->root )
+            {
+                detail::rtree::visitors::children_box
+                    <
+                        members_holder
+                    > box_v(result, m_members->parameters(), m_members->translator());
+                detail::rtree::apply_visitor(box_v, *m_version->root);
+            }
+
+            return result;
+        }
+
+    private:
+        snapshot(boost::shared_ptr<version> const& v, members_holder const& m)
+            : m_version(v)
+            , m_members(&m)
+        {}
+
+        template <typename Predicates, typename OutIter>
+        size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<false> const& /*is_distance_predicate*/) const
+        {
+            detail::rtree::visitors::spatial_query<members_holder, Predicates, OutIter>
+                find_v(m_members->parameters(), m_members->translator(), predicates, out_it);
+
+            detail::rtree::apply_visitor(find_v, *m_version->root);
+
+            return find_v.found_count;
+        }
+
+        template <typename Predicates, typename OutIter>
+        size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<true> const& /*is_distance_predicate*/) const
+        {
+            static const unsigned distance_predicate_index = detail::predicates_find_distance<Predicates>::value;
+            detail::rtree::visitors::distance_query<
+                members_holder,
+                Predicates,
+                distance_predicate_index,
+                OutIter
+            > distance_v(m_members->parameters(), m_members->translator(), predicates, out_it);
+
+            detail::rtree::apply_visitor(distance_v, *m_version->root);
+
+            return distance_v.finish();
+        }
+
+        boost::shared_ptr<version> m_version;
+        // only the parameters and the translator which are never modified are accessed
+        members_holder const* m_members;
+    };
+
+    /*!
+    \brief The constructor.
+
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    If allocator default constructor throws.
+    If allocation throws.
+    */
+    inline explicit concurrent_rtree(parameters_type const& parameters = parameters_type(),
+                                     indexable_getter const& getter = indexable_getter(),
+                                     value_equal const& equal = value_equal(),
+                                     allocator_type const& allocator = allocator_type())
+        : m_tree(parameters, getter, equal, rtree_allocator_type(allocator, &m_context))
+    {
+        publish_first();
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using packing algorithm.
+
+    \param first        The beginning of the range of Values.
+    \param last         The end of the range of Values.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    */
+    template<typename Iterator>
+    inline concurrent_rtree(Iterator first, Iterator last,
+                            parameters_type const& parameters = parameters_type(),
+                            indexable_getter const& getter = indexable_getter(),
+                            value_equal const& equal = value_equal(),
+                            allocator_type const& allocator = allocator_type())
+        : m_tree(first, last, parameters, getter, equal, rtree_allocator_type(allocator, &m_context))
+    {
+        publish_first();
+    }
+
+    /*!
+    \brief The destructor.
+
+    All snapshots must be destroyed before the container.
+
+    \par Throws
+    Nothing.
+    */
+    inline ~concurrent_rtree()
+    {
+        m_current.reset();
+        collect_garbage();
+        // the remaining nodes are destroyed by the rtree
+        m_context.disable();
+    }
+
+    /*!
+    \brief Returns the current version of the container.
+
+    This function may be called from any thread.
+
+    \par Throws
+    Nothing.
+    */
+    inline snapshot get_snapshot() const
+    {
+        return snapshot(boost::atomic_load(&m_current), members_access::get(m_tree));
+    }
+
+    /*!
+    \brief Insert a value to the index.
+
+    \param value    The value which will be stored in the container.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \par Exception-safety
+    strong
+    */
+    inline void insert(value_type const& value)
+    {
+        insert(&value, &value + 1);
+    }
+
+    /*!
+    \brief Insert a range of values to the index.
+
+    All of the values are published in one version of the tree.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \par Exception-safety
+    strong
+    */
+    template <typename Iterator>
+    inline void insert(Iterator first, Iterator last)
+    {
+        geometry::detail::parallel::scoped_lock lock(m_write_mutex);
+
+        begin_write();
+
+        BOOST_TRY
+        {
+            make_root_writable();                                                                   // MAY THROW (V, E: alloc, copy, N: alloc)
+            m_tree.insert(first, last);                                                             // MAY THROW (V, E: alloc, copy, N: alloc)
+            publish();                                                                              // MAY THROW (alloc)
+        }
+        BOOST_CATCH(...)
+        {
+            rollback();
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+    /*!
+    \brief Remove a value from the container.
+
+    \param value    The value which will be removed from the container.
+
+    \return         1 if the value was removed, 0 otherwise.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \par Exception-safety
+    strong
+    */
+    inline size_type remove(value_type const& value)
+    {
+        return remove(&value, &value + 1);
+    }
+
+    /*!
+    \brief Remove a range of values from the container.
+
+    Only one value is removed for each one passed in the range.
+    All of the values are removed in one version of the tree.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \return         The number of removed values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \par Exception-safety
+    strong
+    */
+    template <typename Iterator>
+    inline size_type remove(Iterator first, Iterator last)
+    {
+        geometry::detail::parallel::scoped_lock lock(m_write_mutex);
+
+        begin_write();
+
+        size_type result = 0;
+
+        BOOST_TRY
+        {
+            for ( ; first != last ; ++first )
+            {
+                // the nodes on the path to a value which is not stored would be copied for nothing
+                if ( m_tree.count(*first) == 0 )
+                    continue;
+
+                make_root_writable();                                                               // MAY THROW (V, E: alloc, copy, N: alloc)
+                result += m_tree.remove(*first);                                                    // MAY THROW (V, E: alloc, copy, N: alloc)
+            }
+
+            if ( result > 0 )
+                publish();                                                                          // MAY THROW (alloc)
+        }
+        BOOST_CATCH(...)
+        {
+            rollback();
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        return result;
+    }
+
+    /*!
+    \brief Reorganizes the nodes degraded by insertions and removals.
+
+    The reorganized nodes are copied so the readers of the current version are not blocked.
+    A new version is published only if some of the nodes were reorganized.
+
+    \return         The number of reorganized nodes.
+
+    \par Throws
+    \li If Value copy constructor throws.
+    \li If allocation throws or returns invalid value.
+
+    \par Exception-safety
+    strong
+    */
+    inline size_type optimize()
+    {
+        geometry::detail::parallel::scoped_lock lock(m_write_mutex);
+
+        begin_write();
+
+        size_type result = 0;
+
+        BOOST_TRY
+        {
+            // only the nodes on the paths to the reorganized ones are copied
+            result = m_tree.optimize();                                                             // MAY THROW (V, E: alloc, copy, N: alloc)
+
+            if ( result > 0 )
+                publish();                                                                          // MAY THROW (alloc)
+        }
+        BOOST_CATCH(...)
+        {
+            rollback();
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        return result;
+    }
+
+    /*!
+    \brief Removes all values stored in the container.
+
+    \par Throws
+    If allocation throws.
+
+    \par Exception-safety
+    strong
+    */
+    inline void clear()
+    {
+        geometry::detail::parallel::scoped_lock lock(m_write_mutex);
+
+        begin_write();
+
+        members_holder & members = members_access::get(m_tree);
+
+        BOOST_TRY
+        {
+            if ( members.root )
+            {
+                detail::rtree::visitors::retire_subtree
+                    <
+                        members_holder
+                    >::apply(members.root, m_context);                                              // MAY THROW (alloc)
+            }
+            m_tree.clear();
+            publish();                                                                              // MAY THROW (alloc)
+        }
+        BOOST_CATCH(...)
+        {
+            rollback();
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+    /*!
+    \brief Returns the number of stored values in the current version.
+
+    \par Throws
+    Nothing.
+    */
+    inline size_type size() const
+    {
+        return get_snapshot().size();
+    }
+
+    /*!
+    \brief Query if the current version is empty.
+
+    \par Throws
+    Nothing.
+    */
+    inline bool empty() const
+    {
+        return get_snapshot().empty();
+    }
+
+    /*!
+    \brief Returns the box able to contain all values stored in the current version.
+
+    \par Throws
+    Nothing.
+    */
+    inline bounds_type bounds() const
+    {
+        return get_snapshot().bounds();
+    }
+
+    /*!
+    \brief Finds values meeting passed predicates in the current version.
+
+    Equivalent to <tt>get_snapshot().query(predicates, out_it)</tt>.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    inline size_type query(Predicates const& predicates, OutIter out_it) const
+    {
+        return get_snapshot().query(predicates, out_it);
+    }
+
+    /*!
+    \brief Returns parameters.
+
+    \par Throws
+    Nothing.
+    */
+    inline parameters_type parameters() const
+    {
+        return m_tree.parameters();
+    }
+
+    /*!
+    \brief Returns function retrieving Indexable from Value.
+
+    \par Throws
+    Nothing.
+    */
+    inline indexable_getter indexable_get() const
+    {
+        return m_tree.indexable_get();
+    }
+
+    /*!
+    \brief Returns function comparing Values
+
+    \par Throws
+    Nothing.
+    */
+    inline value_equal value_eq() const
+    {
+        return m_tree.value_eq();
+    }
+
+private:
+    inline void publish_first()
+    {
+        BOOST_TRY
+        {
+            m_current = boost::make_shared<version>(members_access::get(m_tree), &m_garbage);        // MAY THROW (alloc)
+        }
+        BOOST_CATCH(...)
+        {
+            m_context.disable();
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        m_context.publish();
+    }
+
+    inline void begin_write()
+    {
+        collect_garbage();
+    }
+
+    inline void make_root_writable()
+    {
+        members_holder & members = members_access::get(m_tree);
+        if ( members.root )
+        {
+            detail::rtree::make_writable<members_holder>(members.root, members.allocators());       // MAY THROW (V, E: alloc, copy, N: alloc)
+        }
+    }
+
+    // Publishes the modified tree as the current version.
+    inline void publish()
+    {
+        members_holder & members = members_access::get(m_tree);
+        std::vector<void*> const& retired = m_context.retired();
+
+        boost::shared_ptr<version> next = boost::make_shared<version>(members, &m_garbage);          // MAY THROW (alloc)
+
+        retired_nodes * block = 0;
+        if ( ! retired.empty() )
+        {
+            block = new retired_nodes();                                                            // MAY THROW (alloc)
+
+            BOOST_TRY
+            {
+                block->nodes.reserve(retired.size());                                               // MAY THROW (alloc)
+            }
+            BOOST_CATCH(...)
+            {
+                delete block;
+                BOOST_RETHROW                                                                       // RETHROW
+            }
+            BOOST_CATCH_END
+
+            for ( std::size_t i = 0 ; i < retired.size() ; ++i )
+            {
+                block->nodes.push_back(boost::pointer_traits<node_pointer>::pointer_to(
+                    *static_cast<node*>(retired[i])));
+            }
+        }
+
+        m_current->retired = block;
+        m_current->newer = next;
+        boost::atomic_store(&m_current, next);
+
+        m_context.publish();
+    }
+
+    // Destroys the nodes created by the failed modification and restores the current version.
+    inline void rollback()
+    {
+        members_holder & members = members_access::get(m_tree);
+
+        // only the nodes which are not shared are destroyed
+        if ( members.root )
+        {
+            detail::rtree::visitors::destroy<members_holder>::apply(members.root, members.allocators());
+        }
+
+        members.root = m_current->root;
+        members.leafs_level = m_current->leafs_level;
+        members.values_count = m_current->values_count;
+
+        m_context.publish();
+    }
+
+    inline void collect_garbage()
+    {
+        members_holder & members = members_access::get(m_tree);
+
+        retired_nodes * r = m_garbage.release();
+        while ( r )
+        {
+            for ( std::size_t i = 0 ; i < r->nodes.size() ; ++i )
+            {
+                detail::rtree::visitors::destroy_single_node
+                    <
+                        members_holder
+                    >::apply(r->nodes[i], members.allocators());
+            }
+
+            retired_nodes * next = r->next;
+            delete r;
+            r = next;
+        }
+    }
+
+    detail::rtree::copy_on_write_context m_context;
+    rtree_type m_tree;
+    garbage m_garbage;
+    boost::shared_ptr<version> m_current;
+    geometry::detail::parallel::mutex m_write_mutex;
+};
+
+/*!
+\brief Insert a value to the index.
+
+\ingroup rtree_functions
+
+\param tree The spatial index.
+\param v    The value which will be stored in the index.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline void insert(concurrent_rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> & tree,
+                   Value const& v)
+{
+    tree.insert(v);
+}
+
+/*!
+\brief Remove a value from the container.
+
+\ingroup rtree_functions
+
+\param tree The spatial index.
+\param v    The value which will be removed from the index.
+
+\return     1 if value was removed, 0 otherwise.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline typename concurrent_rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::size_type
+remove(concurrent_rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> & tree,
+       Value const& v)
+{
+    return tree.remove(v);
+}
+
+/*!
+\brief Finds values meeting passed predicates in the current version of the container.
+
+\ingroup rtree_functions
+
+\param tree         The concurrent rtree.
+\param predicates   Predicates.
+\param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+\return             The number of values found.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+          typename Predicates, typename OutIter> inline
+typename concurrent_rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::size_type
+query(concurrent_rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
+      Predicates const& predicates,
+      OutIter out_it)
+{
+    return tree.query(predicates, out_it);
+}
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_CONCURRENT_RTREE_HPP
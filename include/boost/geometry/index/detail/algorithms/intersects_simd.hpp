@@ -0,0 +1,472 @@
+// Boost.Geometry Index
+//
+// Vectorized intersection of boxes with a query box
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_ALGORITHMS_INTERSECTS_SIMD_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_ALGORITHMS_INTERSECTS_SIMD_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+
+#include <boost/geometry/index/detail/predicates.hpp>
+
+// The vectorized code may be disabled by defining BOOST_GEOMETRY_INDEX_DISABLE_SIMD.
+// Otherwise SSE2 is used if it's available on the target and AVX if the code
+// is compiled with AVX enabled, e.g. with -mavx or -mavx2.
+#if !defined(BOOST_GEOMETRY_INDEX_DISABLE_SIMD)
+#if defined(__AVX__)
+#define BOOST_GEOMETRY_INDEX_DETAIL_SIMD_AVX
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) \
+ || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOOST_GEOMETRY_INDEX_DETAIL_SIMD_SSE2
+#endif
+#endif
+
+#if defined(BOOST_GEOMETRY_INDEX_DETAIL_SIMD_AVX)
+#include <immintrin.h>
+#elif defined(BOOST_GEOMETRY_INDEX_DETAIL_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
+namespace boost { namespace geometry { namespace index { namespace detail {
+
+namespace dispatch {
+
+// Stores the coordinates of the query Box or Point.
+template <typename Geometry,
+          typename Tag = typename geometry::tag<Geometry>::type,
+          std::size_t CurrentDimension = dimension<Geometry>::value>
+struct query_bounds
+{};
+
+template <typename Box, std::size_t CurrentDimension>
+struct query_bounds<Box, box_tag, CurrentDimension>
+{
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+
+    static inline void apply(Box const& b, coordinate_type * mins, coordinate_type * maxs)
+    {
+        query_bounds<Box, box_tag, CurrentDimension - 1>::apply(b, mins, maxs);
+
+        static const std::size_t d = CurrentDimension - 1;
+        mins[d] = geometry::get<min_corner, d>(b);
+        maxs[d] = geometry::get<max_corner, d>(b);
+    }
+};
+
+template <typename Point, std::size_t CurrentDimension>
+struct query_bounds<Point, point_tag, CurrentDimension>
+{
+    typedef typename geometry::coordinate_type<Point>::type coordinate_type;
+
+    static inline void apply(Point const& p, coordinate_type * mins, coordinate_type * maxs)
+    {
+        query_bounds<Point, point_tag, CurrentDimension - 1>::apply(p, mins, maxs);
+
+        static const std::size_t d = CurrentDimension - 1;
+        mins[d] = geometry::get<d>(p);
+        maxs[d] = mins[d];
+    }
+};
+
+template <typename Box>
+struct query_bounds<Box, box_tag, 0>
+{
+    template <typename Coordinate>
+    static inline void apply(Box const& , Coordinate * , Coordinate * ) {}
+};
+
+template <typename Point>
+struct query_bounds<Point, point_tag, 0>
+{
+    template <typename Coordinate>
+    static inline void apply(Point const& , Coordinate * , Coordinate * ) {}
+};
+
+} // namespace dispatch
+
+// Checks if the nodes are checked against the predicates with the intersection
+// of their boxes and a cartesian Box or Point which can be done directly on the
+// coordinates.
+template <typename Predicates, typename Box>
+struct box_intersects_predicate
+    : boost::mpl::false_
+{};
+
+template <typename Geometry, typename Tag, typename Box>
+struct box_intersects_predicate<predicates::spatial_predicate<Geometry, Tag, false>, Box>
+    : boost::mpl::and_
+        <
+            boost::mpl::or_
+                <
+                    boost::is_same<typename geometry::tag<Geometry>::type, box_tag>,
+                    boost::is_same<typename geometry::tag<Geometry>::type, point_tag>
+                >,
+            // for nodes these predicates are checked differently
+            boost::mpl::not_
+                <
+                    boost::mpl::or_
+                        <
+                            boost::is_same<Tag, predicates::contains_tag>,
+                            boost::is_same<Tag, predicates::covers_tag>,
+                            boost::is_same<Tag, predicates::disjoint_tag>
+                        >
+                >,
+            boost::mpl::and_
+                <
+                    boost::is_same<typename cs_tag<Geometry>::type, cartesian_tag>,
+                    boost::is_same<typename cs_tag<Box>::type, cartesian_tag>
+                >,
+            boost::is_same
+                <
+                    typename geometry::coordinate_type<Geometry>::type,
+                    typename geometry::coordinate_type<Box>::type
+                >,
+            boost::mpl::bool_<dimension<Geometry>::value == dimension<Box>::value>
+        >
+{
+    template <typename Coordinate>
+    static inline void bounds(predicates::spatial_predicate<Geometry, Tag, false> const& p,
+                              Coordinate * mins, Coordinate * maxs)
+    {
+        dispatch::query_bounds<Geometry>::apply(p.geometry, mins, maxs);
+    }
+};
+
+// Checks if the values are checked against the predicates with the intersection
+// of their cartesian Box or Point Indexables and a cartesian Box or Point.
+// Two Points are compared WRT epsilon by intersects() so this case is excluded.
+template <typename Predicates, typename Indexable>
+struct value_intersects_predicate
+    : boost::mpl::false_
+{};
+
+template <typename Geometry, typename Indexable>
+struct value_intersects_predicate
+    <
+        predicates::spatial_predicate<Geometry, predicates::intersects_tag, false>,
+        Indexable
+    >
+    : boost::mpl::and_
+        <
+            box_intersects_predicate
+                <
+                    predicates::spatial_predicate<Geometry, predicates::intersects_tag, false>,
+                    Indexable
+                >,
+            boost::mpl::or_
+                <
+                    boost::is_same<typename geometry::tag<Indexable>::type, box_tag>,
+                    boost::mpl::and_
+                        <
+                            boost::is_same<typename geometry::tag<Indexable>::type, point_tag>,
+                            boost::is_same<typename geometry::tag<Geometry>::type, box_tag>
+                        >
+                >
+        >
+{
+    template <typename Coordinate>
+    static inline void bounds(predicates::spatial_predicate<Geometry, predicates::intersects_tag, false> const& p,
+                              Coordinate * mins, Coordinate * maxs)
+    {
+        dispatch::query_bounds<Geometry>::apply(p.geometry, mins, maxs);
+    }
+};
+
+namespace simd {
+
+template <typename T>
+struct is_coordinate : boost::mpl::false_ {};
+
+template <>
+struct is_coordinate<float> : boost::mpl::true_ {};
+
+template <>
+struct is_coordinate<double> : boost::mpl::true_ {};
+
+// Checks if the float or double coordinates of a Geometry can be accessed as
+// an array. The coordinates of the max corner of a box are stored directly
+// after the coordinates of the min corner.
+template <typename Geometry>
+struct contiguous_coordinates
+    : boost::mpl::false_
+{};
+
+#if !defined(BOOST_GEOMETRY_ENABLE_ACCESS_DEBUGGING)
+
+template <typename T, std::size_t Dimension, typename CoordinateSystem>
+struct contiguous_coordinates< model::point<T, Dimension, CoordinateSystem> >
+    : boost::mpl::bool_
+        <
+            is_coordinate<T>::value
+         && sizeof(model::point<T, Dimension, CoordinateSystem>) == Dimension * sizeof(T)
+        >
+{
+    static inline T const* apply(model::point<T, Dimension, CoordinateSystem> const& p)
+    {
+        return &p.template get<0>();
+    }
+};
+
+template <typename T, std::size_t Dimension, typename CoordinateSystem>
+struct contiguous_coordinates< model::box< model::point<T, Dimension, CoordinateSystem> > >
+    : boost::mpl::bool_
+        <
+            contiguous_coordinates< model::point<T, Dimension, CoordinateSystem> >::value
+         && sizeof(model::box< model::point<T, Dimension, CoordinateSystem> >)
+                == 2 * Dimension * sizeof(T)
+        >
+{
+    static inline T const* apply(model::box< model::point<T, Dimension, CoordinateSystem> > const& b)
+    {
+        return &b.min_corner().template get<0>();
+    }
+};
+
+#endif // BOOST_GEOMETRY_ENABLE_ACCESS_DEBUGGING
+
+// Checks if a[i] <= b[i] for all i in [0, Count).
+// The Count is known at compile time so the loops are unrolled.
+template <std::size_t Count>
+inline int less_equal(double const* a, double const* b)
+{
+    std::size_t i = 0;
+    int result = 1;
+#if defined(BOOST_GEOMETRY_INDEX_DETAIL_SIMD_AVX)
+    for ( ; i + 4 <= Count ; i += 4 )
+    {
+        __m256d const m = _mm256_cmp_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), _CMP_LE_OQ);
+        result &= _mm256_movemask_pd(m) == 0xF;
+    }
+#endif
+#if defined(BOOST_GEOMETRY_INDEX_DETAIL_SIMD_SSE2)
+    for ( ; i + 2 <= Count ; i += 2 )
+    {
+        __m128d const m = _mm_cmple_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i));
+        result &= _mm_movemask_pd(m) == 0x3;
+    }
+#endif
+    for ( ; i < Count ; ++i )
+    {
+        result &= a[i] <= b[i];
+    }
+    return result;
+}
+
+template <std::size_t Count>
+inline int less_equal(float const* a, float const* b)
+{
+    std::size_t i = 0;
+    int result = 1;
+#if defined(BOOST_GEOMETRY_INDEX_DETAIL_SIMD_AVX)
+    for ( ; i + 8 <= Count ; i += 8 )
+    {
+        __m256 const m = _mm256_cmp_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _CMP_LE_OQ);
+        result &= _mm256_movemask_ps(m) == 0xFF;
+    }
+#endif
+#if defined(BOOST_GEOMETRY_INDEX_DETAIL_SIMD_SSE2)
+    for ( ; i + 4 <= Count ; i += 4 )
+    {
+        __m128 const m = _mm_cmple_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+        result &= _mm_movemask_ps(m) == 0xF;
+    }
+    for ( ; i + 2 <= Count ; i += 2 )
+    {
+        // the lower half of the registers, e.g. 2 coordinates of a 2d point
+        __m128 const x = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const*>(a + i));
+        __m128 const y = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const*>(b + i));
+        result &= (_mm_movemask_ps(_mm_cmple_ps(x, y)) & 0x3) == 0x3;
+    }
+#endif
+    for ( ; i < Count ; ++i )
+    {
+        result &= a[i] <= b[i];
+    }
+    return result;
+}
+
+// Tests Boxes or Points with contiguous coordinates against a query Box or Point.
+// The box intersects the query box if min <= qmax and qmin <= max in all dimensions.
+template <typename Geometry,
+          typename Tag = typename geometry::tag<Geometry>::type>
+class intersects_filter
+{
+    typedef contiguous_coordinates<Geometry> coordinates;
+    typedef typename geometry::coordinate_type<Geometry>::type coordinate_type;
+    static const std::size_t dimension = geometry::dimension<Geometry>::value;
+
+public:
+    template <typename Predicate>
+    inline void init(Predicate const& pred)
+    {
+        box_intersects_predicate<Predicate, Geometry>::bounds(pred, m_min, m_max);
+    }
+
+    inline bool operator()(Geometry const& b) const
+    {
+        coordinate_type const* const c = coordinates::apply(b);
+        return ( simd::less_equal<dimension>(c, m_max)
+               & simd::less_equal<dimension>(m_min, c + dimension) ) != 0;
+    }
+
+private:
+    coordinate_type m_min[dimension];
+    coordinate_type m_max[dimension];
+};
+
+template <typename Point>
+class intersects_filter<Point, point_tag>
+{
+    typedef contiguous_coordinates<Point> coordinates;
+    typedef typename geometry::coordinate_type<Point>::type coordinate_type;
+    static const std::size_t dimension = geometry::dimension<Point>::value;
+
+public:
+    template <typename Predicate>
+    inline void init(Predicate const& pred)
+    {
+        box_intersects_predicate<Predicate, Point>::bounds(pred, m_min, m_max);
+    }
+
+    inline bool operator()(Point const& p) const
+    {
+        coordinate_type const* const c = coordinates::apply(p);
+        return ( simd::less_equal<dimension>(m_min, c)
+               & simd::less_equal<dimension>(c, m_max) ) != 0;
+    }
+
+private:
+    coordinate_type m_min[dimension];
+    coordinate_type m_max[dimension];
+};
+
+// Tests up to 64 boxes stored as arrays of coordinates mins[d][i] and maxs[d][i]
+// against a query box. The i-th bit of the result is set if the i-th box
+// intersects the query box.
+template <std::size_t Dimension>
+inline boost::uint64_t intersects_mask(double const* const* mins, double const* const* maxs,
+                                       std::size_t count,
+                                       double const* qmin, double const* qmax)
+{
+    boost::uint64_t result = 0;
+    std::size_t i = 0;
+#if defined(BOOST_GEOMETRY_INDEX_DETAIL_SIMD_AVX)
+    for ( ; i + 4 <= count ; i += 4 )
+    {
+        __m256d m = _mm256_cmp_pd(_mm256_loadu_pd(mins[0] + i), _mm256_set1_pd(qmax[0]), _CMP_LE_OQ);
+        m = _mm256_and_pd(m, _mm256_cmp_pd(_mm256_set1_pd(qmin[0]), _mm256_loadu_pd(maxs[0] + i), _CMP_LE_OQ));
+        for ( std::size_t d = 1 ; d < Dimension ; ++d )
+        {
+            m = _mm256_and_pd(m, _mm256_cmp_pd(_mm256_loadu_pd(mins[d] + i), _mm256_set1_pd(qmax[d]), _CMP_LE_OQ));
+            m = _mm256_and_pd(m, _mm256_cmp_pd(_mm256_set1_pd(qmin[d]), _mm256_loadu_pd(maxs[d] + i), _CMP_LE_OQ));
+        }
+        result |= boost::uint64_t(_mm256_movemask_pd(m)) << i;
+    }
+#endif
+#if defined(BOOST_GEOMETRY_INDEX_DETAIL_SIMD_SSE2)
+    for ( ; i + 2 <= count ; i += 2 )
+    {
+        __m128d m = _mm_cmple_pd(_mm_loadu_pd(mins[0] + i), _mm_set1_pd(qmax[0]));
+        m = _mm_and_pd(m, _mm_cmple_pd(_mm_set1_pd(qmin[0]), _mm_loadu_pd(maxs[0] + i)));
+        for ( std::size_t d = 1 ; d < Dimension ; ++d )
+        {
+            m = _mm_and_pd(m, _mm_cmple_pd(_mm_loadu_pd(mins[d] + i), _mm_set1_pd(qmax[d])));
+            m = _mm_and_pd(m, _mm_cmple_pd(_mm_set1_pd(qmin[d]), _mm_loadu_pd(maxs[d] + i)));
+        }
+        result |= boost::uint64_t(_mm_movemask_pd(m)) << i;
+    }
+#endif
+    for ( ; i < count ; ++i )
+    {
+        int r = 1;
+        for ( std::size_t d = 0 ; d < Dimension ; ++d )
+            r &= (mins[d][i] <= qmax[d]) & (qmin[d] <= maxs[d][i]);
+        result |= boost::uint64_t(r) << i;
+    }
+    return result;
+}
+
+template <std::size_t Dimension>
+inline boost::uint64_t intersects_mask(float const* const* mins, float const* const* maxs,
+                                       std::size_t count,
+                                       float const* qmin, float const* qmax)
+{
+    boost::uint64_t result = 0;
+    std::size_t i = 0;
+#if defined(BOOST_GEOMETRY_INDEX_DETAIL_SIMD_AVX)
+    for ( ; i + 8 <= count ; i += 8 )
+    {
+        __m256 m = _mm256_cmp_ps(_mm256_loadu_ps(mins[0] + i), _mm256_set1_ps(qmax[0]), _CMP_LE_OQ);
+        m = _mm256_and_ps(m, _mm256_cmp_ps(_mm256_set1_ps(qmin[0]), _mm256_loadu_ps(maxs[0] + i), _CMP_LE_OQ));
+        for ( std::size_t d = 1 ; d < Dimension ; ++d )
+        {
+            m = _mm256_and_ps(m, _mm256_cmp_ps(_mm256_loadu_ps(mins[d] + i), _mm256_set1_ps(qmax[d]), _CMP_LE_OQ));
+            m = _mm256_and_ps(m, _mm256_cmp_ps(_mm256_set1_ps(qmin[d]), _mm256_loadu_ps(maxs[d] + i), _CMP_LE_OQ));
+        }
+        result |= boost::uint64_t(_mm256_movemask_ps(m)) << i;
+    }
+#endif
+#if defined(BOOST_GEOMETRY_INDEX_DETAIL_SIMD_SSE2)
+    for ( ; i + 4 <= count ; i += 4 )
+    {
+        __m128 m = _mm_cmple_ps(_mm_loadu_ps(mins[0] + i), _mm_set1_ps(qmax[0]));
+        m = _mm_and_ps(m, _mm_cmple_ps(_mm_set1_ps(qmin[0]), _mm_loadu_ps(maxs[0] + i)));
+        for ( std::size_t d = 1 ; d < Dimension ; ++d )
+        {
+            m = _mm_and_ps(m, _mm_cmple_ps(_mm_loadu_ps(mins[d] + i), _mm_set1_ps(qmax[d])));
+            m = _mm_and_ps(m, _mm_cmple_ps(_mm_set1_ps(qmin[d]), _mm_loadu_ps(maxs[d] + i)));
+        }
+        result |= boost::uint64_t(_mm_movemask_ps(m)) << i;
+    }
+#endif
+    for ( ; i < count ; ++i )
+    {
+        int r = 1;
+        for ( std::size_t d = 0 ; d < Dimension ; ++d )
+            r &= (mins[d][i] <= qmax[d]) & (qmin[d] <= maxs[d][i]);
+        result |= boost::uint64_t(r) << i;
+    }
+    return result;
+}
+
+// Returns the index of the lowest set bit, the mask can't be 0.
+inline std::size_t lowest_bit(boost::uint64_t mask)
+{
+#if defined(__GNUC__)
+    return static_cast<std::size_t>(__builtin_ctzll(mask));
+#else
+    std::size_t i = 0;
+    for ( ; (mask & 1) == 0 ; mask >>= 1 )
+        ++i;
+    return i;
+#endif
+}
+
+} // namespace simd
+
+}}}} // namespace boost::geometry::index::detail
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_ALGORITHMS_INTERSECTS_SIMD_HPP
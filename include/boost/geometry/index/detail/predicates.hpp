@@ -76,6 +76,11 @@ struct spatial_predicate
     Geometry geometry;
 };
 
+// The spatial relation of the Indexables of Values stored in two rtrees
+// tested by the spatial join.
+template <typename Tag>
+struct join_predicate {};
+
 // ------------------------------------------------------------------ //
 
 // CONSIDER: separated nearest<> and path<> may be replaced by
@@ -0,0 +1,57 @@
+// Boost.Geometry Index
+//
+// Output of the values found by queries
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_QUERY_OUTPUT_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_QUERY_OUTPUT_HPP
+
+#include <boost/mpl/bool.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail {
+
+template <typename Function>
+struct query_callback
+{
+    query_callback(Function const& f) : function(f) {}
+    Function function;
+};
+
+// Writes a Value found by a query to the output iterator.
+// Returns false if the query should be stopped.
+template <typename OutIter>
+struct query_output
+{
+    typedef boost::mpl::false_ is_stoppable;
+
+    template <typename Value>
+    static inline bool apply(OutIter & out_it, Value const& v)
+    {
+        *out_it = v;
+        ++out_it;
+        return true;
+    }
+};
+
+// Passes a Value found by a query to the callback.
+// The query is stopped if the callback returns false.
+template <typename Function>
+struct query_output< query_callback<Function> >
+{
+    typedef boost::mpl::true_ is_stoppable;
+
+    template <typename Value>
+    static inline bool apply(query_callback<Function> & callback, Value const& v)
+    {
+        return callback.function(v) ? true : false;
+    }
+};
+
+}}}} // namespace boost::geometry::index::detail
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_QUERY_OUTPUT_HPP
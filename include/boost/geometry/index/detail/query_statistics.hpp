@@ -0,0 +1,71 @@
+// Boost.Geometry Index
+//
+// Gathering of the query statistics
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_QUERY_STATISTICS_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_QUERY_STATISTICS_HPP
+
+#include <cstddef>
+
+#include <boost/geometry/index/query_statistics.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail {
+
+// Used by default by the query visitors. The calls are optimized out.
+struct no_query_statistics
+{
+    inline void internal_node() {}
+    inline void leaf() {}
+    inline void box() {}
+    inline void value() {}
+    inline void found(std::size_t /*count*/ = 1) {}
+    inline void heap_push() {}
+    inline void heap_pop(std::size_t /*count*/ = 1) {}
+};
+
+// Increases the counters of the query_statistics passed by the user.
+// The current size of the heap is stored here in order to calculate the maximum.
+class query_statistics_counter
+{
+public:
+    inline query_statistics_counter()
+        : m_stats(NULL), m_heap_size(0)
+    {}
+
+    inline explicit query_statistics_counter(index::query_statistics & stats)
+        : m_stats(&stats), m_heap_size(0)
+    {}
+
+    inline void internal_node() { ++m_stats->internal_nodes; }
+    inline void leaf() { ++m_stats->leaves; }
+    inline void box() { ++m_stats->boxes; }
+    inline void value() { ++m_stats->values; }
+    inline void found(std::size_t count = 1) { m_stats->found += count; }
+
+    inline void heap_push()
+    {
+        ++m_stats->heap_pushes;
+        ++m_heap_size;
+        if ( m_stats->heap_max < m_heap_size )
+            m_stats->heap_max = m_heap_size;
+    }
+
+    inline void heap_pop(std::size_t count = 1)
+    {
+        m_heap_size -= count;
+    }
+
+private:
+    index::query_statistics * m_stats;
+    std::size_t m_heap_size;
+};
+
+}}}} // namespace boost::geometry::index::detail
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_QUERY_STATISTICS_HPP
@@ -0,0 +1,94 @@
+// Boost.Geometry Index
+//
+// R-tree flat, pointer-free layout children boxes intersection
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_INTERSECTS_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_INTERSECTS_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/bool.hpp>
+
+#include <boost/geometry/index/detail/algorithms/intersects_simd.hpp>
+#include <boost/geometry/index/detail/rtree/flat/layout.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree { namespace flat {
+
+// Checks if the box of a node intersects the query box. The coordinates
+// are read from the arrays of coordinates without creating the Box.
+template <typename Value, typename Box>
+inline bool node_intersects(storage<Value, Box> const& s, boost::uint64_t node,
+                            typename storage<Value, Box>::coordinate_type const* mins,
+                            typename storage<Value, Box>::coordinate_type const* maxs)
+{
+    for ( std::size_t d = 0 ; d < storage<Value, Box>::dimension ; ++d )
+    {
+        if ( maxs[d] < s.min_coordinates(d)[node]
+          || s.max_coordinates(d)[node] < mins[d] )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Checks which of the count <= 64 nodes starting at first intersect the query box.
+// The i-th bit of the result is set if the node first + i intersects it.
+template <typename Value, typename Box>
+inline boost::uint64_t nodes_intersect(storage<Value, Box> const& s,
+                                       boost::uint64_t first, std::size_t count,
+                                       typename storage<Value, Box>::coordinate_type const* mins,
+                                       typename storage<Value, Box>::coordinate_type const* maxs,
+                                       boost::mpl::true_ const& /*simd*/)
+{
+    typedef typename storage<Value, Box>::coordinate_type coordinate_type;
+    static const std::size_t dimension = storage<Value, Box>::dimension;
+
+    coordinate_type const* box_mins[dimension];
+    coordinate_type const* box_maxs[dimension];
+    for ( std::size_t d = 0 ; d < dimension ; ++d )
+    {
+        box_mins[d] = s.min_coordinates(d) + first;
+        box_maxs[d] = s.max_coordinates(d) + first;
+    }
+
+    return simd::intersects_mask<dimension>(box_mins, box_maxs, count, mins, maxs);
+}
+
+template <typename Value, typename Box>
+inline boost::uint64_t nodes_intersect(storage<Value, Box> const& s,
+                                       boost::uint64_t first, std::size_t count,
+                                       typename storage<Value, Box>::coordinate_type const* mins,
+                                       typename storage<Value, Box>::coordinate_type const* maxs,
+                                       boost::mpl::false_ const& /*simd*/)
+{
+    boost::uint64_t result = 0;
+    for ( std::size_t i = 0 ; i < count ; ++i )
+    {
+        if ( node_intersects(s, first + i, mins, maxs) )
+            result |= boost::uint64_t(1) << i;
+    }
+    return result;
+}
+
+template <typename Value, typename Box>
+inline boost::uint64_t nodes_intersect(storage<Value, Box> const& s,
+                                       boost::uint64_t first, std::size_t count,
+                                       typename storage<Value, Box>::coordinate_type const* mins,
+                                       typename storage<Value, Box>::coordinate_type const* maxs)
+{
+    typedef typename storage<Value, Box>::coordinate_type coordinate_type;
+    return nodes_intersect(s, first, count, mins, maxs,
+                           boost::mpl::bool_<simd::is_coordinate<coordinate_type>::value>());
+}
+
+}}}}}} // namespace boost::geometry::index::detail::rtree::flat
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_INTERSECTS_HPP
@@ -0,0 +1,362 @@
+// Boost.Geometry Index
+//
+// R-tree flat, pointer-free layout
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_LAYOUT_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_LAYOUT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+
+#include <boost/geometry/index/detail/assert.hpp>
+#include <boost/geometry/index/detail/exception.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree { namespace flat {
+
+// The layout of the data:
+//
+// header
+// nodes   - node_entry[nodes_count]
+// boxes   - coordinates of bounding boxes of nodes stored as structure of
+//           arrays, for each dimension: min[nodes_count], max[nodes_count]
+// values  - Value[values_count]
+//
+// Each section and each array of coordinates starts at an offset aligned to
+// section_alignment. The root is stored first. The children of a node are
+// stored contiguously so a node refers to them with the index of the first
+// child and their number. For internal nodes these are indexes of nodes,
+// for leafs indexes of values. The values are stored in the order of leafs.
+//
+// The nodes are stored in level order (BFS) or in van Emde Boas order where
+// the tree is recursively split into the top half of levels and bottom
+// subtrees, each stored contiguously.
+
+static const std::size_t section_alignment = 64;
+
+enum node_order
+{
+    level_node_order = 0,
+    van_emde_boas_node_order = 1
+};
+
+struct header
+{
+    char magic[8];
+    boost::uint32_t version;
+    boost::uint32_t byte_order;
+    boost::uint32_t value_size;
+    boost::uint32_t coordinate_size;
+    boost::uint32_t dimension;
+    boost::uint32_t order;
+    boost::uint64_t values_count;
+    boost::uint64_t nodes_count;
+    boost::uint64_t leafs_level;
+    boost::uint64_t nodes_offset;
+    boost::uint64_t boxes_offset;
+    boost::uint64_t coordinates_stride;
+    boost::uint64_t values_offset;
+    boost::uint64_t size;
+};
+
+struct node_entry
+{
+    static const boost::uint32_t leaf_flag = 1;
+
+    boost::uint64_t first;
+    boost::uint32_t count;
+    boost::uint32_t flags;
+};
+
+static const boost::uint32_t current_version = 1;
+static const boost::uint32_t byte_order_mark = 0x01020304;
+
+inline char const* magic()
+{
+    return "BGIRTREE";
+}
+
+inline boost::uint64_t aligned(boost::uint64_t offset)
+{
+    return (offset + section_alignment - 1) / section_alignment * section_alignment;
+}
+
+// Fills the sizes and offsets of the sections.
+template <typename Value, typename Box>
+inline header make_header(boost::uint64_t values_count,
+                          boost::uint64_t nodes_count,
+                          boost::uint64_t leafs_level,
+                          boost::uint32_t order)
+{
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+
+    header h;
+    std::memset(&h, 0, sizeof(header));
+    std::memcpy(h.magic, magic(), sizeof(h.magic));
+    h.version = current_version;
+    h.byte_order = byte_order_mark;
+    h.value_size = sizeof(Value);
+    h.coordinate_size = sizeof(coordinate_type);
+    h.dimension = dimension;
+    h.order = order;
+    h.values_count = values_count;
+    h.nodes_count = nodes_count;
+    h.leafs_level = leafs_level;
+    h.nodes_offset = aligned(sizeof(header));
+    h.boxes_offset = aligned(h.nodes_offset + nodes_count * sizeof(node_entry));
+    h.coordinates_stride = aligned(nodes_count * sizeof(coordinate_type));
+    h.values_offset = aligned(h.boxes_offset + 2 * dimension * h.coordinates_stride);
+    h.size = h.values_offset + values_count * sizeof(Value);
+    return h;
+}
+
+// Checks if the nodes reachable from the root refer to existing nodes and values,
+// if each node is referred only once and if all leafs are on the leafs level.
+inline bool are_nodes_valid(node_entry const* nodes,
+                            boost::uint64_t nodes_count,
+                            boost::uint64_t values_count,
+                            boost::uint64_t leafs_level)
+{
+    if ( nodes_count == 0 )
+        return leafs_level == 0;
+    // each internal node has at least one child
+    if ( leafs_level >= nodes_count )
+        return false;
+
+    std::vector<bool> visited(static_cast<std::size_t>(nodes_count), false);
+    std::vector<std::pair<boost::uint64_t, boost::uint64_t> > stack;
+    stack.push_back(std::make_pair(boost::uint64_t(0), boost::uint64_t(0)));
+    visited[0] = true;
+
+    while ( !stack.empty() )
+    {
+        boost::uint64_t const node = stack.back().first;
+        boost::uint64_t const level = stack.back().second;
+        stack.pop_back();
+
+        node_entry const& n = nodes[node];
+        if ( (n.flags & node_entry::leaf_flag) != 0 )
+        {
+            if ( level != leafs_level
+              || n.first > values_count || n.count > values_count - n.first )
+                return false;
+            continue;
+        }
+
+        if ( level >= leafs_level
+          || n.first > nodes_count || n.count > nodes_count - n.first )
+            return false;
+
+        for ( boost::uint64_t i = n.first ; i < n.first + n.count ; ++i )
+        {
+            if ( visited[static_cast<std::size_t>(i)] )
+                return false;
+            visited[static_cast<std::size_t>(i)] = true;
+            stack.push_back(std::make_pair(i, level + 1));
+        }
+    }
+
+    return true;
+}
+
+namespace dispatch {
+
+template <typename Box,
+          std::size_t CurrentDimension = dimension<Box>::value>
+struct assign_box
+{
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+
+    static inline void apply(Box & b, coordinate_type const* const* mins,
+                             coordinate_type const* const* maxs, std::size_t i)
+    {
+        assign_box<Box, CurrentDimension - 1>::apply(b, mins, maxs, i);
+
+        static const std::size_t d = CurrentDimension - 1;
+        geometry::set<min_corner, d>(b, mins[d][i]);
+        geometry::set<max_corner, d>(b, maxs[d][i]);
+    }
+};
+
+template <typename Box>
+struct assign_box<Box, 0>
+{
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+
+    static inline void apply(Box & , coordinate_type const* const* ,
+                             coordinate_type const* const* , std::size_t )
+    {}
+};
+
+// Returns the coordinate of a corner of a box in the dimension known at run-time.
+template <typename Box, std::size_t Corner,
+          std::size_t Dimension = 0,
+          std::size_t DimensionCount = dimension<Box>::value>
+struct get_box_coordinate
+{
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+
+    static inline coordinate_type apply(Box const& b, std::size_t d)
+    {
+        return d == Dimension
+             ? geometry::get<Corner, Dimension>(b)
+             : get_box_coordinate<Box, Corner, Dimension + 1, DimensionCount>::apply(b, d);
+    }
+};
+
+template <typename Box, std::size_t Corner, std::size_t DimensionCount>
+struct get_box_coordinate<Box, Corner, DimensionCount, DimensionCount>
+{
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+
+    static inline coordinate_type apply(Box const& , std::size_t )
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(false, "invalid dimension");
+        return coordinate_type();
+    }
+};
+
+} // namespace dispatch
+
+// Read-only access to the data stored in the flat layout.
+template <typename Value, typename Box>
+class storage
+{
+    BOOST_STATIC_ASSERT(boost::alignment_of<Value>::value <= section_alignment);
+
+public:
+    typedef boost::uint64_t size_type;
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+
+    BOOST_STATIC_ASSERT(boost::alignment_of<coordinate_type>::value <= section_alignment);
+
+    storage()
+        : m_header(0), m_nodes(0), m_values(0)
+    {
+        std::fill(m_mins, m_mins + dimension, static_cast<coordinate_type const*>(0));
+        std::fill(m_maxs, m_maxs + dimension, static_cast<coordinate_type const*>(0));
+    }
+
+    // Checks the header of the data and throws std::invalid_argument if it's not valid.
+    // The nodes aren't checked, see are_nodes_valid().
+    storage(void const* data, std::size_t size)
+        : m_header(0), m_nodes(0), m_values(0)
+    {
+        char const* bytes = static_cast<char const*>(data);
+
+        if ( size < sizeof(header) || bytes == 0 )
+            throw_invalid_argument("the data is too small to contain rtree");
+
+        // the offsets of sections are aligned so only the alignment
+        // of the beginning of the data has to be checked
+        if ( reinterpret_cast<std::size_t>(bytes) % required_alignment() != 0 )
+            throw_invalid_argument("the rtree data is not properly aligned");
+
+        header const* h = reinterpret_cast<header const*>(bytes);
+
+        if ( std::memcmp(h->magic, magic(), sizeof(h->magic)) != 0
+          || h->version != current_version )
+            throw_invalid_argument("the data doesn't contain rtree of supported format");
+
+        if ( h->byte_order != byte_order_mark
+          || h->value_size != sizeof(Value)
+          || h->coordinate_size != sizeof(coordinate_type)
+          || h->dimension != dimension )
+            throw_invalid_argument("the rtree data is incompatible with the types");
+
+        header const expected = make_header<Value, Box>(h->values_count, h->nodes_count,
+                                                        h->leafs_level, h->order);
+        if ( h->nodes_offset != expected.nodes_offset
+          || h->boxes_offset != expected.boxes_offset
+          || h->coordinates_stride != expected.coordinates_stride
+          || h->values_offset != expected.values_offset
+          || h->size != expected.size
+          || h->size > size
+          // the sizes of sections may overflow in make_header()
+          || h->nodes_count > size / sizeof(node_entry)
+          || h->values_count > size / sizeof(Value)
+          || (h->nodes_count == 0) != (h->values_count == 0) )
+            throw_invalid_argument("the rtree data is corrupted");
+
+        m_header = h;
+        m_nodes = reinterpret_cast<node_entry const*>(bytes + h->nodes_offset);
+        for ( std::size_t d = 0 ; d < dimension ; ++d )
+        {
+            char const* coords = bytes + h->boxes_offset + 2 * d * h->coordinates_stride;
+            m_mins[d] = reinterpret_cast<coordinate_type const*>(coords);
+            m_maxs[d] = reinterpret_cast<coordinate_type const*>(coords + h->coordinates_stride);
+        }
+        m_values = reinterpret_cast<Value const*>(bytes + h->values_offset);
+    }
+
+    // The alignment of the data required by the types stored.
+    static std::size_t required_alignment()
+    {
+        std::size_t result = boost::alignment_of<boost::uint64_t>::value;
+        if ( result < boost::alignment_of<Value>::value )
+            result = boost::alignment_of<Value>::value;
+        if ( result < boost::alignment_of<coordinate_type>::value )
+            result = boost::alignment_of<coordinate_type>::value;
+        return result;
+    }
+
+    size_type values_count() const { return m_header ? m_header->values_count : 0; }
+    size_type nodes_count() const { return m_header ? m_header->nodes_count : 0; }
+    size_type leafs_level() const { return m_header ? m_header->leafs_level : 0; }
+
+    // Checks all nodes, the complexity is linear in the number of nodes.
+    bool are_nodes_valid() const
+    {
+        return m_header == 0
+            || flat::are_nodes_valid(m_nodes, m_header->nodes_count,
+                                     m_header->values_count, m_header->leafs_level);
+    }
+
+    bool is_leaf(size_type node) const { return (m_nodes[node].flags & node_entry::leaf_flag) != 0; }
+
+    node_entry const& node(size_type node) const { return m_nodes[node]; }
+    Value const& value(size_type value) const { return m_values[value]; }
+
+    Box box(size_type node) const
+    {
+        Box result;
+        dispatch::assign_box<Box>::apply(result, m_mins, m_maxs, static_cast<std::size_t>(node));
+        return result;
+    }
+
+    // The arrays of coordinates of boxes of all nodes.
+    coordinate_type const* min_coordinates(std::size_t d) const { return m_mins[d]; }
+    coordinate_type const* max_coordinates(std::size_t d) const { return m_maxs[d]; }
+
+    Value const* values() const { return m_values; }
+
+private:
+    header const* m_header;
+    node_entry const* m_nodes;
+    coordinate_type const* m_mins[dimension];
+    coordinate_type const* m_maxs[dimension];
+    Value const* m_values;
+};
+
+}}}}}} // namespace boost::geometry::index::detail::rtree::flat
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_LAYOUT_HPP
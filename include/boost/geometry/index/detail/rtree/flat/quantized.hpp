@@ -0,0 +1,453 @@
+// Boost.Geometry Index
+//
+// R-tree flat, pointer-free layout with quantized boxes
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_QUANTIZED_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_QUANTIZED_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/rtree/flat/layout.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree { namespace flat {
+
+// The layout of the data:
+//
+// header
+// root     - coordinates of the box of the root: min[dimension], max[dimension]
+// nodes    - node_entry[nodes_count]
+// boxes    - quantized boxes of nodes: q[nodes_count][2 * dimension]
+// values   - quantized boxes of values: q[values_count][2 * dimension]
+// ids      - Id[values_count]
+//
+// The structure of the tree is the same as in the flat layout. The box of
+// each node and of each value is stored as integral coordinates of the grid
+// dividing the box of its parent into 2^Bits - 1 parts in each dimension,
+// min coordinates followed by max coordinates. The coordinates are rounded
+// outward so the decoded box always contains the original one. The parent
+// box used is the decoded one so the nested boxes can be decoded top-down.
+// The box of the root isn't quantized.
+// The leafs store the ids of values instead of the values.
+
+template <unsigned Bits>
+struct quantized_coordinate
+{
+    BOOST_STATIC_ASSERT(Bits == 8 || Bits == 16);
+
+    typedef typename boost::mpl::if_c
+        <
+            Bits == 8, boost::uint8_t, boost::uint16_t
+        >::type type;
+
+    static const type max_value = static_cast<type>((1u << Bits) - 1);
+};
+
+// Conversion of the coordinates of a box to the coordinates of the grid
+// of its parent and back. The same calculation has to be used in both
+// directions, otherwise the rounding could be different.
+template <typename T, unsigned Bits>
+class quantization
+{
+    BOOST_STATIC_ASSERT(boost::is_floating_point<T>::value);
+
+public:
+    typedef typename quantized_coordinate<Bits>::type quantized_type;
+    static const quantized_type max_value = quantized_coordinate<Bits>::max_value;
+
+    quantization()
+        : m_min(0), m_max(0), m_scale(0)
+    {}
+
+    quantization(T const& min, T const& max)
+        : m_min(min), m_max(max), m_scale((max - min) / T(max_value))
+    {}
+
+    T decode(quantized_type q) const
+    {
+        return q == max_value ? m_max : m_min + T(q) * m_scale;
+    }
+
+    // The greatest grid coordinate not greater than c.
+    quantized_type encode_min(T const& c) const
+    {
+        if ( ! (m_min < m_max) || ! (m_min < c) )
+            return 0;
+
+        quantized_type q = clamp(std::floor((c - m_min) / m_scale));
+        while ( 0 < q && c < decode(q) )
+            --q;
+        return q;
+    }
+
+    // The smallest grid coordinate not less than c.
+    quantized_type encode_max(T const& c) const
+    {
+        if ( ! (m_min < m_max) || ! (c < m_max) )
+            return max_value;
+
+        quantized_type q = clamp(std::ceil((c - m_min) / m_scale));
+        while ( q < max_value && decode(q) < c )
+            ++q;
+        return q;
+    }
+
+private:
+    static quantized_type clamp(T const& f)
+    {
+        return f <= T(0) ? quantized_type(0)
+             : T(max_value) <= f ? quantized_type(max_value)
+             : static_cast<quantized_type>(f);
+    }
+
+    T m_min;
+    T m_max;
+    T m_scale;
+};
+
+namespace dispatch {
+
+template <typename Box, unsigned Bits,
+          std::size_t CurrentDimension = dimension<Box>::value>
+struct quantize_box
+{
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+    typedef quantization<coordinate_type, Bits> quantization_type;
+    typedef typename quantization_type::quantized_type quantized_type;
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+
+    static inline void init(Box const& parent, quantization_type * grid)
+    {
+        quantize_box<Box, Bits, CurrentDimension - 1>::init(parent, grid);
+
+        static const std::size_t d = CurrentDimension - 1;
+        grid[d] = quantization_type(geometry::get<min_corner, d>(parent),
+                                    geometry::get<max_corner, d>(parent));
+    }
+
+    static inline void encode(quantization_type const* grid, Box const& b, quantized_type * q)
+    {
+        quantize_box<Box, Bits, CurrentDimension - 1>::encode(grid, b, q);
+
+        static const std::size_t d = CurrentDimension - 1;
+        q[d] = grid[d].encode_min(geometry::get<min_corner, d>(b));
+        q[dimension + d] = grid[d].encode_max(geometry::get<max_corner, d>(b));
+    }
+
+    static inline void decode(quantization_type const* grid, quantized_type const* q, Box & b)
+    {
+        quantize_box<Box, Bits, CurrentDimension - 1>::decode(grid, q, b);
+
+        static const std::size_t d = CurrentDimension - 1;
+        geometry::set<min_corner, d>(b, grid[d].decode(q[d]));
+        geometry::set<max_corner, d>(b, grid[d].decode(q[dimension + d]));
+    }
+};
+
+template <typename Box, unsigned Bits>
+struct quantize_box<Box, Bits, 0>
+{
+    typedef quantization<typename geometry::coordinate_type<Box>::type, Bits> quantization_type;
+    typedef typename quantization_type::quantized_type quantized_type;
+
+    static inline void init(Box const& , quantization_type * ) {}
+    static inline void encode(quantization_type const* , Box const& , quantized_type * ) {}
+    static inline void decode(quantization_type const* , quantized_type const* , Box & ) {}
+};
+
+} // namespace dispatch
+
+// The grid of the box of a parent used to quantize the boxes of its children.
+// The scales are calculated once for all of the children.
+template <typename Box, unsigned Bits>
+class quantization_grid
+{
+    typedef dispatch::quantize_box<Box, Bits> quantize_box;
+    typedef typename quantize_box::quantization_type quantization_type;
+
+public:
+    typedef typename quantize_box::quantized_type quantized_type;
+
+    explicit quantization_grid(Box const& parent)
+    {
+        quantize_box::init(parent, m_grid);
+    }
+
+    void encode(Box const& b, quantized_type * q) const
+    {
+        quantize_box::encode(m_grid, b, q);
+    }
+
+    void decode(quantized_type const* q, Box & b) const
+    {
+        quantize_box::decode(m_grid, q, b);
+    }
+
+private:
+    quantization_type m_grid[geometry::dimension<Box>::value];
+};
+
+// Checks if the predicates may be checked with the boxes containing
+// the indexables, i.e. if the values meeting the predicates are not omitted.
+template <typename Predicate>
+struct is_conservative_predicate
+    : boost::mpl::false_
+{};
+
+template <typename Fun, bool Negated>
+struct is_conservative_predicate<predicates::satisfies<Fun, Negated> >
+    : boost::mpl::true_
+{};
+
+template <typename Geometry>
+struct is_conservative_predicate<predicates::spatial_predicate<Geometry, predicates::intersects_tag, false> >
+    : boost::mpl::true_
+{};
+
+template <typename Geometry>
+struct is_conservative_predicate<predicates::spatial_predicate<Geometry, predicates::disjoint_tag, true> >
+    : boost::mpl::true_
+{};
+
+template <typename Geometry>
+struct is_conservative_predicate<predicates::spatial_predicate<Geometry, predicates::contains_tag, false> >
+    : boost::mpl::true_
+{};
+
+template <typename Geometry>
+struct is_conservative_predicate<predicates::spatial_predicate<Geometry, predicates::covers_tag, false> >
+    : boost::mpl::true_
+{};
+
+template <typename Head, typename Tail>
+struct is_conservative_predicate<boost::tuples::cons<Head, Tail> >
+    : boost::mpl::bool_
+        <
+            is_conservative_predicate<Head>::value
+         && is_conservative_predicate<Tail>::value
+        >
+{};
+
+template <>
+struct is_conservative_predicate<boost::tuples::null_type>
+    : boost::mpl::true_
+{};
+
+struct quantized_header
+{
+    char magic[8];
+    boost::uint32_t version;
+    boost::uint32_t byte_order;
+    boost::uint32_t id_size;
+    boost::uint32_t coordinate_size;
+    boost::uint32_t dimension;
+    boost::uint32_t bits;
+    boost::uint32_t order;
+    boost::uint32_t reserved;
+    boost::uint64_t values_count;
+    boost::uint64_t nodes_count;
+    boost::uint64_t leafs_level;
+    boost::uint64_t root_offset;
+    boost::uint64_t nodes_offset;
+    boost::uint64_t boxes_offset;
+    boost::uint64_t values_offset;
+    boost::uint64_t ids_offset;
+    boost::uint64_t size;
+};
+
+inline char const* quantized_magic()
+{
+    return "BGIRTRQB";
+}
+
+// Fills the sizes and offsets of the sections.
+template <typename Id, typename Box, unsigned Bits>
+inline quantized_header make_quantized_header(boost::uint64_t values_count,
+                                              boost::uint64_t nodes_count,
+                                              boost::uint64_t leafs_level,
+                                              boost::uint32_t order)
+{
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+    typedef typename quantized_coordinate<Bits>::type quantized_type;
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+    static const std::size_t box_size = 2 * dimension * sizeof(quantized_type);
+
+    quantized_header h;
+    std::memset(&h, 0, sizeof(quantized_header));
+    std::memcpy(h.magic, quantized_magic(), sizeof(h.magic));
+    h.version = current_version;
+    h.byte_order = byte_order_mark;
+    h.id_size = sizeof(Id);
+    h.coordinate_size = sizeof(coordinate_type);
+    h.dimension = dimension;
+    h.bits = Bits;
+    h.order = order;
+    h.values_count = values_count;
+    h.nodes_count = nodes_count;
+    h.leafs_level = leafs_level;
+    h.root_offset = aligned(sizeof(quantized_header));
+    h.nodes_offset = aligned(h.root_offset + 2 * dimension * sizeof(coordinate_type));
+    h.boxes_offset = aligned(h.nodes_offset + nodes_count * sizeof(node_entry));
+    h.values_offset = aligned(h.boxes_offset + nodes_count * box_size);
+    h.ids_offset = aligned(h.values_offset + values_count * box_size);
+    h.size = h.ids_offset + values_count * sizeof(Id);
+    return h;
+}
+
+// Read-only access to the data stored in the flat layout with quantized boxes.
+template <typename Id, typename Box, unsigned Bits>
+class quantized_storage
+{
+    BOOST_STATIC_ASSERT(boost::alignment_of<Id>::value <= section_alignment);
+
+public:
+    typedef boost::uint64_t size_type;
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+    typedef typename quantized_coordinate<Bits>::type quantized_type;
+
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+    static const std::size_t box_size = 2 * dimension;
+
+    quantized_storage()
+        : m_header(0), m_root(0), m_nodes(0), m_boxes(0), m_values(0), m_ids(0)
+    {}
+
+    // Checks the header of the data and throws std::invalid_argument if it's not valid.
+    // The nodes aren't checked, see are_nodes_valid().
+    quantized_storage(void const* data, std::size_t size)
+        : m_header(0), m_root(0), m_nodes(0), m_boxes(0), m_values(0), m_ids(0)
+    {
+        char const* bytes = static_cast<char const*>(data);
+
+        if ( size < sizeof(quantized_header) || bytes == 0 )
+            throw_invalid_argument("the data is too small to contain rtree");
+
+        // the offsets of sections are aligned so only the alignment
+        // of the beginning of the data has to be checked
+        if ( reinterpret_cast<std::size_t>(bytes) % required_alignment() != 0 )
+            throw_invalid_argument("the rtree data is not properly aligned");
+
+        quantized_header const* h = reinterpret_cast<quantized_header const*>(bytes);
+
+        if ( std::memcmp(h->magic, quantized_magic(), sizeof(h->magic)) != 0
+          || h->version != current_version )
+            throw_invalid_argument("the data doesn't contain rtree of supported format");
+
+        if ( h->byte_order != byte_order_mark
+          || h->id_size != sizeof(Id)
+          || h->coordinate_size != sizeof(coordinate_type)
+          || h->dimension != dimension
+          || h->bits != Bits )
+            throw_invalid_argument("the rtree data is incompatible with the types");
+
+        quantized_header const expected = make_quantized_header<Id, Box, Bits>(
+            h->values_count, h->nodes_count, h->leafs_level, h->order);
+        if ( h->root_offset != expected.root_offset
+          || h->nodes_offset != expected.nodes_offset
+          || h->boxes_offset != expected.boxes_offset
+          || h->values_offset != expected.values_offset
+          || h->ids_offset != expected.ids_offset
+          || h->size != expected.size
+          || h->size > size
+          // the sizes of sections may overflow in make_quantized_header()
+          || h->nodes_count > size / sizeof(node_entry)
+          || h->values_count > size / sizeof(Id)
+          || (h->nodes_count == 0) != (h->values_count == 0) )
+            throw_invalid_argument("the rtree data is corrupted");
+
+        m_header = h;
+        m_root = reinterpret_cast<coordinate_type const*>(bytes + h->root_offset);
+        m_nodes = reinterpret_cast<node_entry const*>(bytes + h->nodes_offset);
+        m_boxes = reinterpret_cast<quantized_type const*>(bytes + h->boxes_offset);
+        m_values = reinterpret_cast<quantized_type const*>(bytes + h->values_offset);
+        m_ids = reinterpret_cast<Id const*>(bytes + h->ids_offset);
+    }
+
+    // The alignment of the data required by the types stored.
+    static std::size_t required_alignment()
+    {
+        std::size_t result = boost::alignment_of<boost::uint64_t>::value;
+        if ( result < boost::alignment_of<Id>::value )
+            result = boost::alignment_of<Id>::value;
+        if ( result < boost::alignment_of<coordinate_type>::value )
+            result = boost::alignment_of<coordinate_type>::value;
+        return result;
+    }
+
+    size_type values_count() const { return m_header ? m_header->values_count : 0; }
+    size_type nodes_count() const { return m_header ? m_header->nodes_count : 0; }
+    size_type leafs_level() const { return m_header ? m_header->leafs_level : 0; }
+
+    // Checks all nodes, the complexity is linear in the number of nodes.
+    bool are_nodes_valid() const
+    {
+        return m_header == 0
+            || flat::are_nodes_valid(m_nodes, m_header->nodes_count,
+                                     m_header->values_count, m_header->leafs_level);
+    }
+
+    bool is_leaf(size_type node) const { return (m_nodes[node].flags & node_entry::leaf_flag) != 0; }
+
+    node_entry const& node(size_type node) const { return m_nodes[node]; }
+    Id const& id(size_type value) const { return m_ids[value]; }
+
+    Box root_box() const
+    {
+        coordinate_type const* mins[dimension];
+        coordinate_type const* maxs[dimension];
+        for ( std::size_t d = 0 ; d < dimension ; ++d )
+        {
+            mins[d] = m_root + d;
+            maxs[d] = m_root + dimension + d;
+        }
+
+        Box result;
+        dispatch::assign_box<Box>::apply(result, mins, maxs, 0);
+        return result;
+    }
+
+    // The box containing the box of a node, grid is created for the decoded box of its parent.
+    void node_box(quantization_grid<Box, Bits> const& grid, size_type node, Box & result) const
+    {
+        grid.decode(m_boxes + node * box_size, result);
+    }
+
+    // The box containing the indexable of a value, grid is created for the decoded box of the leaf.
+    void value_box(quantization_grid<Box, Bits> const& grid, size_type value, Box & result) const
+    {
+        grid.decode(m_values + value * box_size, result);
+    }
+
+    Id const* ids() const { return m_ids; }
+
+private:
+    quantized_header const* m_header;
+    coordinate_type const* m_root;
+    node_entry const* m_nodes;
+    quantized_type const* m_boxes;
+    quantized_type const* m_values;
+    Id const* m_ids;
+};
+
+}}}}}} // namespace boost::geometry::index::detail::rtree::flat
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_QUANTIZED_HPP
@@ -0,0 +1,765 @@
+// Boost.Geometry Index
+//
+// R-tree flat, pointer-free layout queries
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_QUERY_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_QUERY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <boost/core/addressof.hpp>
+#include <boost/mpl/bool.hpp>
+
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/distance_predicates.hpp>
+#include <boost/geometry/index/detail/query_output.hpp>
+#include <boost/geometry/index/detail/rtree/flat/intersects.hpp>
+#include <boost/geometry/index/detail/rtree/flat/layout.hpp>
+#include <boost/geometry/index/detail/rtree/flat/quantized.hpp>
+#include <boost/geometry/index/detail/rtree/query_iterators.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/distance_query.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree { namespace flat {
+
+// The types required by the type-erased query iterator.
+template <typename Value>
+struct iterator_types
+{
+    typedef Value const& const_reference;
+    typedef Value const* const_pointer;
+    typedef std::ptrdiff_t difference_type;
+};
+
+template <typename Value, typename Box, typename Translator, typename Strategy,
+          typename Predicates, typename OutIter>
+class spatial_query
+{
+public:
+    typedef flat::storage<Value, Box> storage_type;
+    typedef typename storage_type::size_type size_type;
+    typedef typename storage_type::coordinate_type coordinate_type;
+
+    static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
+
+    typedef box_intersects_predicate<Predicates, Box> intersects_predicate;
+
+    typedef index::detail::query_output<OutIter> output_type;
+    typedef typename output_type::is_stoppable is_stoppable;
+
+    inline spatial_query(storage_type const& s, Translator const& t, Strategy const& strategy,
+                         Predicates const& p, OutIter out_it)
+        : m_storage(s), m_translator(t), m_strategy(strategy)
+        , m_pred(p), m_out_iter(out_it), m_found_count(0), m_stopped(false)
+    {
+        init(boost::mpl::bool_<intersects_predicate::value>());
+    }
+
+    inline size_type apply()
+    {
+        if ( 0 < m_storage.nodes_count() )
+            apply(0, 0);
+        return m_found_count;
+    }
+
+private:
+    inline void apply(size_type node_index, std::size_t level)
+    {
+        node_entry const& n = m_storage.node(node_index);
+        size_type const last = n.first + n.count;
+
+        if ( m_storage.is_leaf(node_index) )
+        {
+            // get all values meeting predicates
+            for ( size_type i = n.first ; i < last ; ++i )
+            {
+                Value const& v = m_storage.value(i);
+                if ( index::detail::predicates_check
+                        <
+                            index::detail::value_tag, 0, predicates_len
+                        >(m_pred, v, m_translator(v), m_strategy) )
+                {
+                    ++m_found_count;
+
+                    if ( ! output_type::apply(m_out_iter, v) )
+                    {
+                        m_stopped = true;
+                        return;
+                    }
+                }
+            }
+        }
+        else
+        {
+            traverse(n, level, boost::mpl::bool_<intersects_predicate::value>());
+        }
+    }
+
+    // Always false for output iterators so the checks are optimized out.
+    inline bool is_stopped() const
+    {
+        return is_stoppable::value && m_stopped;
+    }
+
+    inline void init(boost::mpl::true_ const& /*intersects_predicate*/)
+    {
+        intersects_predicate::bounds(m_pred, m_mins, m_maxs);
+    }
+
+    inline void init(boost::mpl::false_ const& /*intersects_predicate*/)
+    {}
+
+    // The coordinates of boxes are compared directly
+    inline void traverse(node_entry const& n, std::size_t level,
+                         boost::mpl::true_ const& /*intersects_predicate*/)
+    {
+        size_type const last = n.first + n.count;
+
+        // up to 64 children are tested at once
+        for ( size_type first = n.first ; first < last ; first += 64 )
+        {
+            std::size_t const count = static_cast<std::size_t>((std::min)(last - first, size_type(64)));
+            for ( boost::uint64_t mask = nodes_intersect(m_storage, first, count, m_mins, m_maxs) ;
+                  mask != 0 ; mask &= mask - 1 )
+            {
+                apply(first + simd::lowest_bit(mask), level + 1);
+
+                if ( is_stopped() )
+                    return;
+            }
+        }
+    }
+
+    inline void traverse(node_entry const& n, std::size_t level,
+                         boost::mpl::false_ const& /*intersects_predicate*/)
+    {
+        size_type const last = n.first + n.count;
+
+        // traverse nodes meeting predicates
+        for ( size_type i = n.first ; i < last ; ++i )
+        {
+            // 0 - dummy value
+            if ( index::detail::predicates_check
+                    <
+                        index::detail::bounds_tag, 0, predicates_len
+                    >(m_pred, 0, m_storage.box(i), m_strategy) )
+            {
+                apply(i, level + 1);
+
+                if ( is_stopped() )
+                    return;
+            }
+        }
+    }
+
+    storage_type const& m_storage;
+    Translator const& m_translator;
+    Strategy const& m_strategy;
+    Predicates const& m_pred;
+    OutIter m_out_iter;
+    size_type m_found_count;
+    bool m_stopped;
+
+    coordinate_type m_mins[storage_type::dimension];
+    coordinate_type m_maxs[storage_type::dimension];
+};
+
+template <typename Value, typename Box, typename Translator, typename Strategy,
+          typename Predicates, unsigned DistancePredicateIndex, typename OutIter>
+class distance_query
+{
+public:
+    typedef flat::storage<Value, Box> storage_type;
+    typedef typename storage_type::size_type size_type;
+
+    typedef index::detail::predicates_element<DistancePredicateIndex, Predicates> nearest_predicate_access;
+    typedef typename nearest_predicate_access::type nearest_predicate_type;
+    typedef typename indexable_type<Translator>::type indexable_type;
+
+    typedef index::detail::calculate_distance<nearest_predicate_type, indexable_type, Strategy, value_tag> calculate_value_distance;
+    typedef index::detail::calculate_distance<nearest_predicate_type, Box, Strategy, bounds_tag> calculate_node_distance;
+    typedef typename calculate_value_distance::result_type value_distance_type;
+    typedef typename calculate_node_distance::result_type node_distance_type;
+
+    static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
+
+    inline distance_query(storage_type const& s, Translator const& t, Strategy const& strategy,
+                          Predicates const& pred, OutIter out_it)
+        : m_storage(s), m_translator(t), m_strategy(strategy)
+        , m_pred(pred)
+        , m_result(nearest_predicate_access::get(m_pred).count, out_it)
+        // the active branch lists of internal levels are reused
+        , m_branch_lists(static_cast<std::size_t>(s.leafs_level()))
+    {}
+
+    inline size_type apply()
+    {
+        if ( 0 < m_storage.nodes_count() )
+            apply(0, 0);
+        return m_result.finish();
+    }
+
+private:
+    typedef std::pair<node_distance_type, size_type> branch_data;
+    typedef std::vector<branch_data> branch_list;
+
+    inline void apply(size_type node_index, std::size_t level)
+    {
+        node_entry const& n = m_storage.node(node_index);
+        size_type const last = n.first + n.count;
+
+        if ( m_storage.is_leaf(node_index) )
+        {
+            // search leaf for closest value meeting predicates
+            for ( size_type i = n.first ; i < last ; ++i )
+            {
+                Value const& v = m_storage.value(i);
+                if ( index::detail::predicates_check
+                        <
+                            index::detail::value_tag, 0, predicates_len
+                        >(m_pred, v, m_translator(v), m_strategy) )
+                {
+                    value_distance_type value_distance;
+                    if ( calculate_value_distance::apply(predicate(), m_translator(v),
+                                                         m_strategy, value_distance) )
+                    {
+                        m_result.store(v, value_distance);
+                    }
+                }
+            }
+            return;
+        }
+
+        branch_list & active_branch_list = m_branch_lists[level];
+        active_branch_list.clear();
+
+        // fill array of nodes meeting predicates
+        for ( size_type i = n.first ; i < last ; ++i )
+        {
+            Box const b = m_storage.box(i);
+            // 0 - dummy value
+            if ( index::detail::predicates_check
+                    <
+                        index::detail::bounds_tag, 0, predicates_len
+                    >(m_pred, 0, b, m_strategy) )
+            {
+                node_distance_type node_distance;
+                if ( !calculate_node_distance::apply(predicate(), b, m_strategy, node_distance) )
+                    continue;
+
+                if ( m_result.has_enough_neighbors()
+                  && m_result.greatest_comparable_distance() <= node_distance )
+                    continue;
+
+                active_branch_list.push_back(std::make_pair(node_distance, i));
+            }
+        }
+
+        std::sort(active_branch_list.begin(), active_branch_list.end(), branch_less());
+
+        for ( typename branch_list::const_iterator it = active_branch_list.begin();
+              it != active_branch_list.end() ; ++it )
+        {
+            // the rest of nodes are further than the furthest neighbor
+            if ( m_result.has_enough_neighbors()
+              && m_result.greatest_comparable_distance() <= it->first )
+                break;
+
+            apply(it->second, level + 1);
+        }
+    }
+
+    struct branch_less
+    {
+        bool operator()(branch_data const& l, branch_data const& r) const
+        {
+            return l.first < r.first;
+        }
+    };
+
+    nearest_predicate_type const& predicate() const
+    {
+        return nearest_predicate_access::get(m_pred);
+    }
+
+    storage_type const& m_storage;
+    Translator const& m_translator;
+    Strategy const& m_strategy;
+    Predicates m_pred;
+    rtree::visitors::distance_query_result<Value, Translator, value_distance_type, OutIter> m_result;
+    std::vector<branch_list> m_branch_lists;
+};
+
+template <typename Value, typename Box, typename Translator, typename Strategy,
+          typename Predicates>
+class spatial_query_iterator
+{
+    typedef flat::storage<Value, Box> storage_type;
+    typedef typename storage_type::size_type size_type;
+
+    static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
+
+public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef Value value_type;
+    typedef Value const& reference;
+    typedef std::ptrdiff_t difference_type;
+    typedef Value const* pointer;
+
+    inline spatial_query_iterator()
+        : m_translator(0), m_current(0), m_leaf_end(0)
+    {}
+
+    inline spatial_query_iterator(storage_type const& s, Translator const& t,
+                                  Strategy const& strategy, Predicates const& p)
+        : m_storage(s), m_translator(boost::addressof(t)), m_strategy(strategy)
+        , m_pred(p), m_current(0), m_leaf_end(0)
+    {
+        if ( 0 < m_storage.nodes_count() )
+        {
+            enter(0);
+            search_value();
+        }
+    }
+
+    reference operator*() const
+    {
+        return m_storage.value(m_current);
+    }
+
+    const value_type * operator->() const
+    {
+        return boost::addressof(m_storage.value(m_current));
+    }
+
+    spatial_query_iterator & operator++()
+    {
+        ++m_current;
+        search_value();
+        return *this;
+    }
+
+    spatial_query_iterator operator++(int)
+    {
+        spatial_query_iterator temp = *this;
+        this->operator++();
+        return temp;
+    }
+
+    friend bool operator==(spatial_query_iterator const& l, spatial_query_iterator const& r)
+    {
+        return l.is_end() ? r.is_end() : (!r.is_end() && l.m_current == r.m_current);
+    }
+
+    friend bool operator==(spatial_query_iterator const& l,
+                           iterators::end_query_iterator<Value, iterator_types<Value> > const& /*r*/)
+    {
+        return l.is_end();
+    }
+
+    friend bool operator==(iterators::end_query_iterator<Value, iterator_types<Value> > const& /*l*/,
+                           spatial_query_iterator const& r)
+    {
+        return r.is_end();
+    }
+
+    friend bool operator!=(spatial_query_iterator const& l, spatial_query_iterator const& r)
+    {
+        return !(l == r);
+    }
+
+private:
+    bool is_end() const
+    {
+        return m_leaf_end <= m_current;
+    }
+
+    // Stores the range of children of a node.
+    void enter(size_type node_index)
+    {
+        node_entry const& n = m_storage.node(node_index);
+        if ( m_storage.is_leaf(node_index) )
+        {
+            m_current = n.first;
+            m_leaf_end = n.first + n.count;
+        }
+        else
+        {
+            m_internal_stack.push_back(std::make_pair(n.first, n.first + n.count));
+        }
+    }
+
+    void search_value()
+    {
+        for (;;)
+        {
+            // search the values of the current leaf
+            for ( ; m_current < m_leaf_end ; ++m_current )
+            {
+                Value const& v = m_storage.value(m_current);
+                if ( index::detail::predicates_check
+                        <
+                            index::detail::value_tag, 0, predicates_len
+                        >(m_pred, v, (*m_translator)(v), m_strategy) )
+                {
+                    return;
+                }
+            }
+
+            if ( m_internal_stack.empty() )
+                return;
+
+            std::pair<size_type, size_type> & children = m_internal_stack.back();
+            if ( children.first == children.second )
+            {
+                m_internal_stack.pop_back();
+                continue;
+            }
+
+            size_type const node_index = children.first++;
+
+            // 0 - dummy value
+            if ( index::detail::predicates_check
+                    <
+                        index::detail::bounds_tag, 0, predicates_len
+                    >(m_pred, 0, m_storage.box(node_index), m_strategy) )
+            {
+                enter(node_index);
+            }
+        }
+    }
+
+    storage_type m_storage;
+    Translator const* m_translator;
+    Strategy m_strategy;
+    Predicates m_pred;
+
+    std::vector< std::pair<size_type, size_type> > m_internal_stack;
+    size_type m_current;
+    size_type m_leaf_end;
+};
+
+// Incremental knn query returning the values in the order of increasing
+// distance. The nodes and values are stored in one priority queue and
+// the nearest one is expanded or returned at each step.
+template <typename Value, typename Box, typename Translator, typename Strategy,
+          typename Predicates, unsigned DistancePredicateIndex>
+class distance_query_iterator
+{
+    typedef flat::storage<Value, Box> storage_type;
+    typedef typename storage_type::size_type size_type;
+
+    typedef index::detail::predicates_element<DistancePredicateIndex, Predicates> nearest_predicate_access;
+    typedef typename nearest_predicate_access::type nearest_predicate_type;
+    typedef typename indexable_type<Translator>::type indexable_type;
+
+    typedef index::detail::calculate_distance<nearest_predicate_type, indexable_type, Strategy, value_tag> calculate_value_distance;
+    typedef index::detail::calculate_distance<nearest_predicate_type, Box, Strategy, bounds_tag> calculate_node_distance;
+    typedef typename calculate_value_distance::result_type value_distance_type;
+    typedef typename calculate_node_distance::result_type node_distance_type;
+    typedef typename geometry::select_most_precise
+        <
+            value_distance_type, node_distance_type
+        >::type distance_type;
+
+    static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
+
+    struct entry
+    {
+        entry(distance_type const& d, size_type i, bool v)
+            : distance(d), index(i), is_value(v)
+        {}
+
+        distance_type distance;
+        size_type index;
+        bool is_value;
+    };
+
+    struct entry_greater
+    {
+        bool operator()(entry const& l, entry const& r) const
+        {
+            return r.distance < l.distance;
+        }
+    };
+
+public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef Value value_type;
+    typedef Value const& reference;
+    typedef std::ptrdiff_t difference_type;
+    typedef Value const* pointer;
+
+    inline distance_query_iterator()
+        : m_translator(0), m_current(end_index()), m_returned(0)
+    {}
+
+    inline distance_query_iterator(storage_type const& s, Translator const& t,
+                                   Strategy const& strategy, Predicates const& p)
+        : m_storage(s), m_translator(boost::addressof(t)), m_strategy(strategy)
+        , m_pred(p), m_current(end_index()), m_returned(0)
+    {
+        if ( 0 < m_storage.nodes_count() && 0 < predicate().count )
+        {
+            expand(0);
+            search_value();
+        }
+    }
+
+    reference operator*() const
+    {
+        return m_storage.value(m_current);
+    }
+
+    const value_type * operator->() const
+    {
+        return boost::addressof(m_storage.value(m_current));
+    }
+
+    distance_query_iterator & operator++()
+    {
+        search_value();
+        return *this;
+    }
+
+    distance_query_iterator operator++(int)
+    {
+        distance_query_iterator temp = *this;
+        this->operator++();
+        return temp;
+    }
+
+    friend bool operator==(distance_query_iterator const& l, distance_query_iterator const& r)
+    {
+        return l.m_current == r.m_current;
+    }
+
+    friend bool operator==(distance_query_iterator const& l,
+                           iterators::end_query_iterator<Value, iterator_types<Value> > const& /*r*/)
+    {
+        return l.is_end();
+    }
+
+    friend bool operator==(iterators::end_query_iterator<Value, iterator_types<Value> > const& /*l*/,
+                           distance_query_iterator const& r)
+    {
+        return r.is_end();
+    }
+
+    friend bool operator!=(distance_query_iterator const& l, distance_query_iterator const& r)
+    {
+        return !(l == r);
+    }
+
+private:
+    static size_type end_index()
+    {
+        return (std::numeric_limits<size_type>::max)();
+    }
+
+    bool is_end() const
+    {
+        return m_current == end_index();
+    }
+
+    // Pushes the children of a node meeting predicates into the queue.
+    void expand(size_type node_index)
+    {
+        node_entry const& n = m_storage.node(node_index);
+        size_type const last = n.first + n.count;
+
+        if ( m_storage.is_leaf(node_index) )
+        {
+            for ( size_type i = n.first ; i < last ; ++i )
+            {
+                Value const& v = m_storage.value(i);
+                value_distance_type value_distance;
+                if ( index::detail::predicates_check
+                        <
+                            index::detail::value_tag, 0, predicates_len
+                        >(m_pred, v, (*m_translator)(v), m_strategy)
+                  && calculate_value_distance::apply(predicate(), (*m_translator)(v),
+                                                     m_strategy, value_distance) )
+                {
+                    push(entry(value_distance, i, true));
+                }
+            }
+        }
+        else
+        {
+            for ( size_type i = n.first ; i < last ; ++i )
+            {
+                Box const b = m_storage.box(i);
+                node_distance_type node_distance;
+                // 0 - dummy value
+                if ( index::detail::predicates_check
+                        <
+                            index::detail::bounds_tag, 0, predicates_len
+                        >(m_pred, 0, b, m_strategy)
+                  && calculate_node_distance::apply(predicate(), b, m_strategy, node_distance) )
+                {
+                    push(entry(node_distance, i, false));
+                }
+            }
+        }
+    }
+
+    void push(entry const& e)
+    {
+        m_queue.push_back(e);
+        std::push_heap(m_queue.begin(), m_queue.end(), entry_greater());
+    }
+
+    void search_value()
+    {
+        m_current = end_index();
+
+        if ( predicate().count <= m_returned )
+        {
+            m_queue.clear();
+            return;
+        }
+
+        while ( !m_queue.empty() )
+        {
+            entry const e = m_queue.front();
+            std::pop_heap(m_queue.begin(), m_queue.end(), entry_greater());
+            m_queue.pop_back();
+
+            if ( e.is_value )
+            {
+                m_current = e.index;
+                ++m_returned;
+                return;
+            }
+
+            expand(e.index);
+        }
+    }
+
+    nearest_predicate_type const& predicate() const
+    {
+        return nearest_predicate_access::get(m_pred);
+    }
+
+    storage_type m_storage;
+    Translator const* m_translator;
+    Strategy m_strategy;
+    Predicates m_pred;
+
+    std::vector<entry> m_queue;
+    size_type m_current;
+    size_type m_returned;
+};
+
+// Spatial query of the tree stored with quantized boxes. The boxes of nodes
+// are decoded top-down. The predicates are checked with the decoded boxes of
+// values and their ids so the result contains all of the values meeting
+// conservative predicates and possibly other ones.
+template <typename Id, typename Box, unsigned Bits, typename Strategy,
+          typename Predicates, typename OutIter>
+class quantized_spatial_query
+{
+public:
+    typedef flat::quantized_storage<Id, Box, Bits> storage_type;
+    typedef typename storage_type::size_type size_type;
+
+    static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
+
+    typedef index::detail::query_output<OutIter> output_type;
+    typedef typename output_type::is_stoppable is_stoppable;
+
+    inline quantized_spatial_query(storage_type const& s, Strategy const& strategy,
+                                   Predicates const& p, OutIter out_it)
+        : m_storage(s), m_strategy(strategy)
+        , m_pred(p), m_out_iter(out_it), m_found_count(0), m_stopped(false)
+    {}
+
+    inline size_type apply()
+    {
+        if ( 0 < m_storage.nodes_count() )
+            apply(0, m_storage.root_box());
+        return m_found_count;
+    }
+
+private:
+    inline void apply(size_type node_index, Box const& node_box)
+    {
+        node_entry const& n = m_storage.node(node_index);
+        size_type const last = n.first + n.count;
+
+        quantization_grid<Box, Bits> const grid(node_box);
+        Box b;
+
+        if ( m_storage.is_leaf(node_index) )
+        {
+            // get all values meeting predicates
+            for ( size_type i = n.first ; i < last ; ++i )
+            {
+                m_storage.value_box(grid, i, b);
+                Id const& id = m_storage.id(i);
+                if ( index::detail::predicates_check
+                        <
+                            index::detail::value_tag, 0, predicates_len
+                        >(m_pred, id, b, m_strategy) )
+                {
+                    ++m_found_count;
+
+                    if ( ! output_type::apply(m_out_iter, id) )
+                    {
+                        m_stopped = true;
+                        return;
+                    }
+                }
+            }
+        }
+        else
+        {
+            // traverse nodes meeting predicates
+            for ( size_type i = n.first ; i < last ; ++i )
+            {
+                m_storage.node_box(grid, i, b);
+                // 0 - dummy value
+                if ( index::detail::predicates_check
+                        <
+                            index::detail::bounds_tag, 0, predicates_len
+                        >(m_pred, 0, b, m_strategy) )
+                {
+                    apply(i, b);
+
+                    if ( is_stopped() )
+                        return;
+                }
+            }
+        }
+    }
+
+    // Always false for output iterators so the checks are optimized out.
+    inline bool is_stopped() const
+    {
+        return is_stoppable::value && m_stopped;
+    }
+
+    storage_type const& m_storage;
+    Strategy const& m_strategy;
+    Predicates const& m_pred;
+    OutIter m_out_iter;
+    size_type m_found_count;
+    bool m_stopped;
+};
+
+}}}}}} // namespace boost::geometry::index::detail::rtree::flat
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_QUERY_HPP
@@ -0,0 +1,639 @@
+// Boost.Geometry Index
+//
+// R-tree flat, pointer-free layout writer
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_WRITE_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_WRITE_HPP
+
+#include <algorithm>
+#include <ios>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include <boost/core/addressof.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/rtree/flat/layout.hpp>
+#include <boost/geometry/index/detail/rtree/flat/quantized.hpp>
+#include <boost/geometry/index/detail/rtree/pack_create.hpp>
+#include <boost/geometry/index/detail/rtree/utilities/view.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree { namespace flat {
+
+namespace visitors {
+
+// Gathers the numbers of children and the boxes of nodes level by level.
+// Since the tree is balanced the depth-first traversal visits the nodes
+// of each level in the same order as the level order traversal.
+template <typename MembersHolder>
+struct gather_levels
+    : public MembersHolder::visitor_const
+{
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    inline explicit gather_levels(std::size_t leafs_level)
+        : counts(leafs_level + 1), boxes(leafs_level + 1), level(0)
+    {}
+
+    inline void operator()(internal_node const& n)
+    {
+        typedef typename rtree::elements_type<internal_node>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        counts[level].push_back(elements.size());
+
+        std::size_t const level_backup = level;
+        ++level;
+
+        for (typename elements_type::const_iterator it = elements.begin();
+            it != elements.end(); ++it)
+        {
+            boxes[level].push_back(it->first);
+            rtree::apply_visitor(*this, *it->second);
+        }
+
+        level = level_backup;
+    }
+
+    inline void operator()(leaf const& n)
+    {
+        counts[level].push_back(rtree::elements(n).size());
+        leafs.push_back(boost::addressof(n));
+    }
+
+    std::vector< std::vector<boost::uint64_t> > counts;
+    std::vector< std::vector<box_type> > boxes;
+    std::vector<leaf const*> leafs;
+    std::size_t level;
+};
+
+} // namespace visitors
+
+inline void write_padding(std::ostream & os, boost::uint64_t & offset, boost::uint64_t aligned_offset)
+{
+    static const char zeros[section_alignment] = {};
+    os.write(zeros, static_cast<std::streamsize>(aligned_offset - offset));
+    offset = aligned_offset;
+}
+
+template <typename T>
+inline void write_raw(std::ostream & os, boost::uint64_t & offset, T const& v)
+{
+    os.write(reinterpret_cast<char const*>(boost::addressof(v)), sizeof(T));
+    offset += sizeof(T);
+}
+
+// The structure of the tree. The nodes are identified by their indexes
+// in level order. The children of a node are contiguous in this order.
+struct levels_structure
+{
+    template <typename Counts>
+    explicit levels_structure(Counts const& counts)
+    {
+        std::size_t const levels_count = counts.size();
+
+        level_first.resize(levels_count + 1, 0);
+        for ( std::size_t l = 0 ; l < levels_count ; ++l )
+            level_first[l + 1] = level_first[l] + counts[l].size();
+
+        // the first child of a node, for leafs the first value
+        first_child.reserve(level_first.back());
+        children_count.reserve(level_first.back());
+        for ( std::size_t l = 0 ; l < levels_count ; ++l )
+        {
+            boost::uint64_t first = l + 1 < levels_count ? level_first[l + 1] : 0;
+            for ( std::size_t i = 0 ; i < counts[l].size() ; ++i )
+            {
+                first_child.push_back(first);
+                children_count.push_back(counts[l][i]);
+                first += counts[l][i];
+            }
+        }
+    }
+
+    boost::uint64_t nodes_count() const { return level_first.back(); }
+
+    std::vector<boost::uint64_t> level_first;
+    std::vector<boost::uint64_t> first_child;
+    std::vector<boost::uint64_t> children_count;
+};
+
+// Calculates the order of nodes.
+class nodes_order
+{
+public:
+    nodes_order(levels_structure const& s, std::size_t leafs_level, node_order order)
+        : m_structure(s)
+    {
+        m_order.reserve(s.nodes_count());
+
+        if ( s.nodes_count() == 0 )
+            return;
+
+        m_order.push_back(0);
+        if ( order == level_node_order )
+        {
+            for ( boost::uint64_t i = 1 ; i < s.nodes_count() ; ++i )
+                m_order.push_back(i);
+        }
+        else if ( 0 < leafs_level )
+        {
+            van_emde_boas(0, 1, leafs_level);
+        }
+    }
+
+    // The nodes in the order of storing.
+    std::vector<boost::uint64_t> const& order() const { return m_order; }
+
+private:
+    // Stores the children of the range of nodes [first, last) and their
+    // descendants up to the height levels below.
+    void van_emde_boas(boost::uint64_t first, boost::uint64_t last, std::size_t height)
+    {
+        if ( height == 1 )
+        {
+            std::pair<boost::uint64_t, boost::uint64_t> const children = children_of(first, last);
+            for ( boost::uint64_t i = children.first ; i < children.second ; ++i )
+                m_order.push_back(i);
+            return;
+        }
+
+        std::size_t const top_height = height / 2;
+        van_emde_boas(first, last, top_height);
+
+        std::pair<boost::uint64_t, boost::uint64_t> bottom_roots(first, last);
+        for ( std::size_t h = 0 ; h < top_height ; ++h )
+            bottom_roots = children_of(bottom_roots.first, bottom_roots.second);
+
+        for ( boost::uint64_t i = bottom_roots.first ; i < bottom_roots.second ; ++i )
+            van_emde_boas(i, i + 1, height - top_height);
+    }
+
+    // The children of a contiguous range of nodes are contiguous.
+    std::pair<boost::uint64_t, boost::uint64_t> children_of(boost::uint64_t first, boost::uint64_t last) const
+    {
+        return std::make_pair(m_structure.first_child[first],
+                              m_structure.first_child[last - 1] + m_structure.children_count[last - 1]);
+    }
+
+    levels_structure const& m_structure;
+    std::vector<boost::uint64_t> m_order;
+};
+
+// Writes the rtree into the stream in the flat layout. The state of the stream
+// should be checked by the caller.
+template <typename Rtree>
+inline void write(Rtree const& tree, std::ostream & os, node_order order)
+{
+    typedef utilities::view<Rtree> rtree_view;
+    typedef typename rtree_view::members_holder members_holder;
+    typedef typename rtree_view::value_type value_type;
+    typedef typename rtree_view::box_type box_type;
+    typedef typename members_holder::leaf leaf;
+    static const std::size_t dimension = geometry::dimension<box_type>::value;
+
+    // the values are copied byte by byte, they can't own any resources
+    BOOST_MPL_ASSERT_MSG((boost::has_trivial_destructor<value_type>::value),
+                         VALUE_TYPE_CANNOT_BE_STORED_IN_FLAT_LAYOUT,
+                         (value_type));
+
+    rtree_view rtv(tree);
+
+    std::size_t const leafs_level = rtv.depth();
+
+    visitors::gather_levels<members_holder> v(leafs_level);
+    if ( !tree.empty() )
+    {
+        // the box of the root isn't stored in the tree
+        v.boxes[0].push_back(tree.bounds());
+        rtv.apply_visitor(v);
+    }
+
+    levels_structure const structure(v.counts);
+    boost::uint64_t const nodes_count = structure.nodes_count();
+    boost::uint64_t const first_leaf = structure.level_first[leafs_level];
+
+    nodes_order const nodes(structure, leafs_level, order);
+    std::vector<boost::uint64_t> const& stored = nodes.order();
+
+    // the position of a node in the data
+    std::vector<boost::uint64_t> position(nodes_count);
+    for ( boost::uint64_t i = 0 ; i < nodes_count ; ++i )
+        position[stored[i]] = i;
+
+    // the boxes of nodes in level order
+    std::vector<box_type const*> boxes;
+    boxes.reserve(nodes_count);
+    for ( std::size_t l = 0 ; l < v.boxes.size() ; ++l )
+        for ( std::size_t i = 0 ; i < v.boxes[l].size() ; ++i )
+            boxes.push_back(boost::addressof(v.boxes[l][i]));
+
+    header const h = make_header<value_type, box_type>(tree.size(), nodes_count,
+                                                       leafs_level, order);
+    boost::uint64_t offset = 0;
+    write_raw(os, offset, h);
+
+    write_padding(os, offset, h.nodes_offset);
+    for ( boost::uint64_t i = 0 ; i < nodes_count ; ++i )
+    {
+        boost::uint64_t const n = stored[i];
+        bool const is_leaf = first_leaf <= n;
+
+        node_entry e;
+        e.first = is_leaf ? structure.first_child[n] : position[structure.first_child[n]];
+        e.count = static_cast<boost::uint32_t>(structure.children_count[n]);
+        e.flags = is_leaf ? node_entry::leaf_flag : 0;
+        write_raw(os, offset, e);
+    }
+
+    for ( std::size_t d = 0 ; d < dimension ; ++d )
+    {
+        write_padding(os, offset, h.boxes_offset + 2 * d * h.coordinates_stride);
+        for ( boost::uint64_t i = 0 ; i < nodes_count ; ++i )
+            write_raw(os, offset, dispatch::get_box_coordinate<box_type, min_corner>::apply(*boxes[stored[i]], d));
+
+        write_padding(os, offset, h.boxes_offset + (2 * d + 1) * h.coordinates_stride);
+        for ( boost::uint64_t i = 0 ; i < nodes_count ; ++i )
+            write_raw(os, offset, dispatch::get_box_coordinate<box_type, max_corner>::apply(*boxes[stored[i]], d));
+    }
+
+    write_padding(os, offset, h.values_offset);
+    for ( std::size_t i = 0 ; i < v.leafs.size() ; ++i )
+    {
+        typedef typename rtree::elements_type<leaf>::type elements_type;
+        elements_type const& elements = rtree::elements(*v.leafs[i]);
+
+        for ( typename elements_type::const_iterator it = elements.begin();
+              it != elements.end(); ++it )
+        {
+            write_raw(os, offset, *it);
+        }
+    }
+}
+
+// Writes the rtree into the stream in the flat layout with quantized boxes.
+// The ids of values are returned by get_id. The state of the stream should
+// be checked by the caller.
+template <typename Id, unsigned Bits, typename Rtree, typename IdGetter>
+inline void write_quantized(Rtree const& tree, std::ostream & os, node_order order,
+                            IdGetter const& get_id)
+{
+    typedef utilities::view<Rtree> rtree_view;
+    typedef typename rtree_view::members_holder members_holder;
+    typedef typename rtree_view::box_type box_type;
+    typedef typename members_holder::leaf leaf;
+    typedef typename geometry::coordinate_type<box_type>::type coordinate_type;
+    typedef quantization_grid<box_type, Bits> grid_type;
+    typedef typename grid_type::quantized_type quantized_type;
+    static const std::size_t dimension = geometry::dimension<box_type>::value;
+    static const std::size_t box_size = 2 * dimension;
+
+    // the boxes are decoded with floating point calculations
+    BOOST_MPL_ASSERT_MSG((boost::is_floating_point<coordinate_type>::value),
+                         COORDINATE_TYPE_MUST_BE_FLOATING_POINT,
+                         (coordinate_type));
+
+    rtree_view rtv(tree);
+
+    std::size_t const leafs_level = rtv.depth();
+
+    visitors::gather_levels<members_holder> v(leafs_level);
+    if ( !tree.empty() )
+    {
+        // the box of the root isn't stored in the tree
+        v.boxes[0].push_back(tree.bounds());
+        rtv.apply_visitor(v);
+    }
+
+    levels_structure const structure(v.counts);
+    boost::uint64_t const nodes_count = structure.nodes_count();
+    boost::uint64_t const first_leaf = structure.level_first[leafs_level];
+
+    nodes_order const nodes(structure, leafs_level, order);
+    std::vector<boost::uint64_t> const& stored = nodes.order();
+
+    // the position of a node in the data
+    std::vector<boost::uint64_t> position(nodes_count);
+    for ( boost::uint64_t i = 0 ; i < nodes_count ; ++i )
+        position[stored[i]] = i;
+
+    // the boxes of nodes in level order
+    std::vector<box_type const*> boxes;
+    boxes.reserve(nodes_count);
+    for ( std::size_t l = 0 ; l < v.boxes.size() ; ++l )
+        for ( std::size_t i = 0 ; i < v.boxes[l].size() ; ++i )
+            boxes.push_back(boost::addressof(v.boxes[l][i]));
+
+    // the children are quantized relative to the decoded boxes of their parents
+    std::vector<box_type> decoded(nodes_count);
+    std::vector<quantized_type> quantized(nodes_count * box_size, 0);
+    if ( 0 < nodes_count )
+        decoded[0] = *boxes[0];
+    for ( boost::uint64_t n = 0 ; n < first_leaf ; ++n )
+    {
+        grid_type const grid(decoded[n]);
+        boost::uint64_t const last = structure.first_child[n] + structure.children_count[n];
+        for ( boost::uint64_t c = structure.first_child[n] ; c < last ; ++c )
+        {
+            grid.encode(*boxes[c], &quantized[c * box_size]);
+            grid.decode(&quantized[c * box_size], decoded[c]);
+        }
+    }
+
+    quantized_header const h = make_quantized_header<Id, box_type, Bits>(tree.size(), nodes_count,
+                                                                          leafs_level, order);
+    boost::uint64_t offset = 0;
+    write_raw(os, offset, h);
+
+    write_padding(os, offset, h.root_offset);
+    if ( 0 < nodes_count )
+    {
+        for ( std::size_t d = 0 ; d < dimension ; ++d )
+            write_raw(os, offset, dispatch::get_box_coordinate<box_type, min_corner>::apply(decoded[0], d));
+        for ( std::size_t d = 0 ; d < dimension ; ++d )
+            write_raw(os, offset, dispatch::get_box_coordinate<box_type, max_corner>::apply(decoded[0], d));
+    }
+
+    write_padding(os, offset, h.nodes_offset);
+    for ( boost::uint64_t i = 0 ; i < nodes_count ; ++i )
+    {
+        boost::uint64_t const n = stored[i];
+        bool const is_leaf = first_leaf <= n;
+
+        node_entry e;
+        e.first = is_leaf ? structure.first_child[n] : position[structure.first_child[n]];
+        e.count = static_cast<boost::uint32_t>(structure.children_count[n]);
+        e.flags = is_leaf ? node_entry::leaf_flag : 0;
+        write_raw(os, offset, e);
+    }
+
+    write_padding(os, offset, h.boxes_offset);
+    for ( boost::uint64_t i = 0 ; i < nodes_count ; ++i )
+        for ( std::size_t j = 0 ; j < box_size ; ++j )
+            write_raw(os, offset, quantized[stored[i] * box_size + j]);
+
+    typedef typename rtree::elements_type<leaf>::type elements_type;
+    typename rtree_view::translator_type const translator = rtv.translator();
+    typename index::detail::strategy_type<typename Rtree::parameters_type>::type const
+        strategy = index::detail::get_strategy(tree.parameters());
+
+    write_padding(os, offset, h.values_offset);
+    for ( boost::uint64_t n = first_leaf ; n < nodes_count ; ++n )
+    {
+        grid_type const grid(decoded[n]);
+        elements_type const& elements = rtree::elements(*v.leafs[n - first_leaf]);
+        for ( typename elements_type::const_iterator it = elements.begin();
+              it != elements.end(); ++it )
+        {
+            box_type b;
+            index::detail::bounds(translator(*it), b, strategy);
+
+            quantized_type q[box_size];
+            grid.encode(b, q);
+            write_raw(os, offset, q);
+        }
+    }
+
+    write_padding(os, offset, h.ids_offset);
+    for ( std::size_t i = 0 ; i < v.leafs.size() ; ++i )
+    {
+        elements_type const& elements = rtree::elements(*v.leafs[i]);
+        for ( typename elements_type::const_iterator it = elements.begin();
+              it != elements.end(); ++it )
+        {
+            Id const id = get_id(*it);
+            write_raw(os, offset, id);
+        }
+    }
+}
+
+inline void write_zeros(std::ostream & os, boost::uint64_t & offset, boost::uint64_t end)
+{
+    while ( offset < end )
+        write_padding(os, offset, (std::min)(end, offset + section_alignment));
+}
+
+// Writes the coordinates of boxes of nodes [first, first + boxes.size())
+// at their positions in the data starting at base.
+template <typename Box>
+inline void write_boxes(std::ostream & os, std::streampos const& base, header const& h,
+                        boost::uint64_t first, std::vector<Box> const& boxes)
+{
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+
+    if ( boxes.empty() )
+        return;
+
+    std::vector<coordinate_type> coordinates(boxes.size());
+    for ( std::size_t d = 0 ; d < dimension ; ++d )
+    {
+        for ( std::size_t i = 0 ; i < boxes.size() ; ++i )
+            coordinates[i] = dispatch::get_box_coordinate<Box, min_corner>::apply(boxes[i], d);
+        os.seekp(base + static_cast<std::streamoff>(h.boxes_offset + 2 * d * h.coordinates_stride
+                                                    + first * sizeof(coordinate_type)));
+        os.write(reinterpret_cast<char const*>(&coordinates[0]),
+                 static_cast<std::streamsize>(coordinates.size() * sizeof(coordinate_type)));
+
+        for ( std::size_t i = 0 ; i < boxes.size() ; ++i )
+            coordinates[i] = dispatch::get_box_coordinate<Box, max_corner>::apply(boxes[i], d);
+        os.seekp(base + static_cast<std::streamoff>(h.boxes_offset + (2 * d + 1) * h.coordinates_stride
+                                                    + first * sizeof(coordinate_type)));
+        os.write(reinterpret_cast<char const*>(&coordinates[0]),
+                 static_cast<std::streamsize>(coordinates.size() * sizeof(coordinate_type)));
+    }
+}
+
+// Calculates the boxes of internal nodes from the boxes of nodes of the lower
+// level passed one by one in the order of the level. The nodes are created
+// sequentially the same way as in pack::apply_sorted().
+template <typename Box, typename Parameters, typename Strategy>
+class levels_boxes
+{
+public:
+    // elements - the numbers of elements of levels, bottom-up, starting from values
+    levels_boxes(std::vector<boost::uint64_t> const& elements,
+                 Parameters const& parameters, Strategy const& strategy)
+        : m_elements(elements), m_parameters(parameters), m_strategy(strategy)
+        , m_boxes(elements.size()), m_states(elements.size())
+    {}
+
+    // Adds the box of the next node of the level, levels are counted from values.
+    void add(std::size_t level, Box const& box)
+    {
+        std::size_t const parent = level + 1;
+        if ( parent == m_elements.size() )
+            return;
+
+        state & s = m_states[parent];
+        if ( s.count == 0 )
+            s.box = box;
+        else
+            index::detail::expand(s.box, box, m_strategy);
+        ++s.count;
+
+        if ( s.count == pack_utils::sequential_node_elements_count(s.node, m_elements[level], m_parameters) )
+        {
+            m_boxes[parent].push_back(s.box);
+            s.count = 0;
+            ++s.node;
+            add(parent, m_boxes[parent].back());
+        }
+    }
+
+    // The boxes of nodes of a level.
+    std::vector<Box> const& boxes(std::size_t level) const { return m_boxes[level]; }
+
+private:
+    struct state
+    {
+        state() : node(0), count(0) {}
+
+        boost::uint64_t node;
+        boost::uint64_t count;
+        Box box;
+    };
+
+    std::vector<boost::uint64_t> const& m_elements;
+    Parameters const& m_parameters;
+    Strategy const& m_strategy;
+    std::vector< std::vector<Box> > m_boxes;
+    std::vector<state> m_states;
+};
+
+// Writes the rtree created from the values read from the source one by one
+// with source.next() in the order of leafs, e.g. from the external sort,
+// directly into the stream in the flat layout in level order. The structure
+// is the same as the one created by pack::apply_sorted_source(). Only the boxes
+// of internal nodes and some of the boxes of leafs are stored in memory.
+// The stream has to be seekable.
+template <typename Value, typename Box, typename Source,
+          typename Parameters, typename Translator, typename Strategy>
+inline void write_sorted(Source & source, boost::uint64_t values_count, std::ostream & os,
+                         Parameters const& parameters, Translator const& translator,
+                         Strategy const& strategy)
+{
+    static const std::size_t leafs_boxes_size = 1024;
+
+    // the values are copied byte by byte, they can't own any resources
+    BOOST_MPL_ASSERT_MSG((boost::has_trivial_destructor<Value>::value),
+                         VALUE_TYPE_CANNOT_BE_STORED_IN_FLAT_LAYOUT,
+                         (Value));
+
+    // the numbers of elements of levels, bottom-up, starting from values
+    boost::uint64_t const max_count = parameters.get_max_elements();
+    std::vector<boost::uint64_t> elements(1, values_count);
+    if ( 0 < values_count )
+    {
+        do
+        {
+            elements.push_back((elements.back() + max_count - 1) / max_count);
+        } while ( 1 < elements.back() );
+    }
+
+    std::size_t const levels_count = elements.size() - 1;
+    std::size_t const leafs_level = 0 < levels_count ? levels_count - 1 : 0;
+
+    // the index of the first node of a level, top-down
+    std::vector<boost::uint64_t> level_first(levels_count + 1, 0);
+    for ( std::size_t l = 0 ; l < levels_count ; ++l )
+        level_first[l + 1] = level_first[l] + elements[levels_count - l];
+    boost::uint64_t const nodes_count = level_first[levels_count];
+
+    header const h = make_header<Value, Box>(values_count, nodes_count, leafs_level, level_node_order);
+    std::streampos const base = os.tellp();
+    boost::uint64_t offset = 0;
+    write_raw(os, offset, h);
+
+    write_padding(os, offset, h.nodes_offset);
+    for ( std::size_t l = 0 ; l < levels_count ; ++l )
+    {
+        bool const is_leaf = l == leafs_level;
+        boost::uint64_t const nodes = elements[levels_count - l];
+        boost::uint64_t const children = elements[levels_count - l - 1];
+
+        boost::uint64_t first = is_leaf ? 0 : level_first[l + 1];
+        for ( boost::uint64_t i = 0 ; i < nodes ; ++i )
+        {
+            node_entry e;
+            e.first = first;
+            e.count = static_cast<boost::uint32_t>(pack_utils::sequential_node_elements_count(i, children, parameters));
+            e.flags = is_leaf ? node_entry::leaf_flag : 0;
+            write_raw(os, offset, e);
+            first += e.count;
+        }
+    }
+
+    // the boxes are written when they're calculated
+    write_zeros(os, offset, h.values_offset);
+
+    boost::uint64_t const leafs_count = elements.size() > 1 ? elements[1] : 0;
+    boost::uint64_t const first_leaf = nodes_count - leafs_count;
+
+    levels_boxes<Box, Parameters, Strategy> levels(elements, parameters, strategy);
+    std::vector<Box> leafs_boxes;
+    leafs_boxes.reserve(leafs_boxes_size);
+    boost::uint64_t leafs_boxes_first = first_leaf;
+
+    for ( boost::uint64_t i = 0 ; i < leafs_count ; ++i )
+    {
+        boost::uint64_t const count = pack_utils::sequential_node_elements_count(i, values_count, parameters);
+
+        Box box;
+        for ( boost::uint64_t j = 0 ; j < count ; ++j )
+        {
+            Value const& v = source.next();
+            write_raw(os, offset, v);
+
+            if ( j == 0 )
+                index::detail::bounds(translator(v), box, strategy);
+            else
+                index::detail::expand(box, translator(v), strategy);
+        }
+
+#ifdef BOOST_GEOMETRY_INDEX_EXPERIMENTAL_ENLARGE_BY_EPSILON
+        // the same as in pack::create_leaf(), the box of the root isn't enlarged
+        if ( BOOST_GEOMETRY_CONDITION((
+                ! index::detail::is_bounding_geometry
+                    <
+                        typename index::detail::indexable_type<Translator>::type
+                    >::value ))
+          && 0 < leafs_level )
+        {
+            geometry::detail::expand_by_epsilon(box);
+        }
+#endif
+
+        leafs_boxes.push_back(box);
+        levels.add(1, box);
+
+        if ( leafs_boxes.size() == leafs_boxes_size || i + 1 == leafs_count )
+        {
+            write_boxes(os, base, h, leafs_boxes_first, leafs_boxes);
+            leafs_boxes_first += leafs_boxes.size();
+            leafs_boxes.clear();
+            os.seekp(base + static_cast<std::streamoff>(offset));
+        }
+    }
+
+    for ( std::size_t level = 2 ; level < elements.size() ; ++level )
+        write_boxes(os, base, h, level_first[levels_count - level], levels.boxes(level));
+
+    os.seekp(base + static_cast<std::streamoff>(offset));
+}
+
+}}}}}} // namespace boost::geometry::index::detail::rtree::flat
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_WRITE_HPP
@@ -0,0 +1,597 @@
+// Boost.Geometry Index
+//
+// R-tree spatial join implementation
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_JOIN_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_JOIN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/predicates.hpp>
+
+#include <boost/geometry/util/parallel.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace join {
+
+// The nodes of both rtrees which bounds intersect.
+template <typename MembersHolderA, typename MembersHolderB>
+struct nodes_pair
+{
+    typedef typename MembersHolderA::node_pointer node_pointer_a;
+    typedef typename MembersHolderB::node_pointer node_pointer_b;
+    typedef typename MembersHolderA::box_type box_type_a;
+    typedef typename MembersHolderB::box_type box_type_b;
+
+    nodes_pair() {}
+
+    nodes_pair(node_pointer_a na, box_type_a const& ba, std::size_t la,
+               node_pointer_b nb, box_type_b const& bb, std::size_t lb)
+        : node_a(na), box_a(ba), level_a(la)
+        , node_b(nb), box_b(bb), level_b(lb)
+    {}
+
+    node_pointer_a node_a;
+    box_type_a box_a;
+    std::size_t level_a;
+    node_pointer_b node_b;
+    box_type_b box_b;
+    std::size_t level_b;
+};
+
+// The bounds of an element and its position in the node.
+template <typename Box>
+struct entry
+{
+    typedef std::pair<Box, std::size_t> type;
+};
+
+struct entry_min_less
+{
+    template <typename Entry>
+    inline bool operator()(Entry const& l, Entry const& r) const
+    {
+        return geometry::get<min_corner, 0>(l.first) < geometry::get<min_corner, 0>(r.first);
+    }
+};
+
+// Checks if the cartesian boxes intersect directly on the coordinates
+// in the dimensions [Dimension, DimensionCount).
+template <std::size_t Dimension, std::size_t DimensionCount>
+struct cartesian_boxes_intersect
+{
+    template <typename Box1, typename Box2>
+    static inline bool apply(Box1 const& b1, Box2 const& b2)
+    {
+        return geometry::get<min_corner, Dimension>(b1) <= geometry::get<max_corner, Dimension>(b2)
+            && geometry::get<min_corner, Dimension>(b2) <= geometry::get<max_corner, Dimension>(b1)
+            && cartesian_boxes_intersect<Dimension + 1, DimensionCount>::apply(b1, b2);
+    }
+};
+
+template <std::size_t DimensionCount>
+struct cartesian_boxes_intersect<DimensionCount, DimensionCount>
+{
+    template <typename Box1, typename Box2>
+    static inline bool apply(Box1 const& , Box2 const& )
+    {
+        return true;
+    }
+};
+
+template <typename IsCartesian>
+struct bounds_intersect
+{
+    template <typename Box1, typename Box2, typename Strategy>
+    static inline bool apply(Box1 const& b1, Box2 const& b2, Strategy const& strategy)
+    {
+        return index::detail::spatial_predicate_call
+            <
+                index::detail::predicates::intersects_tag
+            >::apply(b1, b2, strategy);
+    }
+};
+
+template <>
+struct bounds_intersect<boost::mpl::true_>
+{
+    template <typename Box1, typename Box2, typename Strategy>
+    static inline bool apply(Box1 const& b1, Box2 const& b2, Strategy const& )
+    {
+        return cartesian_boxes_intersect<0, geometry::dimension<Box1>::value>::apply(b1, b2);
+    }
+};
+
+template <typename Geometry>
+struct is_box_or_point
+    : boost::mpl::bool_
+        <
+            boost::is_same<typename tag<Geometry>::type, box_tag>::value
+         || boost::is_same<typename tag<Geometry>::type, point_tag>::value
+        >
+{};
+
+// Calls f(i, j) for each pair of the entries which bounds intersect.
+// In the cartesian coordinate system the entries are sorted by the minimum
+// coordinate in the first dimension and the pairs are found with plane sweep.
+template <typename EntriesA, typename EntriesB, typename Strategy, typename Function>
+inline void intersecting_entries(EntriesA & entries_a, EntriesB & entries_b,
+                                 Strategy const& , Function & f,
+                                 boost::mpl::true_ const& /*is_cartesian*/)
+{
+    typedef typename EntriesA::value_type::first_type box_type;
+    // the boxes overlap in the first dimension
+    typedef cartesian_boxes_intersect<1, geometry::dimension<box_type>::value> intersects_check;
+
+    std::sort(entries_a.begin(), entries_a.end(), entry_min_less());
+    std::sort(entries_b.begin(), entries_b.end(), entry_min_less());
+
+    std::size_t const size_a = entries_a.size();
+    std::size_t const size_b = entries_b.size();
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while ( i < size_a && j < size_b )
+    {
+        if ( geometry::get<min_corner, 0>(entries_a[i].first)
+          <= geometry::get<min_corner, 0>(entries_b[j].first) )
+        {
+            for ( std::size_t k = j ;
+                  k < size_b && geometry::get<min_corner, 0>(entries_b[k].first)
+                             <= geometry::get<max_corner, 0>(entries_a[i].first) ;
+                  ++k )
+            {
+                if ( intersects_check::apply(entries_a[i].first, entries_b[k].first) )
+                    f(entries_a[i].second, entries_b[k].second);
+            }
+            ++i;
+        }
+        else
+        {
+            for ( std::size_t k = i ;
+                  k < size_a && geometry::get<min_corner, 0>(entries_a[k].first)
+                             <= geometry::get<max_corner, 0>(entries_b[j].first) ;
+                  ++k )
+            {
+                if ( intersects_check::apply(entries_a[k].first, entries_b[j].first) )
+                    f(entries_a[k].second, entries_b[j].second);
+            }
+            ++j;
+        }
+    }
+}
+
+template <typename EntriesA, typename EntriesB, typename Strategy, typename Function>
+inline void intersecting_entries(EntriesA & entries_a, EntriesB & entries_b,
+                                 Strategy const& strategy, Function & f,
+                                 boost::mpl::false_ const& /*is_cartesian*/)
+{
+    for ( std::size_t i = 0 ; i < entries_a.size() ; ++i )
+        for ( std::size_t j = 0 ; j < entries_b.size() ; ++j )
+            if ( bounds_intersect<boost::mpl::false_>::apply(entries_a[i].first, entries_b[j].first, strategy) )
+                f(entries_a[i].second, entries_b[j].second);
+}
+
+// Synchronized traversal of two rtrees. Only the pairs of nodes which bounds
+// intersect are traversed. The elements of the nodes which don't intersect
+// the bounds of the other node are skipped and the pairs of the remaining
+// elements are found with plane sweep. Then the pairs of values meeting
+// the predicate are written to the output iterator.
+template <typename MembersHolderA, typename MembersHolderB, typename Tag, typename OutIter>
+class spatial_join
+{
+public:
+    typedef nodes_pair<MembersHolderA, MembersHolderB> nodes_pair_type;
+
+    typedef typename MembersHolderA::value_type value_type_a;
+    typedef typename MembersHolderB::value_type value_type_b;
+    typedef typename MembersHolderA::box_type box_type_a;
+    typedef typename MembersHolderB::box_type box_type_b;
+    typedef typename MembersHolderA::internal_node internal_node_a;
+    typedef typename MembersHolderB::internal_node internal_node_b;
+    typedef typename MembersHolderA::leaf leaf_a;
+    typedef typename MembersHolderB::leaf leaf_b;
+
+    typedef typename index::detail::strategy_type
+        <
+            typename MembersHolderA::parameters_type
+        >::type strategy_type;
+
+    typedef typename entry<box_type_a>::type entry_a;
+    typedef typename entry<box_type_b>::type entry_b;
+
+    typedef boost::mpl::bool_
+        <
+            boost::is_same<typename cs_tag<box_type_a>::type, cartesian_tag>::value
+        > is_cartesian;
+
+    typedef typename index::detail::indexable_type
+        <
+            typename MembersHolderA::translator_type
+        >::type indexable_type_a;
+    typedef typename index::detail::indexable_type
+        <
+            typename MembersHolderB::translator_type
+        >::type indexable_type_b;
+
+    // The intersection of cartesian Boxes and Points is the intersection of
+    // their bounds so it's already checked by the traversal. Two Points are
+    // compared WRT epsilon by intersects() so this case is excluded.
+    typedef boost::mpl::bool_
+        <
+            is_cartesian::value
+         && boost::is_same<Tag, index::detail::predicates::intersects_tag>::value
+         && is_box_or_point<indexable_type_a>::value
+         && is_box_or_point<indexable_type_b>::value
+         && ! (boost::is_same<typename tag<indexable_type_a>::type, point_tag>::value
+            && boost::is_same<typename tag<indexable_type_b>::type, point_tag>::value)
+        > is_bounds_check_exact;
+
+    inline spatial_join(MembersHolderA const& members_a, MembersHolderB const& members_b, OutIter out_it)
+        : m_members_a(members_a)
+        , m_members_b(members_b)
+        , m_strategy(index::detail::get_strategy(members_a.parameters()))
+        , m_out_iter(out_it)
+        , m_found_count(0)
+        , m_depth(0)
+    {
+        // one pair of buffers for each level on which both nodes are traversed
+        std::size_t const levels = (std::min)(std::size_t(members_a.leafs_level),
+                                              std::size_t(members_b.leafs_level)) + 1;
+        m_entries_a.resize(levels);
+        m_entries_b.resize(levels);
+    }
+
+    // Joins the subtrees of the nodes.
+    inline void apply(nodes_pair_type const& p)
+    {
+        if ( is_leaf_a(p) && is_leaf_b(p) )
+        {
+            join_values(p);
+        }
+        else
+        {
+            join_visitor v(*this);
+            children_pairs(p, v);
+        }
+    }
+
+    // Replaces the pair of nodes with the pairs of their children,
+    // the pair of leafs isn't replaced. Returns false for the pair of leafs.
+    inline bool split(nodes_pair_type const& p, std::vector<nodes_pair_type> & result)
+    {
+        if ( is_leaf_a(p) && is_leaf_b(p) )
+        {
+            result.push_back(p);
+            return false;
+        }
+
+        push_back_visitor v(result);
+        children_pairs(p, v);
+        return true;
+    }
+
+    inline std::size_t found_count() const
+    {
+        return m_found_count;
+    }
+
+    inline OutIter out_iter() const
+    {
+        return m_out_iter;
+    }
+
+private:
+    struct join_visitor
+    {
+        explicit join_visitor(spatial_join & j) : joiner(j) {}
+        void operator()(nodes_pair_type const& p) { joiner.apply(p); }
+        spatial_join & joiner;
+    };
+
+    struct push_back_visitor
+    {
+        explicit push_back_visitor(std::vector<nodes_pair_type> & r) : result(r) {}
+        void operator()(nodes_pair_type const& p) { result.push_back(p); }
+        std::vector<nodes_pair_type> & result;
+    };
+
+    template <typename Visitor>
+    struct children_visitor
+    {
+        children_visitor(internal_node_a const& na, std::size_t la,
+                         internal_node_b const& nb, std::size_t lb,
+                         Visitor & v)
+            : node_a(na), level_a(la), node_b(nb), level_b(lb), visitor(v)
+        {}
+
+        void operator()(std::size_t i, std::size_t j)
+        {
+            visitor(nodes_pair_type(rtree::elements(node_a)[i].second, rtree::elements(node_a)[i].first, level_a,
+                                    rtree::elements(node_b)[j].second, rtree::elements(node_b)[j].first, level_b));
+        }
+
+        internal_node_a const& node_a;
+        std::size_t level_a;
+        internal_node_b const& node_b;
+        std::size_t level_b;
+        Visitor & visitor;
+    };
+
+    struct values_visitor
+    {
+        values_visitor(leaf_a const& na, leaf_b const& nb, spatial_join & sj)
+            : node_a(na), node_b(nb), joiner(sj)
+        {}
+
+        void operator()(std::size_t i, std::size_t j)
+        {
+            joiner.check_values(rtree::elements(node_a)[i], rtree::elements(node_b)[j]);
+        }
+
+        leaf_a const& node_a;
+        leaf_b const& node_b;
+        spatial_join & joiner;
+    };
+
+    inline bool is_leaf_a(nodes_pair_type const& p) const
+    {
+        return p.level_a == m_members_a.leafs_level;
+    }
+
+    inline bool is_leaf_b(nodes_pair_type const& p) const
+    {
+        return p.level_b == m_members_b.leafs_level;
+    }
+
+    // Passes the pairs of children which bounds intersect to the visitor.
+    // If one of the nodes is a leaf only the other one is traversed.
+    template <typename Visitor>
+    inline void children_pairs(nodes_pair_type const& p, Visitor & visitor)
+    {
+        if ( is_leaf_b(p) )
+        {
+            internal_node_a const& n = rtree::get<internal_node_a>(*p.node_a);
+            for ( std::size_t i = 0 ; i < rtree::elements(n).size() ; ++i )
+            {
+                if ( bounds_intersect<is_cartesian>::apply(rtree::elements(n)[i].first, p.box_b, m_strategy) )
+                    visitor(nodes_pair_type(rtree::elements(n)[i].second, rtree::elements(n)[i].first, p.level_a + 1,
+                                            p.node_b, p.box_b, p.level_b));
+            }
+        }
+        else if ( is_leaf_a(p) )
+        {
+            internal_node_b const& n = rtree::get<internal_node_b>(*p.node_b);
+            for ( std::size_t i = 0 ; i < rtree::elements(n).size() ; ++i )
+            {
+                if ( bounds_intersect<is_cartesian>::apply(p.box_a, rtree::elements(n)[i].first, m_strategy) )
+                    visitor(nodes_pair_type(p.node_a, p.box_a, p.level_a,
+                                            rtree::elements(n)[i].second, rtree::elements(n)[i].first, p.level_b + 1));
+            }
+        }
+        else
+        {
+            internal_node_a const& na = rtree::get<internal_node_a>(*p.node_a);
+            internal_node_b const& nb = rtree::get<internal_node_b>(*p.node_b);
+
+            std::vector<entry_a> & entries_a = m_entries_a[m_depth];
+            std::vector<entry_b> & entries_b = m_entries_b[m_depth];
+            internal_entries(rtree::elements(na), p.box_b, entries_a);
+            internal_entries(rtree::elements(nb), p.box_a, entries_b);
+
+            children_visitor<Visitor> v(na, p.level_a + 1, nb, p.level_b + 1, visitor);
+
+            ++m_depth;
+            intersecting_entries(entries_a, entries_b, m_strategy, v, is_cartesian());
+            --m_depth;
+        }
+    }
+
+    inline void join_values(nodes_pair_type const& p)
+    {
+        leaf_a const& na = rtree::get<leaf_a>(*p.node_a);
+        leaf_b const& nb = rtree::get<leaf_b>(*p.node_b);
+
+        std::vector<entry_a> & entries_a = m_entries_a[m_depth];
+        std::vector<entry_b> & entries_b = m_entries_b[m_depth];
+        values_entries(rtree::elements(na), m_members_a.translator(), p.box_b, entries_a);
+        values_entries(rtree::elements(nb), m_members_b.translator(), p.box_a, entries_b);
+
+        values_visitor v(na, nb, *this);
+        intersecting_entries(entries_a, entries_b, m_strategy, v, is_cartesian());
+    }
+
+    // The elements of internal node intersecting the bounds of the other node.
+    template <typename Elements, typename OtherBox, typename Entries>
+    inline void internal_entries(Elements const& elements, OtherBox const& other_box, Entries & entries) const
+    {
+        entries.clear();
+        for ( std::size_t i = 0 ; i < elements.size() ; ++i )
+        {
+            if ( bounds_intersect<is_cartesian>::apply(elements[i].first, other_box, m_strategy) )
+                entries.push_back(typename Entries::value_type(elements[i].first, i));
+        }
+    }
+
+    // The values of leaf which bounds intersect the bounds of the other node.
+    template <typename Elements, typename Translator, typename OtherBox, typename Entries>
+    inline void values_entries(Elements const& elements, Translator const& tr,
+                               OtherBox const& other_box, Entries & entries) const
+    {
+        typedef typename Entries::value_type::first_type box_type;
+
+        entries.clear();
+        for ( std::size_t i = 0 ; i < elements.size() ; ++i )
+        {
+            box_type b;
+            index::detail::bounds(tr(elements[i]), b, m_strategy);
+            if ( bounds_intersect<is_cartesian>::apply(b, other_box, m_strategy) )
+                entries.push_back(typename Entries::value_type(b, i));
+        }
+    }
+
+    inline void check_values(value_type_a const& va, value_type_b const& vb)
+    {
+        if ( predicate_check(va, vb, is_bounds_check_exact()) )
+        {
+            *m_out_iter = std::pair<value_type_a, value_type_b>(va, vb);
+            ++m_out_iter;
+            ++m_found_count;
+        }
+    }
+
+    inline bool predicate_check(value_type_a const& va, value_type_b const& vb,
+                                boost::mpl::false_ const& /*is_bounds_check_exact*/) const
+    {
+        return index::detail::spatial_predicate_call<Tag>::apply(m_members_a.translator()(va),
+                                                                m_members_b.translator()(vb),
+                                                                m_strategy);
+    }
+
+    inline bool predicate_check(value_type_a const& , value_type_b const& ,
+                                boost::mpl::true_ const& /*is_bounds_check_exact*/) const
+    {
+        return true;
+    }
+
+    MembersHolderA const& m_members_a;
+    MembersHolderB const& m_members_b;
+    strategy_type m_strategy;
+    OutIter m_out_iter;
+    std::size_t m_found_count;
+
+    std::vector< std::vector<entry_a> > m_entries_a;
+    std::vector< std::vector<entry_b> > m_entries_b;
+    std::size_t m_depth;
+};
+
+template <typename Tag, typename MembersHolderA, typename MembersHolderB, typename OutIter>
+inline std::size_t apply(MembersHolderA const& members_a, typename MembersHolderA::box_type const& bounds_a,
+                         MembersHolderB const& members_b, typename MembersHolderB::box_type const& bounds_b,
+                         OutIter out_it)
+{
+    typedef spatial_join<MembersHolderA, MembersHolderB, Tag, OutIter> join_type;
+    typedef typename join_type::nodes_pair_type nodes_pair_type;
+
+    join_type joiner(members_a, members_b, out_it);
+    joiner.apply(nodes_pair_type(members_a.root, bounds_a, 0, members_b.root, bounds_b, 0));
+    return joiner.found_count();
+}
+
+// The pairs of nodes are split until there are several pairs for each thread.
+// Then the pairs are joined concurrently, each thread writes the pairs of values
+// into its own buffer and the buffers are copied to the output iterator.
+// The output iterator may be used by one thread only so the copying isn't
+// parallel, it's linear in the number of pairs found.
+template <typename MembersHolderA, typename MembersHolderB, typename Tag>
+class parallel_join
+{
+public:
+    typedef std::pair
+        <
+            typename MembersHolderA::value_type,
+            typename MembersHolderB::value_type
+        > result_type;
+    typedef std::back_insert_iterator< std::vector<result_type> > buffer_iterator;
+    typedef spatial_join<MembersHolderA, MembersHolderB, Tag, buffer_iterator> join_type;
+    typedef typename join_type::nodes_pair_type nodes_pair_type;
+
+    static const std::size_t pairs_per_thread = 16;
+
+    template <typename OutIter>
+    static inline std::size_t apply(MembersHolderA const& members_a, typename MembersHolderA::box_type const& bounds_a,
+                                    MembersHolderB const& members_b, typename MembersHolderB::box_type const& bounds_b,
+                                    OutIter out_it, std::size_t threads)
+    {
+        std::vector<nodes_pair_type> pairs;
+        pairs.push_back(nodes_pair_type(members_a.root, bounds_a, 0, members_b.root, bounds_b, 0));
+
+        {
+            std::vector<result_type> dummy;
+            join_type joiner(members_a, members_b, std::back_inserter(dummy));
+            std::vector<nodes_pair_type> next;
+            while ( pairs.size() < threads * pairs_per_thread )
+            {
+                next.clear();
+                bool split = false;
+                for ( std::size_t i = 0 ; i < pairs.size() ; ++i )
+                    split = joiner.split(pairs[i], next) || split;
+
+                pairs.swap(next);
+                // only the pairs of leafs left
+                if ( ! split )
+                    break;
+            }
+        }
+
+        std::size_t const tasks_count = (std::min)(threads, pairs.size());
+        std::vector< std::vector<result_type> > buffers(tasks_count);
+        {
+            geometry::detail::parallel::task_group tasks;
+            for ( std::size_t t = 1 ; t < tasks_count ; ++t )
+                tasks.run(task(members_a, members_b, pairs, t, tasks_count, buffers[t]));
+            if ( tasks_count > 0 )
+                task(members_a, members_b, pairs, 0, tasks_count, buffers[0])();
+            tasks.wait();
+        }
+
+        std::size_t result = 0;
+        for ( std::size_t t = 0 ; t < tasks_count ; ++t )
+        {
+            out_it = std::copy(buffers[t].begin(), buffers[t].end(), out_it);
+            result += buffers[t].size();
+        }
+        return result;
+    }
+
+private:
+    // Joins every tasks_count-th pair of nodes starting from task_index.
+    struct task
+    {
+        task(MembersHolderA const& ma, MembersHolderB const& mb,
+             std::vector<nodes_pair_type> const& p,
+             std::size_t ti, std::size_t tc,
+             std::vector<result_type> & b)
+            : members_a(&ma), members_b(&mb), pairs(&p)
+            , task_index(ti), tasks_count(tc), buffer(&b)
+        {}
+
+        void operator()() const
+        {
+            join_type joiner(*members_a, *members_b, std::back_inserter(*buffer));
+            for ( std::size_t i = task_index ; i < pairs->size() ; i += tasks_count )
+                joiner.apply((*pairs)[i]);
+        }
+
+        MembersHolderA const* members_a;
+        MembersHolderB const* members_b;
+        std::vector<nodes_pair_type> const* pairs;
+        std::size_t task_index;
+        std::size_t tasks_count;
+        std::vector<result_type> * buffer;
+    };
+};
+
+}}} // namespace detail::rtree::join
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_JOIN_HPP
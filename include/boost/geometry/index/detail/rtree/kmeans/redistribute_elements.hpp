@@ -0,0 +1,368 @@
+// Boost.Geometry Index
+//
+// R-tree k-means split algorithm implementation
+//
+// Copyright (c) 2011-2013 Adam Wulkiewicz, Lodz, Poland.
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_KMEANS_REDISTRIBUTE_ELEMENTS_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_KMEANS_REDISTRIBUTE_ELEMENTS_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/algorithms/content.hpp>
+#include <boost/geometry/index/detail/algorithms/intersection_content.hpp>
+
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/insert.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/is_leaf.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree {
+
+namespace kmeans {
+
+// The maximum number of Lloyd's iterations performed for one split.
+// The assignment of M+1 elements converges in a few iterations in practice.
+static const size_t max_iterations = 16;
+
+template <typename Box, size_t I = 0, size_t D = geometry::dimension<Box>::value>
+struct box_center
+{
+    template <typename T>
+    static inline void apply(Box const& b, T * center)
+    {
+        center[I] = (T(geometry::get<min_corner, I>(b)) + T(geometry::get<max_corner, I>(b))) / T(2);
+        box_center<Box, I + 1, D>::apply(b, center);
+    }
+};
+
+template <typename Box, size_t D>
+struct box_center<Box, D, D>
+{
+    template <typename T>
+    static inline void apply(Box const& , T * ) {}
+};
+
+template <typename T>
+inline T squared_distance(T const* p1, T const* p2, size_t dimension)
+{
+    T result = 0;
+    for ( size_t d = 0 ; d < dimension ; ++d )
+    {
+        T const diff = p1[d] - p2[d];
+        result += diff * diff;
+    }
+    return result;
+}
+
+template <typename T>
+inline size_t farthest(std::vector<T> const& centers, T const* from, size_t dimension)
+{
+    size_t const count = centers.size() / dimension;
+    size_t result = 0;
+    T greatest_distance = -1;
+    for ( size_t i = 0 ; i < count ; ++i )
+    {
+        T const dist = squared_distance(&centers[i * dimension], from, dimension);
+        if ( greatest_distance < dist )
+        {
+            greatest_distance = dist;
+            result = i;
+        }
+    }
+    return result;
+}
+
+template <typename T>
+struct less_difference
+{
+    explicit less_difference(std::vector<T> const& differences)
+        : m_differences(differences)
+    {}
+
+    bool operator()(size_t i, size_t j) const
+    {
+        return m_differences[i] < m_differences[j]
+            || ( m_differences[i] == m_differences[j] && i < j );
+    }
+
+    std::vector<T> const& m_differences;
+};
+
+// The elements are sorted by the difference of the squared distances to both
+// means. The clusters are adjusted by choosing the position in this order
+// dividing the elements into the groups with the least overlap and then
+// the least total content. On ties the position found by k-means is kept.
+template <typename Box, typename Strategy>
+inline void choose_split_position(std::vector<Box> const& boxes,
+                                  std::vector<size_t> const& order,
+                                  size_t min_elements,
+                                  Strategy const& strategy,
+                                  std::vector<bool> & in_first)
+{
+    typedef typename index::detail::default_content_result<Box>::type content_type;
+
+    size_t const elements_count = order.size();
+
+    size_t first_count = 0;
+    for ( size_t i = 0 ; i < elements_count ; ++i )
+        if ( in_first[i] )
+            ++first_count;
+
+    // suffixes[i] contains elements order[i], ..., order[count-1]
+    std::vector<Box> suffixes(elements_count);                                                          // MAY THROW, STRONG (alloc)
+    suffixes[elements_count - 1] = boxes[order[elements_count - 1]];
+    for ( size_t i = elements_count - 1 ; i > 0 ; --i )
+    {
+        suffixes[i - 1] = suffixes[i];
+        index::detail::expand(suffixes[i - 1], boxes[order[i - 1]], strategy);
+    }
+
+    Box prefix = boxes[order[0]];
+    for ( size_t i = 1 ; i < min_elements ; ++i )
+        index::detail::expand(prefix, boxes[order[i]], strategy);
+
+    size_t best_count = first_count;
+    content_type smallest_overlap = 0;
+    content_type smallest_content = 0;
+    bool found = false;
+
+    for ( size_t count = min_elements ; count + min_elements <= elements_count ; ++count )
+    {
+        if ( min_elements < count )
+            index::detail::expand(prefix, boxes[order[count - 1]], strategy);
+
+        content_type const overlap = index::detail::intersection_content(prefix, suffixes[count], strategy);
+        content_type const content = index::detail::content(prefix) + index::detail::content(suffixes[count]);
+
+        if ( ! found
+          || overlap < smallest_overlap
+          || ( overlap == smallest_overlap && content < smallest_content )
+          || ( overlap == smallest_overlap && content == smallest_content && count == first_count ) )
+        {
+            found = true;
+            smallest_overlap = overlap;
+            smallest_content = content;
+            best_count = count;
+        }
+    }
+
+    for ( size_t i = 0 ; i < elements_count ; ++i )
+        in_first[order[i]] = i < best_count;
+}
+
+// Divides the elements into two clusters with k-means algorithm (k = 2)
+// applied to the centers of the elements' bounding boxes. The seeds are the
+// element farthest from the mean center and the element farthest from it.
+// In each iteration the elements are sorted by the difference of the squared
+// distances to both means and the leading ones form the first cluster so its
+// size can be clamped to [min, count-min] without breaking the order.
+// Finally the position dividing the clusters is adjusted in this order.
+template <typename Box, typename Elements, typename Parameters, typename Translator>
+inline void assign_clusters(Elements const& elements,
+                            Parameters const& parameters,
+                            Translator const& tr,
+                            std::vector<bool> & in_first)
+{
+    typedef typename geometry::select_most_precise
+        <
+            typename geometry::coordinate_type<Box>::type,
+            double
+        >::type calc_type;
+
+    static const size_t dimension = geometry::dimension<Box>::value;
+
+    size_t const elements_count = elements.size();
+    size_t const min_elements = parameters.get_min_elements();
+
+    BOOST_GEOMETRY_INDEX_ASSERT(2 <= elements_count, "unexpected number of elements");
+    BOOST_GEOMETRY_INDEX_ASSERT(2 * min_elements <= elements_count, "unexpected number of elements");
+
+    typename index::detail::strategy_type<Parameters>::type const&
+        strategy = index::detail::get_strategy(parameters);
+
+    std::vector<calc_type> centers(elements_count * dimension);                                         // MAY THROW, STRONG (alloc)
+    std::vector<Box> boxes(elements_count);                                                             // MAY THROW, STRONG (alloc)
+    calc_type mean1[dimension] = {};
+    calc_type mean2[dimension] = {};
+
+    for ( size_t i = 0 ; i < elements_count ; ++i )
+    {
+        index::detail::bounds(rtree::element_indexable(elements[i], tr), boxes[i], strategy);
+        box_center<Box>::apply(boxes[i], &centers[i * dimension]);
+
+        for ( size_t d = 0 ; d < dimension ; ++d )
+            mean1[d] += centers[i * dimension + d];
+    }
+    for ( size_t d = 0 ; d < dimension ; ++d )
+        mean1[d] /= calc_type(elements_count);
+
+    // pick seeds
+    size_t const seed1 = farthest(centers, mean1, dimension);
+    size_t seed2 = farthest(centers, &centers[seed1 * dimension], dimension);
+    if ( seed1 == seed2 )
+        seed2 = seed1 == 0 ? 1 : 0;
+
+    std::copy(&centers[seed1 * dimension], &centers[seed1 * dimension] + dimension, mean1);
+    std::copy(&centers[seed2 * dimension], &centers[seed2 * dimension] + dimension, mean2);
+
+    std::vector<calc_type> differences(elements_count);                                                 // MAY THROW, STRONG (alloc)
+    std::vector<size_t> order(elements_count);                                                          // MAY THROW, STRONG (alloc)
+    in_first.assign(elements_count, false);                                                             // MAY THROW, STRONG (alloc)
+
+    for ( size_t iteration = 0 ; iteration < max_iterations ; ++iteration )
+    {
+        // assignment step
+        size_t closer_to_first = 0;
+        for ( size_t i = 0 ; i < elements_count ; ++i )
+        {
+            calc_type const* center = &centers[i * dimension];
+            differences[i] = squared_distance(center, mean1, dimension)
+                           - squared_distance(center, mean2, dimension);
+            if ( differences[i] < 0 )
+                ++closer_to_first;
+            order[i] = i;
+        }
+
+        std::sort(order.begin(), order.end(), less_difference<calc_type>(differences));
+
+        size_t const first_count = (std::min)((std::max)(closer_to_first, min_elements),
+                                              elements_count - min_elements);
+
+        bool changed = false;
+        for ( size_t i = 0 ; i < elements_count ; ++i )
+        {
+            bool const first = i < first_count;
+            if ( in_first[order[i]] != first )
+            {
+                in_first[order[i]] = first;
+                changed = true;
+            }
+        }
+
+        if ( ! changed )
+            break;
+
+        // update step
+        std::fill(mean1, mean1 + dimension, calc_type(0));
+        std::fill(mean2, mean2 + dimension, calc_type(0));
+        for ( size_t i = 0 ; i < elements_count ; ++i )
+        {
+            calc_type * mean = in_first[i] ? mean1 : mean2;
+            for ( size_t d = 0 ; d < dimension ; ++d )
+                mean[d] += centers[i * dimension + d];
+        }
+        for ( size_t d = 0 ; d < dimension ; ++d )
+        {
+            mean1[d] /= calc_type(first_count);
+            mean2[d] /= calc_type(elements_count - first_count);
+        }
+    }
+
+    choose_split_position(boxes, order, min_elements, strategy, in_first);
+}
+
+} // namespace kmeans
+
+template <typename MembersHolder>
+struct redistribute_elements<MembersHolder, kmeans_tag>
+{
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    template <typename Node>
+    static inline void apply(Node & n,
+                             Node & second_node,
+                             box_type & box1,
+                             box_type & box2,
+                             parameters_type const& parameters,
+                             translator_type const& translator,
+                             allocators_type & allocators)
+    {
+        typedef typename rtree::elements_type<Node>::type elements_type;
+        typedef typename elements_type::value_type element_type;
+
+        elements_type & elements1 = rtree::elements(n);
+        elements_type & elements2 = rtree::elements(second_node);
+
+        BOOST_GEOMETRY_INDEX_ASSERT(elements1.size() == parameters.get_max_elements() + 1, "unexpected elements number");
+
+        // copy original elements - use in-memory storage (std::allocator)
+        typedef typename rtree::container_from_elements_type<elements_type, element_type>::type
+            container_type;
+        container_type elements_copy(elements1.begin(), elements1.end());                                   // MAY THROW, STRONG (alloc, copy)
+
+        // divide the elements into clusters
+        std::vector<bool> in_first;
+        kmeans::assign_clusters<box_type>(elements_copy, parameters, translator, in_first);                // MAY THROW, STRONG (alloc)
+
+        // prepare nodes' elements containers
+        elements1.clear();
+        BOOST_GEOMETRY_INDEX_ASSERT(elements2.empty(), "second node's elements container should be empty");
+
+        BOOST_TRY
+        {
+            typename index::detail::strategy_type<parameters_type>::type const&
+                strategy = index::detail::get_strategy(parameters);
+
+            for ( size_t i = 0 ; i < elements_copy.size() ; ++i )
+            {
+                element_type const& elem = elements_copy[i];
+
+                if ( in_first[i] )
+                {
+                    if ( elements1.empty() )
+                        index::detail::bounds(rtree::element_indexable(elem, translator), box1, strategy);
+                    else
+                        index::detail::expand(box1, rtree::element_indexable(elem, translator), strategy);
+
+                    elements1.push_back(elem);                                                              // MAY THROW, STRONG (copy)
+                }
+                else
+                {
+                    if ( elements2.empty() )
+                        index::detail::bounds(rtree::element_indexable(elem, translator), box2, strategy);
+                    else
+                        index::detail::expand(box2, rtree::element_indexable(elem, translator), strategy);
+
+                    elements2.push_back(elem);                                                              // MAY THROW, STRONG (alloc, copy)
+                }
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            elements1.clear();
+            elements2.clear();
+
+            rtree::destroy_elements<MembersHolder>::apply(elements_copy, allocators);
+
+            BOOST_RETHROW                                                                                     // RETHROW, BASIC
+        }
+        BOOST_CATCH_END
+    }
+};
+
+}} // namespace detail::rtree
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_KMEANS_REDISTRIBUTE_ELEMENTS_HPP
@@ -0,0 +1,39 @@
+// Boost.Geometry Index
+//
+// R-tree members access
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_MEMBERS_ACCESS_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_MEMBERS_ACCESS_HPP
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree {
+
+// Gives the containers built on top of the rtree access to its internals.
+template <typename Rtree>
+struct members_access
+{
+    typedef typename Rtree::members_holder members_holder;
+
+    static inline members_holder & get(Rtree & rt)
+    {
+        return rt.m_members;
+    }
+
+    static inline members_holder const& get(Rtree const& rt)
+    {
+        return rt.m_members;
+    }
+};
+
+}} // namespace detail::rtree
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_MEMBERS_ACCESS_HPP
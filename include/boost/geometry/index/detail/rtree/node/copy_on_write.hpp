@@ -0,0 +1,385 @@
+// Boost.Geometry Index
+//
+// R-tree copy-on-write nodes
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_NODE_COPY_ON_WRITE_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_NODE_COPY_ON_WRITE_HPP
+
+#include <vector>
+
+#include <boost/container/allocator_traits.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/core/pointer_traits.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+#include <boost/unordered_set.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree {
+
+// The state of the modification of a tree whose nodes may be shared with
+// the readers of its previous versions. The nodes allocated during the
+// modification are owned by the writer and can be modified in place.
+// Other nodes are shared, they are copied before the modification and
+// the original ones are retired.
+class copy_on_write_context
+{
+    copy_on_write_context(copy_on_write_context const&);
+    copy_on_write_context & operator=(copy_on_write_context const&);
+
+public:
+    copy_on_write_context()
+        : m_enabled(true)
+    {}
+
+    void allocated(void const* p)
+    {
+        if ( m_enabled )
+            m_owned.insert(p);                                                                  // MAY THROW (alloc)
+    }
+
+    void deallocated(void const* p)
+    {
+        if ( m_enabled )
+            m_owned.erase(p);
+    }
+
+    bool is_shared(void const* p) const
+    {
+        return m_enabled && m_owned.find(p) == m_owned.end();
+    }
+
+    // Stores the node replaced by its copy.
+    void retire(void * p)
+    {
+        m_retired.push_back(p);                                                                 // MAY THROW, STRONG (alloc)
+    }
+
+    std::vector<void*> & retired()
+    {
+        return m_retired;
+    }
+
+    // The modified nodes are published and become shared.
+    void publish()
+    {
+        m_owned.clear();
+        m_retired.clear();
+    }
+
+    // The nodes are no longer shared, e.g. before the destruction of the tree.
+    void disable()
+    {
+        m_enabled = false;
+        m_owned.clear();
+        m_retired.clear();
+    }
+
+private:
+    boost::unordered_set<void const*> m_owned;
+    std::vector<void*> m_retired;
+    bool m_enabled;
+};
+
+// The base of copy_on_write_allocator storing the context.
+class copy_on_write_allocator_base
+{
+public:
+    explicit copy_on_write_allocator_base(copy_on_write_context * context)
+        : m_context(context)
+    {}
+
+    copy_on_write_context * context() const { return m_context; }
+
+protected:
+    copy_on_write_context * m_context;
+};
+
+// The allocator notifying the context about allocated and deallocated memory.
+template <typename Allocator>
+class copy_on_write_allocator
+    : public Allocator
+    , public copy_on_write_allocator_base
+{
+    typedef boost::container::allocator_traits<Allocator> traits;
+
+public:
+    typedef typename traits::value_type value_type;
+    typedef typename traits::pointer pointer;
+    typedef typename traits::const_pointer const_pointer;
+    typedef typename traits::reference reference;
+    typedef typename traits::const_reference const_reference;
+    typedef typename traits::size_type size_type;
+    typedef typename traits::difference_type difference_type;
+
+    template <typename T>
+    struct rebind
+    {
+        typedef copy_on_write_allocator<typename traits::template portable_rebind_alloc<T>::type> other;
+    };
+
+    copy_on_write_allocator()
+        : Allocator(), copy_on_write_allocator_base(0)
+    {}
+
+    copy_on_write_allocator(Allocator const& alloc, copy_on_write_context * context)
+        : Allocator(alloc), copy_on_write_allocator_base(context)
+    {}
+
+    template <typename OtherAllocator>
+    copy_on_write_allocator(copy_on_write_allocator<OtherAllocator> const& other)
+        : Allocator(other.base()), copy_on_write_allocator_base(other.context())
+    {}
+
+    pointer allocate(size_type n)
+    {
+        pointer p = traits::allocate(base(), n);                                                // MAY THROW (alloc)
+        if ( m_context )
+        {
+            BOOST_TRY
+            {
+                m_context->allocated(boost::to_address(p));                                     // MAY THROW (alloc)
+            }
+            BOOST_CATCH(...)
+            {
+                traits::deallocate(base(), p, n);
+                BOOST_RETHROW
+            }
+            BOOST_CATCH_END
+        }
+        return p;
+    }
+
+    void deallocate(pointer p, size_type n)
+    {
+        if ( m_context )
+            m_context->deallocated(boost::to_address(p));
+        traits::deallocate(base(), p, n);
+    }
+
+    Allocator & base() { return *this; }
+    Allocator const& base() const { return *this; }
+
+    bool operator==(copy_on_write_allocator const& other) const
+    {
+        return base() == other.base() && m_context == other.m_context;
+    }
+
+    bool operator!=(copy_on_write_allocator const& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// In C++03 the rebound allocators are derived from copy_on_write_allocator
+// so the base class is checked instead of the exact type.
+template <typename Allocator>
+inline copy_on_write_context * get_copy_on_write_context(Allocator const& ,
+                                                         boost::false_type /*is_copy_on_write*/)
+{
+    return 0;
+}
+
+template <typename Allocator>
+inline copy_on_write_context * get_copy_on_write_context(Allocator const& alloc,
+                                                         boost::true_type /*is_copy_on_write*/)
+{
+    return static_cast<copy_on_write_allocator_base const&>(alloc).context();
+}
+
+template <typename Allocator>
+inline copy_on_write_context * get_copy_on_write_context(Allocator const& alloc)
+{
+    return get_copy_on_write_context(alloc,
+        boost::is_base_of<copy_on_write_allocator_base, Allocator>());
+}
+
+// Checks if the node may be read by other threads and can't be modified.
+// Always false for other allocators than copy_on_write_allocator.
+template <typename Allocators, typename NodePointer>
+inline bool is_shared_node(NodePointer const& node, Allocators const& allocators)
+{
+    copy_on_write_context const* context = get_copy_on_write_context(allocators.node_allocator());
+    return context != 0 && context->is_shared(boost::to_address(node));
+}
+
+namespace visitors {
+
+// Creates a copy of a node without copying its children.
+template <typename MembersHolder>
+class shallow_copy
+    : public MembersHolder::visitor
+{
+    typedef typename MembersHolder::allocators_type allocators_type;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+    typedef typename allocators_type::node_pointer node_pointer;
+
+public:
+    explicit inline shallow_copy(allocators_type & allocators)
+        : result(0)
+        , m_allocators(allocators)
+    {}
+
+    inline void operator()(internal_node & n)
+    {
+        apply(n);
+    }
+
+    inline void operator()(leaf & l)
+    {
+        apply(l);
+    }
+
+    node_pointer result;
+
+private:
+    template <typename Node>
+    inline void apply(Node & n)
+    {
+        node_pointer new_node = rtree::create_node<allocators_type, Node>::apply(m_allocators);     // MAY THROW, STRONG (N: alloc)
+
+        BOOST_TRY
+        {
+            rtree::elements(rtree::get<Node>(*new_node)) = rtree::elements(n);                        // MAY THROW, STRONG (V, E: alloc, copy)
+        }
+        BOOST_CATCH(...)
+        {
+            rtree::destroy_node<allocators_type, Node>::apply(m_allocators, new_node);
+            BOOST_RETHROW
+        }
+        BOOST_CATCH_END
+
+        result = new_node;
+    }
+
+    allocators_type & m_allocators;
+};
+
+// Destroys a single node without its children.
+template <typename MembersHolder>
+class destroy_single_node
+    : public MembersHolder::visitor
+{
+    typedef typename MembersHolder::allocators_type allocators_type;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+    typedef typename allocators_type::node_pointer node_pointer;
+
+public:
+    inline destroy_single_node(node_pointer node, allocators_type & allocators)
+        : m_node(node)
+        , m_allocators(allocators)
+    {}
+
+    inline void operator()(internal_node & )
+    {
+        rtree::destroy_node<allocators_type, internal_node>::apply(m_allocators, m_node);
+    }
+
+    inline void operator()(leaf & )
+    {
+        rtree::destroy_node<allocators_type, leaf>::apply(m_allocators, m_node);
+    }
+
+    static inline void apply(node_pointer node, allocators_type & allocators)
+    {
+        destroy_single_node v(node, allocators);
+        rtree::apply_visitor(v, *node);
+    }
+
+private:
+    node_pointer m_node;
+    allocators_type & m_allocators;
+};
+
+// Retires all nodes of a subtree.
+template <typename MembersHolder>
+class retire_subtree
+    : public MembersHolder::visitor_const
+{
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+    typedef typename MembersHolder::node_pointer node_pointer;
+
+public:
+    inline retire_subtree(node_pointer node, copy_on_write_context & context)
+        : m_node(node)
+        , m_context(context)
+    {}
+
+    inline void operator()(internal_node const& n)
+    {
+        typedef typename rtree::elements_type<internal_node>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        m_context.retire(boost::to_address(m_node));                                            // MAY THROW, STRONG (alloc)
+
+        for ( typename elements_type::const_iterator it = elements.begin();
+              it != elements.end(); ++it )
+        {
+            m_node = it->second;
+            rtree::apply_visitor(*this, *m_node);                                               // MAY THROW, BASIC (alloc)
+        }
+    }
+
+    inline void operator()(leaf const& )
+    {
+        m_context.retire(boost::to_address(m_node));                                            // MAY THROW, STRONG (alloc)
+    }
+
+    static inline void apply(node_pointer node, copy_on_write_context & context)
+    {
+        retire_subtree v(node, context);
+        rtree::apply_visitor(v, *node);
+    }
+
+private:
+    node_pointer m_node;
+    copy_on_write_context & m_context;
+};
+
+} // namespace visitors
+
+// Replaces a shared node with its copy which can be modified.
+// Does nothing for other allocators than copy_on_write_allocator.
+template <typename MembersHolder>
+inline void make_writable(typename MembersHolder::node_pointer & node,
+                          typename MembersHolder::allocators_type & allocators)
+{
+    typedef typename MembersHolder::node_pointer node_pointer;
+
+    copy_on_write_context * context = get_copy_on_write_context(allocators.node_allocator());
+    if ( context == 0 || ! context->is_shared(boost::to_address(node)) )
+        return;
+
+    visitors::shallow_copy<MembersHolder> copy_v(allocators);
+    rtree::apply_visitor(copy_v, *node);                                                        // MAY THROW, STRONG (V, E: alloc, copy, N: alloc)
+    node_pointer const new_node = copy_v.result;
+
+    BOOST_TRY
+    {
+        context->retire(boost::to_address(node));                                              // MAY THROW, STRONG (alloc)
+    }
+    BOOST_CATCH(...)
+    {
+        visitors::destroy_single_node<MembersHolder>::apply(new_node, allocators);
+        BOOST_RETHROW
+    }
+    BOOST_CATCH_END
+
+    node = new_node;
+}
+
+}} // namespace detail::rtree
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_NODE_COPY_ON_WRITE_HPP
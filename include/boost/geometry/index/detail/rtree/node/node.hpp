@@ -31,6 +31,8 @@
 #include <boost/geometry/index/detail/rtree/node/variant_dynamic.hpp>
 #include <boost/geometry/index/detail/rtree/node/variant_static.hpp>
 
+#include <boost/geometry/index/detail/rtree/node/copy_on_write.hpp>
+
 #include <boost/geometry/algorithms/expand.hpp>
 
 #include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
@@ -0,0 +1,334 @@
+// Boost.Geometry Index
+//
+// R-tree reorganization of degraded nodes
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_OPTIMIZE_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_OPTIMIZE_HPP
+
+#include <vector>
+
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/core/pointer_traits.hpp>
+
+#include <boost/geometry/algorithms/centroid.hpp>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/algorithms/content.hpp>
+#include <boost/geometry/index/detail/algorithms/margin.hpp>
+#include <boost/geometry/index/detail/rtree/pack_create.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
+
+// The tree is traversed bottom-up. For each internal node the elements of its
+// children are distributed between the minimal number of new children with
+// the top-down median split used by the packing algorithm. The new children
+// replace the old ones if the sum of the contents of their boxes is smaller.
+// The heights of the subtrees and the boxes of the reorganized nodes are not
+// changed so only the node and its children are modified.
+// The shared nodes of copy-on-write trees are copied only if they are modified
+// or if one of their descendants is modified.
+template <typename MembersHolder>
+class optimize
+{
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+    typedef typename MembersHolder::size_type size_type;
+
+    typedef typename MembersHolder::node_pointer node_pointer;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename geometry::point_type<box_type>::type point_type;
+    typedef typename index::detail::default_content_result<box_type>::type content_type;
+    typedef typename index::detail::default_margin_result<box_type>::type margin_type;
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+    static const std::size_t dimension = geometry::dimension<point_type>::value;
+
+    typedef typename rtree::elements_type<internal_node>::type internal_elements;
+
+    // The cost of the children of a node, the sum of the contents and the margins.
+    struct cost
+    {
+        cost() : content(0), margin(0), count(0) {}
+
+        void add(box_type const& b)
+        {
+            content += index::detail::content(b);
+            margin += index::detail::comparable_margin(b);
+            ++count;
+        }
+
+        bool operator<(cost const& other) const
+        {
+            return content < other.content
+                || ( content == other.content
+                  && ( margin < other.margin
+                    || ( margin == other.margin && count < other.count ) ) );
+        }
+
+        content_type content;
+        margin_type margin;
+        std::size_t count;
+    };
+
+public:
+    // Returns the number of reorganized nodes.
+    static inline size_type apply(node_pointer & root,
+                                  size_type leafs_level,
+                                  parameters_type const& parameters,
+                                  translator_type const& translator,
+                                  allocators_type & allocators)
+    {
+        if ( ! root || leafs_level == 0 )
+            return 0;
+
+        optimize o(parameters, translator, allocators);
+        o.apply_node(root, leafs_level, true);                                                      // MAY THROW (V, E: alloc, copy, N: alloc)
+        return o.m_count;
+    }
+
+private:
+    optimize(parameters_type const& parameters,
+             translator_type const& translator,
+             allocators_type & allocators)
+        : m_parameters(parameters)
+        , m_translator(translator)
+        , m_allocators(allocators)
+        , m_strategy(index::detail::get_strategy(parameters))
+        , m_count(0)
+    {}
+
+    // Returns true if the node was modified. In this case the pointer may
+    // point to a copy of the shared node.
+    bool apply_node(node_pointer & ptr, size_type height, bool is_root)
+    {
+        node_pointer const original = ptr;
+        bool modified = false;
+
+        BOOST_TRY
+        {
+            if ( 1 < height )
+            {
+                std::size_t const count = rtree::elements(rtree::get<internal_node>(*ptr)).size();
+                for ( std::size_t i = 0 ; i < count ; ++i )
+                {
+                    node_pointer child = rtree::elements(rtree::get<internal_node>(*ptr))[i].second;
+                    if ( apply_node(child, height - 1, false) )                                     // MAY THROW (V, E: alloc, copy, N: alloc)
+                    {
+                        rtree::make_writable<MembersHolder>(ptr, m_allocators);                     // MAY THROW (V, E: alloc, copy, N: alloc)
+                        rtree::elements(rtree::get<internal_node>(*ptr))[i].second = child;
+                        modified = true;
+                    }
+                }
+
+                if ( reorganize<internal_node>(ptr, is_root) )                                      // MAY THROW (E: alloc, copy, N: alloc)
+                    modified = true;
+            }
+            else
+            {
+                if ( reorganize<leaf>(ptr, is_root) )                                               // MAY THROW (V, E: alloc, copy, N: alloc)
+                    modified = true;
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            // destroy the copies of the shared nodes, the original ones are not modified
+            if ( ptr != original )
+            {
+                visitors::destroy<MembersHolder>::apply(ptr, m_allocators);
+                ptr = original;
+            }
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        return modified;
+    }
+
+    // Distributes the elements of the children of a node between new children
+    // of type ChildNode.
+    template <typename ChildNode>
+    bool reorganize(node_pointer & ptr, bool is_root)
+    {
+        typedef typename rtree::elements_type<ChildNode>::type child_elements;
+        typedef typename child_elements::value_type child_element;
+        typedef std::pair<point_type, child_element const*> entry_type;
+
+        internal_elements const& children = rtree::elements(rtree::get<internal_node>(*ptr));
+
+        std::vector<entry_type> entries;
+        cost old_cost;
+        for ( typename internal_elements::const_iterator it = children.begin() ; it != children.end() ; ++it )
+        {
+            old_cost.add(it->first);
+
+            child_elements const& elements = rtree::elements(rtree::get<ChildNode>(*it->second));
+            for ( typename child_elements::const_iterator e = elements.begin() ; e != elements.end() ; ++e )
+            {
+                point_type pt;
+                geometry::centroid(rtree::element_indexable(*e, m_translator), pt);
+                entries.push_back(entry_type(pt, boost::addressof(*e)));                           // MAY THROW (alloc)
+            }
+        }
+
+        std::size_t const max_elements = m_parameters.get_max_elements();
+        std::size_t const min_children = is_root ? 2 : m_parameters.get_min_elements();
+        std::size_t const groups = (std::max)((entries.size() + max_elements - 1) / max_elements, min_children);
+
+        box_type const hint_box = rtree::elements_box<box_type>(children.begin(), children.end(),
+                                                                m_translator, m_strategy);
+        split(entries.begin(), entries.size(), 0, groups, entries.size(), groups, hint_box);
+
+        // calculate the boxes of the new children
+        std::vector<box_type> boxes;
+        boxes.reserve(groups);                                                                      // MAY THROW (alloc)
+        cost new_cost;
+        for ( std::size_t g = 0, first = 0 ; g < groups ; ++g )
+        {
+            std::size_t const last = first + group_size(entries.size(), g, groups);
+            box_type b;
+            index::detail::bounds(rtree::element_indexable(*entries[first].second, m_translator), b, m_strategy);
+            for ( std::size_t i = first + 1 ; i < last ; ++i )
+                index::detail::expand(b, rtree::element_indexable(*entries[i].second, m_translator), m_strategy);
+            boxes.push_back(b);
+            new_cost.add(b);
+            first = last;
+        }
+
+        if ( ! (new_cost < old_cost) )
+            return false;
+
+        rtree::make_writable<MembersHolder>(ptr, m_allocators);                                     // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        // the entries point to the elements of the children which are not modified
+        internal_elements new_children;
+        BOOST_TRY
+        {
+            for ( std::size_t g = 0, first = 0 ; g < groups ; ++g )
+            {
+                std::size_t const last = first + group_size(entries.size(), g, groups);
+
+                node_pointer n = rtree::create_node<allocators_type, ChildNode>::apply(m_allocators);   // MAY THROW, STRONG (N: alloc)
+                BOOST_TRY
+                {
+                    new_children.push_back(rtree::make_ptr_pair(boxes[g], n));                      // MAY THROW, STRONG (E: alloc, copy)
+                }
+                BOOST_CATCH(...)
+                {
+                    rtree::destroy_node<allocators_type, ChildNode>::apply(m_allocators, n);
+                    BOOST_RETHROW                                                                   // RETHROW
+                }
+                BOOST_CATCH_END
+
+                child_elements & elements = rtree::elements(rtree::get<ChildNode>(*n));
+                elements.reserve(last - first);                                                     // MAY THROW (V, E: alloc)
+                for ( std::size_t i = first ; i < last ; ++i )
+                    elements.push_back(*entries[i].second);                                         // MAY THROW (V, E: copy)
+
+                set_box(new_children.back().first, rtree::get<ChildNode>(*n));
+                first = last;
+            }
+
+            reserve_retired(children.size());                                                       // MAY THROW (alloc)
+        }
+        BOOST_CATCH(...)
+        {
+            for ( typename internal_elements::iterator it = new_children.begin() ; it != new_children.end() ; ++it )
+                visitors::destroy_single_node<MembersHolder>::apply(it->second, m_allocators);
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        // nothing throws below
+        internal_elements & elements = rtree::elements(rtree::get<internal_node>(*ptr));
+        elements.swap(new_children);
+        for ( typename internal_elements::iterator it = new_children.begin() ; it != new_children.end() ; ++it )
+            dispose_single_node(it->second);
+
+        ++m_count;
+        return true;
+    }
+
+    // Sorts the entries of groups [first_group, first_group + groups_count)
+    // so the entries of each group are placed consecutively.
+    template <typename EIt>
+    static void split(EIt first, std::size_t count, std::size_t first_group, std::size_t groups_count,
+                      std::size_t entries_total, std::size_t groups_total, box_type const& hint_box)
+    {
+        if ( groups_count <= 1 )
+            return;
+
+        std::size_t const left_groups = groups_count / 2;
+        std::size_t left_count = 0;
+        for ( std::size_t g = first_group ; g < first_group + left_groups ; ++g )
+            left_count += group_size(entries_total, g, groups_total);
+
+        EIt const median = first + left_count;
+
+        typename geometry::coordinate_type<box_type>::type greatest_length;
+        std::size_t greatest_dim_index = 0;
+        pack_utils::biggest_edge<dimension>::apply(hint_box, greatest_length, greatest_dim_index);
+        box_type left, right;
+        pack_utils::nth_element_and_half_boxes<0, dimension>
+            ::apply(first, median, first + count, hint_box, left, right, greatest_dim_index);
+
+        split(first, left_count, first_group, left_groups,
+              entries_total, groups_total, left);
+        split(median, count - left_count, first_group + left_groups, groups_count - left_groups,
+              entries_total, groups_total, right);
+    }
+
+    // The entries are distributed evenly, the first groups contain one more entry.
+    static std::size_t group_size(std::size_t entries_count, std::size_t group, std::size_t groups_count)
+    {
+        return entries_count / groups_count + (group < entries_count % groups_count ? 1 : 0);
+    }
+
+    void set_box(box_type & b, leaf const& l) const
+    {
+        b = rtree::values_box<box_type>(rtree::elements(l).begin(), rtree::elements(l).end(),
+                                        m_translator, m_strategy);
+    }
+
+    void set_box(box_type & b, internal_node const& n) const
+    {
+        b = rtree::elements_box<box_type>(rtree::elements(n).begin(), rtree::elements(n).end(),
+                                          m_translator, m_strategy);
+    }
+
+    // The shared nodes are retired, the space is reserved in order to not throw later.
+    void reserve_retired(std::size_t count)
+    {
+        copy_on_write_context * context = get_copy_on_write_context(m_allocators.node_allocator());
+        if ( context != 0 )
+            context->retired().reserve(context->retired().size() + count);                          // MAY THROW (alloc)
+    }
+
+    void dispose_single_node(node_pointer n)
+    {
+        copy_on_write_context * context = get_copy_on_write_context(m_allocators.node_allocator());
+        if ( context != 0 && context->is_shared(boost::to_address(n)) )
+            context->retire(boost::to_address(n));
+        else
+            visitors::destroy_single_node<MembersHolder>::apply(n, m_allocators);
+    }
+
+    parameters_type const& m_parameters;
+    translator_type const& m_translator;
+    allocators_type & m_allocators;
+    strategy_type m_strategy;
+    size_type m_count;
+};
+
+}}}}} // namespace boost::geometry::index::detail::rtree
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_OPTIMIZE_HPP
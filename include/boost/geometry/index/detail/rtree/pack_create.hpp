@@ -16,7 +16,11 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_CREATE_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_CREATE_HPP
 
+#include <algorithm>
+#include <vector>
+
 #include <boost/core/ignore_unused.hpp>
+#include <boost/cstdint.hpp>
 
 #include <boost/geometry/algorithms/expand.hpp>
 #include <boost/geometry/index/detail/algorithms/bounds.hpp>
@@ -24,6 +28,11 @@
 #include <boost/geometry/index/detail/rtree/node/subtree_destroyer.hpp>
 
 #include <boost/geometry/algorithms/detail/expand_by_epsilon.hpp>
+#include <boost/geometry/algorithms/detail/space_filling_curve.hpp>
+
+#include <boost/geometry/index/packing.hpp>
+
+#include <boost/geometry/util/parallel.hpp>
 
 namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
 
@@ -99,6 +108,79 @@ struct nth_element_and_half_boxes<Dimension, Dimension>
     static inline void apply(EIt , EIt , EIt , Box const& , Box & , Box & , std::size_t ) {}
 };
 
+template <typename Curve>
+struct sfc_code;
+
+template <>
+struct sfc_code<index::hilbert_curve>
+{
+    template <typename Box>
+    static inline boost::uint64_t apply(Box const& b, Box const& bounds)
+    {
+        return geometry::detail::space_filling_curve::hilbert_code(b, bounds);
+    }
+};
+
+template <>
+struct sfc_code<index::morton_curve>
+{
+    template <typename Box>
+    static inline boost::uint64_t apply(Box const& b, Box const& bounds)
+    {
+        return geometry::detail::space_filling_curve::morton_code(b, bounds);
+    }
+};
+
+// Calculates the number of elements of the i-th of the nodes created
+// sequentially from count elements.
+template <typename SizeType, typename Parameters>
+inline SizeType sequential_node_elements_count(SizeType i, SizeType count,
+                                               Parameters const& parameters)
+{
+    SizeType const max_count = parameters.get_max_elements();
+    SizeType const min_count = parameters.get_min_elements();
+    SizeType const nodes_count = (count + max_count - 1) / max_count;
+    SizeType const remainder = count - (nodes_count - 1) * max_count;
+
+    // the last two nodes share the elements if the last one would be too small
+    if ( 1 < nodes_count && remainder < min_count )
+    {
+        if ( i + 2 == nodes_count )
+            return max_count + remainder - min_count;
+        if ( i + 1 == nodes_count )
+            return min_count;
+    }
+    else if ( i + 1 == nodes_count )
+    {
+        return remainder;
+    }
+
+    return max_count;
+}
+
+// Calculates the number of elements of the nodes created sequentially
+// from count elements which are placed before the i-th node.
+template <typename SizeType, typename Parameters>
+inline SizeType sequential_node_elements_offset(SizeType i, SizeType count,
+                                                Parameters const& parameters)
+{
+    SizeType const max_count = parameters.get_max_elements();
+    SizeType const nodes_count = (count + max_count - 1) / max_count;
+
+    // only the last two nodes may be not full
+    return i + 1 < nodes_count ? i * max_count
+         : count - sequential_node_elements_count(i, count, parameters);
+}
+
+struct code_entries_comparer
+{
+    template <typename CodeEntry>
+    bool operator()(CodeEntry const& e1, CodeEntry const& e2) const
+    {
+        return e1.first < e2.first;
+    }
+};
+
 } // namespace pack_utils
 
 // STR leafs number are calculated as rcount/max
@@ -180,6 +262,23 @@ public:
                        translator_type const& translator,
                        allocators_type & allocators,
                        TmpAlloc const& temp_allocator)
+    {
+        return apply(first, last, values_count, leafs_level, parameters, translator,
+                     allocators, temp_allocator, 1);
+    }
+
+    // The subtrees are created concurrently by at most threads threads.
+    // The structure of the tree is the same as the one created sequentially.
+    // NOTE: The nodes are allocated concurrently so the allocator must be thread-safe.
+    template <typename InIt, typename TmpAlloc> inline static
+    node_pointer apply(InIt first, InIt last,
+                       size_type & values_count,
+                       size_type & leafs_level,
+                       parameters_type const& parameters,
+                       translator_type const& translator,
+                       allocators_type & allocators,
+                       TmpAlloc const& temp_allocator,
+                       std::size_t threads)
     {
         typedef typename std::iterator_traits<InIt>::difference_type diff_type;
             
@@ -220,12 +319,160 @@ public:
 
         subtree_elements_counts subtree_counts = calculate_subtree_elements_counts(values_count, parameters, leafs_level);
         internal_element el = per_level(entries.begin(), entries.end(), hint_box.get(), values_count, subtree_counts,
-                                        parameters, translator, allocators);
+                                        parameters, translator, allocators, threads);
 
         return el.second;
     }
 
+    // The values are sorted by the codes of the centers of their bounding boxes
+    // on the space-filling curve. Then the leafs are filled sequentially with
+    // max elements and the internal nodes are created bottom-up the same way.
+    // If the last node on a level would contain less than min elements, some
+    // elements of the previous one are moved to it.
+    // The codes are calculated and the entries are sorted concurrently by at most
+    // threads threads and the leafs are created by at most nodes_threads threads.
+    // The result is the same as the one created sequentially.
+    // NOTE: The nodes are allocated concurrently so if nodes_threads is greater
+    //   than 1 the allocator must be thread-safe.
+    template <typename Curve, typename InIt, typename TmpAlloc> inline static
+    node_pointer apply_sorted(InIt first, InIt last,
+                              size_type & values_count,
+                              size_type & leafs_level,
+                              parameters_type const& parameters,
+                              translator_type const& translator,
+                              allocators_type & allocators,
+                              TmpAlloc const& temp_allocator,
+                              std::size_t threads,
+                              std::size_t nodes_threads)
+    {
+        typedef typename std::iterator_traits<InIt>::difference_type diff_type;
+
+        diff_type diff = std::distance(first, last);
+        if ( diff <= 0 )
+            return node_pointer(0);
+
+        typedef std::pair<boost::uint64_t, InIt> entry_type;
+        typedef typename boost::container::allocator_traits<TmpAlloc>::
+            template rebind_alloc<entry_type> temp_entry_allocator_type;
+
+        temp_entry_allocator_type temp_entry_allocator(temp_allocator);
+        boost::container::vector<entry_type, temp_entry_allocator_type> entries(temp_entry_allocator);
+
+        values_count = static_cast<size_type>(diff);
+        entries.reserve(values_count);
+
+        strategy_type const& strategy = detail::get_strategy(parameters);
+
+        expandable_box<box_type, strategy_type> bounds(strategy);
+        for ( InIt it = first ; it != last ; ++it )
+        {
+            typename std::iterator_traits<InIt>::reference in_ref = *it;
+            typename translator_type::result_type indexable = translator(in_ref);
+
+            // NOTE: added for consistency with insert()
+            BOOST_GEOMETRY_INDEX_ASSERT(detail::is_valid(indexable), "Indexable is invalid");
+
+            bounds.expand(indexable);
+        }
+
+        for ( InIt it = first ; it != last ; ++it )
+        {
+            entries.push_back(std::make_pair(boost::uint64_t(0), it));
+        }
+
+        calculate_codes<Curve>(entries.begin(), entries.end(), bounds.get(),
+                               translator, strategy, threads);
+        sort_entries(entries.begin(), entries.end(), threads);
+
+        // leafs
+        std::vector<box_type> boxes;
+        std::vector<node_pointer> nodes;
+        subtrees_destroyer nodes_remover(nodes, allocators);
+        create_leafs(entries.begin(), values_count, boxes, nodes,
+                     parameters, translator, allocators, nodes_threads);
+
+        return create_levels(boxes, nodes, leafs_level, parameters, allocators);
+    }
+
+    // The values are read from the source, e.g. the external sort, one by one
+    // with source.next() in the order of leafs. The nodes are created the same
+    // way as in apply_sorted().
+    template <typename Source> inline static
+    node_pointer apply_sorted_source(Source & source,
+                                     size_type values_count,
+                                     size_type & leafs_level,
+                                     parameters_type const& parameters,
+                                     translator_type const& translator,
+                                     allocators_type & allocators)
+    {
+        typedef typename MembersHolder::value_type value_type;
+
+        if ( values_count == 0 )
+            return node_pointer(0);
+
+        std::size_t const max_count = parameters.get_max_elements();
+        std::size_t const leafs_count = (values_count + max_count - 1) / max_count;
+
+        std::vector<value_type> values;
+        std::vector< std::pair<boost::uint64_t, value_type const*> > entries;
+        values.reserve(max_count);
+        entries.reserve(max_count);
+
+        std::vector<box_type> boxes(leafs_count);
+        std::vector<node_pointer> nodes(leafs_count, node_pointer(0));
+        subtrees_destroyer nodes_remover(nodes, allocators);
+
+        for ( std::size_t i = 0 ; i < leafs_count ; ++i )
+        {
+            size_type const count = pack_utils::sequential_node_elements_count(size_type(i), values_count, parameters);
+
+            values.clear();
+            for ( size_type j = 0 ; j < count ; ++j )
+                values.push_back(source.next());                                                        // MAY THROW (V: copy, E: read)
+
+            entries.clear();
+            for ( size_type j = 0 ; j < count ; ++j )
+                entries.push_back(std::make_pair(boost::uint64_t(0), &values[j]));
+
+            internal_element el = create_leaf(entries.begin(), entries.end(), count,
+                                              parameters, translator, allocators);
+            boxes[i] = el.first;
+            nodes[i] = el.second;
+        }
+
+        return create_levels(boxes, nodes, leafs_level, parameters, allocators);
+    }
+
 private:
+    // Creates the internal nodes bottom-up from the nodes of the lowest level
+    // until the root is created.
+    inline static
+    node_pointer create_levels(std::vector<box_type> & boxes,
+                               std::vector<node_pointer> & nodes,
+                               size_type & leafs_level,
+                               parameters_type const& parameters,
+                               allocators_type & allocators)
+    {
+        leafs_level = 0;
+        while ( 1 < nodes.size() )
+        {
+            std::vector<box_type> parent_boxes;
+            std::vector<node_pointer> parent_nodes;
+            subtrees_destroyer parent_nodes_remover(parent_nodes, allocators);
+
+            create_internal_nodes(boxes, nodes, parent_boxes, parent_nodes,
+                                  parameters, allocators);
+
+            boxes.swap(parent_boxes);
+            nodes.swap(parent_nodes);
+            ++leafs_level;
+        }
+
+        node_pointer result = nodes[0];
+        nodes[0] = 0;
+        return result;
+    }
+
     template <typename BoxType, typename Strategy>
     class expandable_box
     {
@@ -289,7 +536,8 @@ private:
                                subtree_elements_counts const& subtree_counts,
                                parameters_type const& parameters,
                                translator_type const& translator,
-                               allocators_type & allocators)
+                               allocators_type & allocators,
+                               std::size_t threads)
     {
         BOOST_GEOMETRY_INDEX_ASSERT(0 < std::distance(first, last) && static_cast<size_type>(std::distance(first, last)) == values_count,
                                     "unexpected parameters");
@@ -301,47 +549,7 @@ private:
                                         "too big number of elements");
             // if !root check m_parameters.get_min_elements() <= count
 
-            // create new leaf node
-            node_pointer n = rtree::create_node<allocators_type, leaf>::apply(allocators);                       // MAY THROW (A)
-            subtree_destroyer auto_remover(n, allocators);
-            leaf & l = rtree::get<leaf>(*n);
-
-            // reserve space for values
-            rtree::elements(l).reserve(values_count);                                                       // MAY THROW (A)
-
-            // calculate values box and copy values
-            //   initialize the box explicitly to avoid GCC-4.4 uninitialized variable warnings with O2
-            expandable_box<box_type, strategy_type> elements_box(translator(*(first->second)),
-                                                                 detail::get_strategy(parameters));
-            rtree::elements(l).push_back(*(first->second));                                                 // MAY THROW (A?,C)
-            for ( ++first ; first != last ; ++first )
-            {
-                // NOTE: push_back() must be called at the end in order to support move_iterator.
-                //       The iterator is dereferenced 2x (no temporary reference) to support
-                //       non-true reference types and move_iterator without boost::forward<>.
-                elements_box.expand(translator(*(first->second)));
-                rtree::elements(l).push_back(*(first->second));                                             // MAY THROW (A?,C)
-            }
-
-#ifdef BOOST_GEOMETRY_INDEX_EXPERIMENTAL_ENLARGE_BY_EPSILON
-            // Enlarge bounds of a leaf node.
-            // It's because Points and Segments are compared WRT machine epsilon
-            // This ensures that leafs bounds correspond to the stored elements
-            // NOTE: this is done only if the Indexable is a different kind of Geometry
-            //   than the bounds (only Box for now). Spatial predicates are checked
-            //   the same way for Geometry of the same kind.
-            if ( BOOST_GEOMETRY_CONDITION((
-                    ! index::detail::is_bounding_geometry
-                        <
-                            typename indexable_type<translator_type>::type
-                        >::value )) )
-            {
-                elements_box.expand_by_epsilon();
-            }
-#endif
-
-            auto_remover.release();
-            return internal_element(elements_box.get(), n);
+            return create_leaf(first, last, values_count, parameters, translator, allocators);
         }
 
         // calculate next max and min subtree counts
@@ -360,9 +568,68 @@ private:
         // calculate values box and copy values
         expandable_box<box_type, strategy_type> elements_box(detail::get_strategy(parameters));
         
-        per_level_packets(first, last, hint_box, values_count, subtree_counts, next_subtree_counts,
-                          rtree::elements(in), elements_box,
-                          parameters, translator, allocators);
+        if ( threads <= 1 )
+        {
+            per_level_packets(first, last, hint_box, values_count, subtree_counts, next_subtree_counts,
+                              rtree::elements(in), elements_box,
+                              parameters, translator, allocators);
+        }
+        else
+        {
+            per_level_packets_parallel(first, last, hint_box, values_count, subtree_counts, next_subtree_counts,
+                                       rtree::elements(in), elements_box,
+                                       parameters, translator, allocators, threads);
+        }
+
+        auto_remover.release();
+        return internal_element(elements_box.get(), n);
+    }
+
+    template <typename EIt> inline static
+    internal_element create_leaf(EIt first, EIt last,
+                                 size_type values_count,
+                                 parameters_type const& parameters,
+                                 translator_type const& translator,
+                                 allocators_type & allocators)
+    {
+        // create new leaf node
+        node_pointer n = rtree::create_node<allocators_type, leaf>::apply(allocators);                       // MAY THROW (A)
+        subtree_destroyer auto_remover(n, allocators);
+        leaf & l = rtree::get<leaf>(*n);
+
+        // reserve space for values
+        rtree::elements(l).reserve(values_count);                                                       // MAY THROW (A)
+
+        // calculate values box and copy values
+        //   initialize the box explicitly to avoid GCC-4.4 uninitialized variable warnings with O2
+        expandable_box<box_type, strategy_type> elements_box(translator(*(first->second)),
+                                                             detail::get_strategy(parameters));
+        rtree::elements(l).push_back(*(first->second));                                                 // MAY THROW (A?,C)
+        for ( ++first ; first != last ; ++first )
+        {
+            // NOTE: push_back() must be called at the end in order to support move_iterator.
+            //       The iterator is dereferenced 2x (no temporary reference) to support
+            //       non-true reference types and move_iterator without boost::forward<>.
+            elements_box.expand(translator(*(first->second)));
+            rtree::elements(l).push_back(*(first->second));                                             // MAY THROW (A?,C)
+        }
+
+#ifdef BOOST_GEOMETRY_INDEX_EXPERIMENTAL_ENLARGE_BY_EPSILON
+        // Enlarge bounds of a leaf node.
+        // It's because Points and Segments are compared WRT machine epsilon
+        // This ensures that leafs bounds correspond to the stored elements
+        // NOTE: this is done only if the Indexable is a different kind of Geometry
+        //   than the bounds (only Box for now). Spatial predicates are checked
+        //   the same way for Geometry of the same kind.
+        if ( BOOST_GEOMETRY_CONDITION((
+                ! index::detail::is_bounding_geometry
+                    <
+                        typename indexable_type<translator_type>::type
+                    >::value )) )
+        {
+            elements_box.expand_by_epsilon();
+        }
+#endif
 
         auto_remover.release();
         return internal_element(elements_box.get(), n);
@@ -391,7 +658,7 @@ private:
         {
             // the end, move to the next level
             internal_element el = per_level(first, last, hint_box, values_count, next_subtree_counts,
-                                            parameters, translator, allocators);
+                                            parameters, translator, allocators, 1);
 
             // in case if push_back() do throw here
             // and even if this is not probable (previously reserved memory, nonthrowing pairs copy)
@@ -425,6 +692,446 @@ private:
                           parameters, translator, allocators);
     }
 
+    // Subtree which will be created from the range of entries
+    template <typename EIt>
+    struct packet
+    {
+        packet(EIt f, EIt l, box_type const& b, size_type c)
+            : first(f), last(l), hint_box(b), values_count(c)
+        {}
+
+        EIt first;
+        EIt last;
+        box_type hint_box;
+        size_type values_count;
+    };
+
+    // Partitions the entries the same way as per_level_packets() does but instead
+    // of creating the subtrees the packets are stored in the container.
+    // The halves are partitioned concurrently if more than one thread is available.
+    template <typename EIt> inline static
+    void collect_packets(EIt first, EIt last,
+                         box_type const& hint_box,
+                         size_type values_count,
+                         subtree_elements_counts const& subtree_counts,
+                         std::vector< packet<EIt> > & packets,
+                         std::size_t threads)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(0 < std::distance(first, last) && static_cast<size_type>(std::distance(first, last)) == values_count,
+                                    "unexpected parameters");
+
+        if ( values_count <= subtree_counts.maxc )
+        {
+            packets.push_back(packet<EIt>(first, last, hint_box, values_count));
+            return;
+        }
+
+        size_type median_count = calculate_median_count(values_count, subtree_counts);
+        EIt median = first + median_count;
+
+        coordinate_type greatest_length;
+        std::size_t greatest_dim_index = 0;
+        pack_utils::biggest_edge<dimension>::apply(hint_box, greatest_length, greatest_dim_index);
+        box_type left, right;
+        pack_utils::nth_element_and_half_boxes<0, dimension>
+            ::apply(first, median, last, hint_box, left, right, greatest_dim_index);
+
+        if ( threads <= 1 )
+        {
+            collect_packets(first, median, left, median_count, subtree_counts, packets, 1);
+            collect_packets(median, last, right, values_count - median_count, subtree_counts, packets, 1);
+            return;
+        }
+
+        std::vector< packet<EIt> > right_packets;
+        {
+            geometry::detail::parallel::task_group tasks;
+            tasks.run(collect_packets_task<EIt>(median, last, right, values_count - median_count,
+                                                subtree_counts, right_packets, threads - threads / 2));
+            collect_packets(first, median, left, median_count, subtree_counts, packets, threads / 2);
+            tasks.wait();
+        }
+        packets.insert(packets.end(), right_packets.begin(), right_packets.end());
+    }
+
+    template <typename EIt>
+    struct collect_packets_task
+    {
+        collect_packets_task(EIt f, EIt l, box_type const& b, size_type c,
+                             subtree_elements_counts const& sc,
+                             std::vector< packet<EIt> > & p,
+                             std::size_t t)
+            : first(f), last(l), hint_box(b), values_count(c)
+            , subtree_counts(sc), packets(p), threads(t)
+        {}
+
+        void operator()() const
+        {
+            collect_packets(first, last, hint_box, values_count, subtree_counts, packets, threads);
+        }
+
+        EIt first;
+        EIt last;
+        box_type hint_box;
+        size_type values_count;
+        subtree_elements_counts subtree_counts;
+        std::vector< packet<EIt> > & packets;
+        std::size_t threads;
+    };
+
+    // Creates the subtrees of packets in range [first, last)
+    template <typename EIt>
+    struct per_level_task
+    {
+        per_level_task(std::vector< packet<EIt> > const& p,
+                       std::size_t f, std::size_t l,
+                       subtree_elements_counts const& nsc,
+                       parameters_type const& par,
+                       translator_type const& tr,
+                       allocators_type & al,
+                       std::vector<box_type> & b,
+                       std::vector<node_pointer> & n,
+                       std::size_t t)
+            : packets(p), first(f), last(l), next_subtree_counts(nsc)
+            , parameters(par), translator(tr), allocators(al)
+            , boxes(b), nodes(n), threads(t)
+        {}
+
+        void operator()() const
+        {
+            for ( std::size_t i = first ; i < last ; ++i )
+            {
+                packet<EIt> const& p = packets[i];
+                internal_element el = per_level(p.first, p.last, p.hint_box, p.values_count, next_subtree_counts,
+                                                parameters, translator, allocators, threads);
+                boxes[i] = el.first;
+                nodes[i] = el.second;
+            }
+        }
+
+        std::vector< packet<EIt> > const& packets;
+        std::size_t first;
+        std::size_t last;
+        subtree_elements_counts next_subtree_counts;
+        parameters_type const& parameters;
+        translator_type const& translator;
+        allocators_type & allocators;
+        std::vector<box_type> & boxes;
+        std::vector<node_pointer> & nodes;
+        std::size_t threads;
+    };
+
+    // Destroys the subtrees which weren't moved to the node
+    class subtrees_destroyer
+    {
+        subtrees_destroyer(subtrees_destroyer const&);
+        subtrees_destroyer & operator=(subtrees_destroyer const&);
+
+    public:
+        subtrees_destroyer(std::vector<node_pointer> & nodes, allocators_type & allocators)
+            : m_nodes(nodes), m_allocators(allocators)
+        {}
+
+        ~subtrees_destroyer()
+        {
+            for ( std::size_t i = 0 ; i < m_nodes.size() ; ++i )
+            {
+                subtree_destroyer auto_remover(m_nodes[i], m_allocators);
+                m_nodes[i] = 0;
+            }
+        }
+
+    private:
+        std::vector<node_pointer> & m_nodes;
+        allocators_type & m_allocators;
+    };
+
+    template <typename EIt, typename ExpandableBox> inline static
+    void per_level_packets_parallel(EIt first, EIt last,
+                                    box_type const& hint_box,
+                                    size_type values_count,
+                                    subtree_elements_counts const& subtree_counts,
+                                    subtree_elements_counts const& next_subtree_counts,
+                                    internal_elements & elements,
+                                    ExpandableBox & elements_box,
+                                    parameters_type const& parameters,
+                                    translator_type const& translator,
+                                    allocators_type & allocators,
+                                    std::size_t threads)
+    {
+        std::vector< packet<EIt> > packets;
+        collect_packets(first, last, hint_box, values_count, subtree_counts, packets, threads);
+
+        std::size_t const packets_count = packets.size();
+        std::vector<box_type> boxes(packets_count);
+        std::vector<node_pointer> nodes(packets_count, node_pointer(0));
+        subtrees_destroyer auto_remover(nodes, allocators);
+
+        // If there are more threads than packets the rest is passed to the subtrees
+        std::size_t const tasks_count = (std::min)(threads, packets_count);
+        {
+            geometry::detail::parallel::task_group tasks;
+            for ( std::size_t t = 1 ; t < tasks_count ; ++t )
+            {
+                tasks.run(task_for(packets, t, tasks_count, threads, next_subtree_counts,
+                                   parameters, translator, allocators, boxes, nodes));
+            }
+            task_for(packets, 0, tasks_count, threads, next_subtree_counts,
+                     parameters, translator, allocators, boxes, nodes)();
+            tasks.wait();
+        }
+
+        // the subtrees are stored in the same order as in per_level_packets()
+        for ( std::size_t i = 0 ; i < packets_count ; ++i )
+        {
+            // this container should have memory allocated, reserve() called outside
+            elements.push_back(internal_element(boxes[i], nodes[i]));               // MAY THROW (A?,C) - however in normal conditions shouldn't
+            nodes[i] = 0;
+
+            elements_box.expand(boxes[i]);
+        }
+    }
+
+    template <typename EIt> inline static
+    per_level_task<EIt> task_for(std::vector< packet<EIt> > const& packets,
+                                 std::size_t task_index,
+                                 std::size_t tasks_count,
+                                 std::size_t threads,
+                                 subtree_elements_counts const& next_subtree_counts,
+                                 parameters_type const& parameters,
+                                 translator_type const& translator,
+                                 allocators_type & allocators,
+                                 std::vector<box_type> & boxes,
+                                 std::vector<node_pointer> & nodes)
+    {
+        std::size_t const packets_count = packets.size();
+        std::size_t const first = task_index * packets_count / tasks_count;
+        std::size_t const last = (task_index + 1) * packets_count / tasks_count;
+        std::size_t const task_threads = threads / tasks_count
+                                       + (task_index < threads % tasks_count ? 1 : 0);
+        return per_level_task<EIt>(packets, first, last, next_subtree_counts,
+                                   parameters, translator, allocators,
+                                   boxes, nodes, task_threads);
+    }
+
+    // Calculates the codes of the entries, each thread for one part of the range.
+    template <typename Curve, typename EIt> inline static
+    void calculate_codes(EIt first, EIt last, box_type const& bounds,
+                         translator_type const& translator,
+                         strategy_type const& strategy,
+                         std::size_t threads)
+    {
+        std::size_t const count = static_cast<std::size_t>(std::distance(first, last));
+        std::size_t const parts = (std::max)(std::size_t(1), (std::min)(threads, count / 1024));
+
+        geometry::detail::parallel::task_group tasks;
+        for ( std::size_t i = 1 ; i < parts ; ++i )
+        {
+            tasks.run(code_task<Curve, EIt>(first + i * count / parts, first + (i + 1) * count / parts,
+                                            bounds, translator, strategy));
+        }
+        code_task<Curve, EIt>(first, first + count / parts, bounds, translator, strategy)();
+        tasks.wait();
+    }
+
+    template <typename Curve, typename EIt>
+    struct code_task
+    {
+        code_task(EIt f, EIt l, box_type const& b,
+                  translator_type const& tr, strategy_type const& st)
+            : first(f), last(l), bounds(b), translator(tr), strategy(st)
+        {}
+
+        void operator()() const
+        {
+            for ( EIt it = first ; it != last ; ++it )
+            {
+                box_type b;
+                detail::bounds(translator(*(it->second)), b, strategy);
+                it->first = pack_utils::sfc_code<Curve>::apply(b, bounds);
+            }
+        }
+
+        EIt first;
+        EIt last;
+        box_type const& bounds;
+        translator_type const& translator;
+        strategy_type const& strategy;
+    };
+
+    // Stable sort of the entries by their codes. Each thread sorts one part
+    // of the range and then the parts are merged in pairs concurrently.
+    template <typename EIt> inline static
+    void sort_entries(EIt first, EIt last, std::size_t threads)
+    {
+        std::size_t const count = static_cast<std::size_t>(std::distance(first, last));
+        std::size_t const parts = (std::max)(std::size_t(1), (std::min)(threads, count / 1024));
+
+        std::vector<EIt> bounds(parts + 1);
+        for ( std::size_t i = 0 ; i <= parts ; ++i )
+            bounds[i] = first + i * count / parts;
+
+        {
+            geometry::detail::parallel::task_group tasks;
+            for ( std::size_t i = 1 ; i < parts ; ++i )
+                tasks.run(sort_task<EIt>(bounds[i], bounds[i + 1]));
+            sort_task<EIt>(bounds[0], bounds[1])();
+            tasks.wait();
+        }
+
+        for ( std::size_t width = 1 ; width < parts ; width *= 2 )
+        {
+            geometry::detail::parallel::task_group tasks;
+            for ( std::size_t i = 2 * width ; i < parts ; i += 2 * width )
+            {
+                tasks.run(sort_task<EIt>(bounds[i], bounds[(std::min)(i + width, parts)],
+                                         bounds[(std::min)(i + 2 * width, parts)]));
+            }
+            sort_task<EIt>(bounds[0], bounds[(std::min)(width, parts)],
+                           bounds[(std::min)(2 * width, parts)])();
+            tasks.wait();
+        }
+    }
+
+    // Sorts the range [first, last) or merges the sorted ranges [first, middle)
+    // and [middle, last).
+    template <typename EIt>
+    struct sort_task
+    {
+        sort_task(EIt f, EIt l)
+            : first(f), middle(l), last(l), merge(false)
+        {}
+
+        sort_task(EIt f, EIt m, EIt l)
+            : first(f), middle(m), last(l), merge(true)
+        {}
+
+        void operator()() const
+        {
+            if ( ! merge )
+                std::stable_sort(first, last, pack_utils::code_entries_comparer());
+            else if ( middle != last )
+                std::inplace_merge(first, middle, last, pack_utils::code_entries_comparer());
+        }
+
+        EIt first;
+        EIt middle;
+        EIt last;
+        bool merge;
+    };
+
+    template <typename EIt> inline static
+    void create_leafs(EIt first, size_type values_count,
+                      std::vector<box_type> & boxes,
+                      std::vector<node_pointer> & nodes,
+                      parameters_type const& parameters,
+                      translator_type const& translator,
+                      allocators_type & allocators,
+                      std::size_t threads)
+    {
+        std::size_t const max_count = parameters.get_max_elements();
+        std::size_t const leafs_count = (values_count + max_count - 1) / max_count;
+        boxes.resize(leafs_count);
+        nodes.resize(leafs_count, node_pointer(0));
+
+        std::size_t const tasks_count = (std::max)(std::size_t(1), (std::min)(threads, leafs_count / 64));
+        {
+            geometry::detail::parallel::task_group tasks;
+            for ( std::size_t t = 1 ; t < tasks_count ; ++t )
+            {
+                tasks.run(create_leafs_task<EIt>(first, values_count,
+                                                 t * leafs_count / tasks_count,
+                                                 (t + 1) * leafs_count / tasks_count,
+                                                 parameters, translator, allocators,
+                                                 boxes, nodes));
+            }
+            create_leafs_task<EIt>(first, values_count, 0, leafs_count / tasks_count,
+                                   parameters, translator, allocators,
+                                   boxes, nodes)();
+            tasks.wait();
+        }
+    }
+
+    // Creates the leafs in range [first_leaf, last_leaf)
+    template <typename EIt>
+    struct create_leafs_task
+    {
+        create_leafs_task(EIt e, size_type vc,
+                          std::size_t f, std::size_t l,
+                          parameters_type const& par,
+                          translator_type const& tr,
+                          allocators_type & al,
+                          std::vector<box_type> & b,
+                          std::vector<node_pointer> & n)
+            : entries(e), values_count(vc), first_leaf(f), last_leaf(l)
+            , parameters(par), translator(tr), allocators(al)
+            , boxes(b), nodes(n)
+        {}
+
+        void operator()() const
+        {
+            EIt first = entries + pack_utils::sequential_node_elements_offset(size_type(first_leaf), values_count, parameters);
+            for ( std::size_t i = first_leaf ; i < last_leaf ; ++i )
+            {
+                size_type const count = pack_utils::sequential_node_elements_count(size_type(i), values_count, parameters);
+                EIt last = first + count;
+                internal_element el = create_leaf(first, last, count,
+                                                  parameters, translator, allocators);
+                boxes[i] = el.first;
+                nodes[i] = el.second;
+                first = last;
+            }
+        }
+
+        EIt entries;
+        size_type values_count;
+        std::size_t first_leaf;
+        std::size_t last_leaf;
+        parameters_type const& parameters;
+        translator_type const& translator;
+        allocators_type & allocators;
+        std::vector<box_type> & boxes;
+        std::vector<node_pointer> & nodes;
+    };
+
+    inline static
+    void create_internal_nodes(std::vector<box_type> const& boxes,
+                               std::vector<node_pointer> & nodes,
+                               std::vector<box_type> & parent_boxes,
+                               std::vector<node_pointer> & parent_nodes,
+                               parameters_type const& parameters,
+                               allocators_type & allocators)
+    {
+        std::size_t const count = nodes.size();
+        std::size_t const max_count = parameters.get_max_elements();
+        std::size_t const parents_count = (count + max_count - 1) / max_count;
+        parent_boxes.resize(parents_count);
+        parent_nodes.resize(parents_count, node_pointer(0));
+
+        std::size_t first = 0;
+        for ( std::size_t i = 0 ; i < parents_count ; ++i )
+        {
+            size_type const elements_count = pack_utils::sequential_node_elements_count(size_type(i), size_type(count), parameters);
+
+            node_pointer n = rtree::create_node<allocators_type, internal_node>::apply(allocators);          // MAY THROW (A)
+            parent_nodes[i] = n;
+            internal_elements & elements = rtree::elements(rtree::get<internal_node>(*n));
+            elements.reserve(elements_count);                                                               // MAY THROW (A)
+
+            expandable_box<box_type, strategy_type> elements_box(detail::get_strategy(parameters));
+            for ( std::size_t j = first ; j < first + elements_count ; ++j )
+            {
+                // this container should have memory allocated, reserve() called above
+                elements.push_back(internal_element(boxes[j], nodes[j]));                   // MAY THROW (A?,C) - however in normal conditions shouldn't
+                nodes[j] = 0;
+
+                elements_box.expand(boxes[j]);
+            }
+            parent_boxes[i] = elements_box.get();
+            first += elements_count;
+        }
+    }
+
     inline static
     subtree_elements_counts calculate_subtree_elements_counts(size_type elements_count, parameters_type const& parameters, size_type & leafs_level)
     {
@@ -0,0 +1,584 @@
+// Boost.Geometry Index
+//
+// R-tree external memory sort used by packing
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_EXTERNAL_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_EXTERNAL_HPP
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/core/noncopyable.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+#if defined(BOOST_HAS_UNISTD_H)
+#include <stdlib.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <process.h>
+#endif
+
+#include <boost/geometry/algorithms/assign.hpp>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/exception.hpp>
+#include <boost/geometry/index/detail/rtree/pack_create.hpp>
+#include <boost/geometry/index/packing.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree { namespace external {
+
+// The maximum number of runs merged at once. If there are more runs they are
+// merged in several passes so the number of buffers in memory is bounded.
+static const std::size_t merge_width = 64;
+
+// The size of the buffer used to read the values from a temporary file.
+static const std::size_t read_buffer_size = 4096;
+
+// Binary file removed when it's closed.
+class temporary_file
+    : boost::noncopyable
+{
+public:
+    // If the directory is empty the file is created with std::tmpfile().
+    explicit temporary_file(std::string const& directory)
+        : m_file(0)
+    {
+        if ( directory.empty() )
+        {
+            m_file = std::tmpfile();
+        }
+        else
+        {
+            m_file = create_exclusive(directory, m_path);
+        }
+
+        if ( m_file == 0 )
+            throw_runtime_error("unable to create a temporary file");
+    }
+
+    ~temporary_file()
+    {
+        std::fclose(m_file);
+        if ( ! m_path.empty() )
+            std::remove(m_path.c_str());
+    }
+
+    template <typename T>
+    void write(T const* data, std::size_t count)
+    {
+        if ( count != 0 && std::fwrite(data, sizeof(T), count, m_file) != count )
+            throw_runtime_error("unable to write a temporary file");
+    }
+
+    template <typename T>
+    void read(T * data, std::size_t count)
+    {
+        if ( count != 0 && std::fread(data, sizeof(T), count, m_file) != count )
+            throw_runtime_error("unable to read a temporary file");
+    }
+
+    // Sets the position to the offset in bytes from the beginning of the file.
+    // NOTE: It also has to be called between writing and reading.
+    void seek(boost::uint64_t offset)
+    {
+#if defined(_MSC_VER)
+        int const result = _fseeki64(m_file, static_cast<__int64>(offset), SEEK_SET);
+#elif defined(BOOST_HAS_UNISTD_H)
+        int const result = fseeko(m_file, static_cast<off_t>(offset), SEEK_SET);
+#else
+        int const result = std::fseek(m_file, static_cast<long>(offset), SEEK_SET);
+#endif
+        if ( result != 0 )
+            throw_runtime_error("unable to seek a temporary file");
+    }
+
+private:
+    // Creates a new file in the directory in one step so an existing file is never opened
+    // and the file created can't be replaced by another process before it's opened.
+    static std::FILE * create_exclusive(std::string const& directory, std::string & path)
+    {
+#if defined(BOOST_HAS_UNISTD_H)
+        std::string const templ = directory + "/bgi_pack_XXXXXX";
+        std::vector<char> name(templ.begin(), templ.end());
+        name.push_back('\0');
+
+        int const fd = ::mkstemp(&name[0]);
+        if ( fd == -1 )
+            return 0;
+
+        std::FILE * file = ::fdopen(fd, "w+b");
+        if ( file == 0 )
+        {
+            ::close(fd);
+            ::unlink(&name[0]);
+            return 0;
+        }
+
+        path.assign(&name[0]);
+        return file;
+#else
+        // the exclusive mode "x" of C11 fails if the file already exists
+        for ( unsigned attempt = 0 ; attempt < 100 ; ++attempt )
+        {
+            std::ostringstream ss;
+            ss << directory << "/bgi_pack_" << current_process_id() << '_'
+               << static_cast<void const*>(&path) << '_' << attempt << ".tmp";
+
+            std::FILE * file = std::fopen(ss.str().c_str(), "w+bx");
+            if ( file != 0 )
+            {
+                path = ss.str();
+                return file;
+            }
+        }
+        return 0;
+#endif
+    }
+
+#if !defined(BOOST_HAS_UNISTD_H)
+    static unsigned long current_process_id()
+    {
+#if defined(_WIN32)
+        return static_cast<unsigned long>(::_getpid());
+#else
+        return 0;
+#endif
+    }
+#endif
+
+    std::FILE * m_file;
+    std::string m_path;
+};
+
+// The runs of records sorted by codes stored one after another in a temporary file.
+template <typename Value>
+class sorted_runs
+    : boost::noncopyable
+{
+public:
+    typedef std::pair<boost::uint64_t, Value> record_type;
+
+    explicit sorted_runs(std::string const& directory)
+        : m_file(directory), m_records_count(0), m_run_first(0)
+    {}
+
+    // Appends the records to the current run.
+    void write(record_type const* records, std::size_t count)
+    {
+        m_file.write(records, count);
+        m_records_count += count;
+    }
+
+    // Ends the current run.
+    void close_run()
+    {
+        m_runs.push_back(std::make_pair(m_run_first, m_records_count));
+        m_run_first = m_records_count;
+    }
+
+    // Reads count records starting from the record with index first.
+    void read(boost::uint64_t first, record_type * records, std::size_t count)
+    {
+        m_file.seek(first * sizeof(record_type));
+        m_file.read(records, count);
+    }
+
+    std::size_t runs_count() const { return m_runs.size(); }
+
+    // The range of indexes of records of a run.
+    std::pair<boost::uint64_t, boost::uint64_t> const& run(std::size_t i) const { return m_runs[i]; }
+
+private:
+    temporary_file m_file;
+    std::vector< std::pair<boost::uint64_t, boost::uint64_t> > m_runs;
+    boost::uint64_t m_records_count;
+    boost::uint64_t m_run_first;
+};
+
+// Merges the runs [first_run, last_run). The records with equal codes are
+// returned in the order of runs so the order of the stable sort is preserved.
+template <typename Value>
+class runs_merger
+    : boost::noncopyable
+{
+public:
+    typedef typename sorted_runs<Value>::record_type record_type;
+
+private:
+    struct cursor
+    {
+        boost::uint64_t next;
+        boost::uint64_t last;
+        std::vector<record_type> buffer;
+        std::size_t current;
+    };
+
+    // the code of the current record of a cursor and the index of the cursor
+    typedef std::pair<boost::uint64_t, std::size_t> heap_entry;
+    typedef std::greater<heap_entry> heap_compare;
+
+public:
+    runs_merger(sorted_runs<Value> & runs,
+                std::size_t first_run, std::size_t last_run,
+                std::size_t buffer_size)
+        : m_runs(runs), m_cursors(last_run - first_run), m_buffer_size(buffer_size)
+    {
+        m_heap.reserve(m_cursors.size());
+        for ( std::size_t i = 0 ; i < m_cursors.size() ; ++i )
+        {
+            cursor & c = m_cursors[i];
+            c.next = runs.run(first_run + i).first;
+            c.last = runs.run(first_run + i).second;
+            if ( fill(c) )
+                m_heap.push_back(heap_entry(c.buffer[0].first, i));
+        }
+        std::make_heap(m_heap.begin(), m_heap.end(), heap_compare());
+    }
+
+    bool empty() const { return m_heap.empty(); }
+
+    // Returns the next record. The reference is valid until the next call.
+    record_type const& next()
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(! m_heap.empty(), "there are no more records");
+
+        std::pop_heap(m_heap.begin(), m_heap.end(), heap_compare());
+        cursor & c = m_cursors[m_heap.back().second];
+
+        m_current = c.buffer[c.current];
+        ++c.current;
+
+        if ( c.current < c.buffer.size() || fill(c) )
+        {
+            m_heap.back().first = c.buffer[c.current].first;
+            std::push_heap(m_heap.begin(), m_heap.end(), heap_compare());
+        }
+        else
+        {
+            m_heap.pop_back();
+        }
+
+        return m_current;
+    }
+
+private:
+    bool fill(cursor & c)
+    {
+        if ( c.next == c.last )
+            return false;
+
+        std::size_t const count = static_cast<std::size_t>(
+            (std::min)(boost::uint64_t(m_buffer_size), c.last - c.next));
+        c.buffer.resize(count);
+        m_runs.read(c.next, &c.buffer[0], count);
+        c.next += count;
+        c.current = 0;
+        return true;
+    }
+
+    sorted_runs<Value> & m_runs;
+    std::vector<cursor> m_cursors;
+    std::vector<heap_entry> m_heap;
+    std::size_t m_buffer_size;
+    record_type m_current;
+};
+
+// Reads the values from the range of forward iterators.
+template <typename FwdIt>
+class iterator_source
+{
+public:
+    explicit iterator_source(FwdIt first) : m_it(first) {}
+
+    template <typename Records>
+    void read(Records & records, std::size_t count)
+    {
+        for ( std::size_t i = 0 ; i < count ; ++i, ++m_it )
+            records.push_back(typename Records::value_type(0, *m_it));
+    }
+
+private:
+    FwdIt m_it;
+};
+
+// Reads the values from the beginning of the temporary file.
+template <typename Value>
+class file_source
+{
+public:
+    explicit file_source(temporary_file & file)
+        : m_file(file)
+    {
+        m_file.seek(0);
+    }
+
+    template <typename Records>
+    void read(Records & records, std::size_t count)
+    {
+        while ( 0 < count )
+        {
+            std::size_t const n = (std::min)(count, read_buffer_size);
+            m_buffer.resize(n);
+            m_file.read(&m_buffer[0], n);
+            for ( std::size_t i = 0 ; i < n ; ++i )
+                records.push_back(typename Records::value_type(0, m_buffer[i]));
+            count -= n;
+        }
+    }
+
+private:
+    temporary_file & m_file;
+    std::vector<Value> m_buffer;
+};
+
+// Sorts the values by the codes of the centers of their bounding boxes on the
+// space-filling curve, the same way as pack::apply_sorted(), using bounded
+// memory. At most max_values values are sorted in memory at once. The sorted
+// parts (runs) are stored in a temporary file and then merged. If all of the
+// values fit in memory the temporary files are not created.
+// The sorted values are then read one by one with next().
+template <typename Value, typename Box>
+class external_sort
+    : boost::noncopyable
+{
+    // the values are copied byte by byte, they can't own any resources
+    BOOST_MPL_ASSERT_MSG((boost::has_trivial_destructor<Value>::value),
+                         VALUE_TYPE_CANNOT_BE_STORED_IN_TEMPORARY_FILE,
+                         (Value));
+
+    typedef sorted_runs<Value> runs_type;
+    typedef typename runs_type::record_type record_type;
+
+public:
+    template <typename InIt, typename Translator, typename Strategy, typename Curve>
+    external_sort(InIt first, InIt last,
+                  Translator const& translator,
+                  Strategy const& strategy,
+                  index::external_sort_packing<Curve> const& policy)
+        : m_max_values(policy.max_values())
+        , m_directory(policy.temporary_directory())
+        , m_values_count(0)
+        , m_current(0)
+    {
+        typedef typename std::iterator_traits<InIt>::iterator_category category;
+        sort<Curve>(first, last, translator, strategy,
+                    typename boost::is_convertible<category, std::forward_iterator_tag>::type());
+    }
+
+    boost::uint64_t values_count() const { return m_values_count; }
+
+    // Returns the next value in the sorted order. The reference is valid
+    // until the next call.
+    Value const& next()
+    {
+        if ( m_merger )
+            return m_merger->next().second;
+
+        BOOST_GEOMETRY_INDEX_ASSERT(m_current < m_records.size(), "there are no more values");
+        return m_records[m_current++].second;
+    }
+
+private:
+    // Forward iterators, the range is traversed twice.
+    template <typename Curve, typename FwdIt, typename Translator, typename Strategy>
+    void sort(FwdIt first, FwdIt last,
+              Translator const& translator, Strategy const& strategy,
+              boost::true_type /*is_forward*/)
+    {
+        Box bounds;
+        geometry::assign_inverse(bounds);
+        bool initialized = false;
+        for ( FwdIt it = first ; it != last ; ++it, ++m_values_count )
+            expand(bounds, initialized, translator(*it), strategy);
+
+        iterator_source<FwdIt> source(first);
+        create_runs<Curve>(source, bounds, translator, strategy);
+    }
+
+    // Input iterators, the range is traversed once. If the values don't fit in
+    // memory all of them are stored in a temporary file first.
+    template <typename Curve, typename InIt, typename Translator, typename Strategy>
+    void sort(InIt first, InIt last,
+              Translator const& translator, Strategy const& strategy,
+              boost::false_type /*is_forward*/)
+    {
+        Box bounds;
+        geometry::assign_inverse(bounds);
+        bool initialized = false;
+
+        for ( ; first != last && m_records.size() < m_max_values ; ++first )
+        {
+            m_records.push_back(record_type(0, *first));
+            expand(bounds, initialized, translator(m_records.back().second), strategy);
+        }
+        m_values_count = m_records.size();
+
+        if ( first == last )
+        {
+            sort_records<Curve>(bounds, translator, strategy);
+            return;
+        }
+
+        temporary_file values_file(m_directory);
+        std::vector<Value> buffer;
+        buffer.reserve(m_max_values);
+        for ( std::size_t i = 0 ; i < m_records.size() ; ++i )
+            buffer.push_back(m_records[i].second);
+        std::vector<record_type>().swap(m_records);
+
+        for ( ; first != last ; ++first, ++m_values_count )
+        {
+            if ( buffer.size() == m_max_values )
+            {
+                values_file.write(&buffer[0], buffer.size());
+                buffer.clear();
+            }
+
+            buffer.push_back(*first);
+            expand(bounds, initialized, translator(buffer.back()), strategy);
+        }
+        values_file.write(&buffer[0], buffer.size());
+        std::vector<Value>().swap(buffer);
+
+        file_source<Value> source(values_file);
+        create_runs<Curve>(source, bounds, translator, strategy);
+    }
+
+    // Sorts the parts of the values in memory and stores them as runs.
+    // Then merges the runs until they can be merged at once in next().
+    template <typename Curve, typename Source, typename Translator, typename Strategy>
+    void create_runs(Source & source, Box const& bounds,
+                     Translator const& translator, Strategy const& strategy)
+    {
+        if ( m_values_count <= m_max_values )
+        {
+            m_records.reserve(static_cast<std::size_t>(m_values_count));
+            source.read(m_records, static_cast<std::size_t>(m_values_count));
+            sort_records<Curve>(bounds, translator, strategy);
+            return;
+        }
+
+        m_runs.reset(new runs_type(m_directory));
+        m_records.reserve(m_max_values);
+        for ( boost::uint64_t done = 0 ; done < m_values_count ; )
+        {
+            std::size_t const count = static_cast<std::size_t>(
+                (std::min)(boost::uint64_t(m_max_values), m_values_count - done));
+
+            m_records.clear();
+            source.read(m_records, count);
+            sort_records<Curve>(bounds, translator, strategy);
+
+            m_runs->write(&m_records[0], count);
+            m_runs->close_run();
+            done += count;
+        }
+        std::vector<record_type>().swap(m_records);
+
+        while ( merge_width < m_runs->runs_count() )
+        {
+            merge_runs();
+        }
+
+        std::size_t const buffer_size = (std::max)(std::size_t(1), m_max_values / m_runs->runs_count());
+        m_merger.reset(new runs_merger<Value>(*m_runs, 0, m_runs->runs_count(), buffer_size));
+    }
+
+    // Merges each merge_width runs into one run stored in a new file.
+    void merge_runs()
+    {
+        std::size_t const runs_count = m_runs->runs_count();
+        std::size_t const buffer_size = (std::max)(std::size_t(1), m_max_values / (merge_width + 1));
+
+        boost::scoped_ptr<runs_type> merged(new runs_type(m_directory));
+        std::vector<record_type> output;
+        output.reserve(buffer_size);
+
+        for ( std::size_t r = 0 ; r < runs_count ; r += merge_width )
+        {
+            runs_merger<Value> merger(*m_runs, r, (std::min)(r + merge_width, runs_count), buffer_size);
+            while ( ! merger.empty() )
+            {
+                output.push_back(merger.next());
+                if ( output.size() == buffer_size )
+                {
+                    merged->write(&output[0], output.size());
+                    output.clear();
+                }
+            }
+            if ( ! output.empty() )
+            {
+                merged->write(&output[0], output.size());
+                output.clear();
+            }
+            merged->close_run();
+        }
+
+        m_runs.swap(merged);
+    }
+
+    template <typename Curve, typename Translator, typename Strategy>
+    void sort_records(Box const& bounds, Translator const& translator, Strategy const& strategy)
+    {
+        for ( typename std::vector<record_type>::iterator it = m_records.begin() ;
+              it != m_records.end() ; ++it )
+        {
+            Box b;
+            detail::bounds(translator(it->second), b, strategy);
+            it->first = pack_utils::sfc_code<Curve>::apply(b, bounds);
+        }
+
+        std::stable_sort(m_records.begin(), m_records.end(), pack_utils::code_entries_comparer());
+        m_current = 0;
+    }
+
+    template <typename Indexable, typename Strategy>
+    static void expand(Box & bounds, bool & initialized,
+                       Indexable const& indexable, Strategy const& strategy)
+    {
+        // NOTE: added for consistency with insert()
+        BOOST_GEOMETRY_INDEX_ASSERT(detail::is_valid(indexable), "Indexable is invalid");
+
+        if ( ! initialized )
+        {
+            detail::bounds(indexable, bounds, strategy);
+            initialized = true;
+        }
+        else
+        {
+            detail::expand(bounds, indexable, strategy);
+        }
+    }
+
+    std::size_t m_max_values;
+    std::string m_directory;
+    boost::uint64_t m_values_count;
+
+    // the values sorted in memory
+    std::vector<record_type> m_records;
+    std::size_t m_current;
+
+    boost::scoped_ptr<runs_type> m_runs;
+    boost::scoped_ptr< runs_merger<Value> > m_merger;
+};
+
+}}}}}} // namespace boost::geometry::index::detail::rtree::external
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_EXTERNAL_HPP
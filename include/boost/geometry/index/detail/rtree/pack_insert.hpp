@@ -0,0 +1,297 @@
+// Boost.Geometry Index
+//
+// R-tree bulk insertion of packed subtrees
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_INSERT_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_INSERT_HPP
+
+#include <iterator>
+
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/vector.hpp>
+
+#include <boost/geometry/index/detail/rtree/pack_create.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/insert.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
+
+// The values are packed into a separate tree with the default packing algorithm.
+// Then the elements of the nodes of this tree at graft level are inserted into
+// the existing tree at the same level, the same way as the elements of underflowed
+// nodes are reinserted by remove(). So the packed subtrees are grafted into
+// the existing tree and only one path is traversed for each of them.
+// The internal nodes of the packed tree above the graft level are destroyed.
+// If there are at least as many new values as existing ones or if the tree
+// contains only the root leaf, the tree is created again from all of the values.
+template <typename MembersHolder>
+class pack_insert
+{
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename MembersHolder::node_pointer node_pointer;
+    typedef typename MembersHolder::size_type size_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename rtree::elements_type<internal_node>::type internal_elements;
+    typedef typename internal_elements::value_type internal_element;
+    typedef typename rtree::elements_type<leaf>::type leaf_elements;
+
+    typedef detail::rtree::pack<MembersHolder> pack;
+
+public:
+    template <typename InIt, typename TmpAlloc> inline static
+    void apply(InIt first, InIt last,
+               node_pointer & root,
+               size_type & values_count,
+               size_type & leafs_level,
+               size_type graft_level,
+               parameters_type const& parameters,
+               translator_type const& translator,
+               allocators_type & allocators,
+               TmpAlloc const& temp_allocator)
+    {
+        typedef typename std::iterator_traits<InIt>::difference_type diff_type;
+
+        diff_type const diff = std::distance(first, last);
+        if ( diff <= 0 )
+            return;
+
+        if ( root == 0 || leafs_level == 0
+          || values_count <= static_cast<size_type>(diff) )
+        {
+            repack(first, last, root, values_count, leafs_level,
+                   parameters, translator, allocators, temp_allocator);                                 // MAY THROW (V, E: alloc, copy, N: alloc)
+            return;
+        }
+
+        size_type batch_count = 0, batch_leafs_level = 0;
+        node_pointer batch_root = pack::apply(first, last, batch_count, batch_leafs_level,
+                                              parameters, translator, allocators, temp_allocator);      // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        // the level of the nodes whose elements are inserted
+        size_type level = graft_level;
+        if ( batch_leafs_level < level )
+            level = batch_leafs_level;
+        if ( leafs_level < level )
+            level = leafs_level;
+
+        if ( level == 0 )
+        {
+            graft_values(batch_root, batch_leafs_level, root, leafs_level,
+                         parameters, translator, allocators);                                           // MAY THROW (V, E: alloc, copy, N: alloc)
+        }
+        else
+        {
+            typedef typename boost::container::allocator_traits<TmpAlloc>::
+                template rebind_alloc<internal_element> temp_element_allocator_type;
+            temp_element_allocator_type temp_element_allocator(temp_allocator);
+            boost::container::vector<internal_element, temp_element_allocator_type>
+                subtrees(temp_element_allocator);
+
+            BOOST_TRY
+            {
+                collect_subtrees(batch_root, batch_leafs_level, level, subtrees);                       // MAY THROW (E: alloc, copy)
+            }
+            BOOST_CATCH(...)
+            {
+                // the subtrees are still owned by the packed tree
+                visitors::destroy<MembersHolder>::apply(batch_root, allocators);
+                BOOST_RETHROW                                                                           // RETHROW
+            }
+            BOOST_CATCH_END
+
+            destroy_internal_nodes(batch_root, batch_leafs_level, level, allocators);
+
+            graft_subtrees(subtrees.begin(), subtrees.end(), level, root, leafs_level,
+                           parameters, translator, allocators);                                         // MAY THROW (V, E: alloc, copy, N: alloc)
+        }
+
+        values_count += batch_count;
+    }
+
+private:
+    template <typename InIt, typename TmpAlloc> inline static
+    void repack(InIt first, InIt last,
+                node_pointer & root,
+                size_type & values_count,
+                size_type & leafs_level,
+                parameters_type const& parameters,
+                translator_type const& translator,
+                allocators_type & allocators,
+                TmpAlloc const& temp_allocator)
+    {
+        typedef typename boost::container::allocator_traits<TmpAlloc>::
+            template rebind_alloc<value_type> temp_value_allocator_type;
+        temp_value_allocator_type temp_value_allocator(temp_allocator);
+        boost::container::vector<value_type, temp_value_allocator_type> values(temp_value_allocator);
+
+        values.reserve(values_count + static_cast<size_type>(std::distance(first, last)));      // MAY THROW (A)
+        if ( root != 0 )
+            collect_values(root, leafs_level, values);                                          // MAY THROW (V: copy)
+        values.insert(values.end(), first, last);                                               // MAY THROW (V: copy)
+
+        size_type vc = 0, ll = 0;
+        node_pointer new_root = pack::apply(values.begin(), values.end(), vc, ll,
+                                            parameters, translator, allocators, temp_allocator); // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        if ( root != 0 )
+            visitors::destroy<MembersHolder>::apply(root, allocators);
+
+        root = new_root;
+        values_count = vc;
+        leafs_level = ll;
+    }
+
+    template <typename Values> inline static
+    void collect_values(node_pointer n, size_type height, Values & values)
+    {
+        if ( height == 0 )
+        {
+            leaf_elements const& elements = rtree::elements(rtree::get<leaf>(*n));
+            values.insert(values.end(), elements.begin(), elements.end());                      // MAY THROW (V: copy)
+        }
+        else
+        {
+            internal_elements const& elements = rtree::elements(rtree::get<internal_node>(*n));
+            for ( typename internal_elements::const_iterator it = elements.begin() ;
+                  it != elements.end() ; ++it )
+            {
+                collect_values(it->second, height - 1, values);                                 // MAY THROW (V: copy)
+            }
+        }
+    }
+
+    // Stores the elements of the nodes at the level, the children are still owned
+    // by these nodes.
+    template <typename Subtrees> inline static
+    void collect_subtrees(node_pointer n, size_type height, size_type level, Subtrees & subtrees)
+    {
+        internal_elements const& elements = rtree::elements(rtree::get<internal_node>(*n));
+        if ( height == level )
+        {
+            subtrees.insert(subtrees.end(), elements.begin(), elements.end());                  // MAY THROW (E: alloc, copy)
+        }
+        else
+        {
+            for ( typename internal_elements::const_iterator it = elements.begin() ;
+                  it != elements.end() ; ++it )
+            {
+                collect_subtrees(it->second, height - 1, level, subtrees);                      // MAY THROW (E: alloc, copy)
+            }
+        }
+    }
+
+    // Destroys the internal nodes at the level and above without their children.
+    inline static
+    void destroy_internal_nodes(node_pointer n, size_type height, size_type level,
+                                allocators_type & allocators)
+    {
+        if ( height > level )
+        {
+            internal_elements const& elements = rtree::elements(rtree::get<internal_node>(*n));
+            for ( typename internal_elements::const_iterator it = elements.begin() ;
+                  it != elements.end() ; ++it )
+            {
+                destroy_internal_nodes(it->second, height - 1, level, allocators);
+            }
+        }
+
+        rtree::destroy_node<allocators_type, internal_node>::apply(allocators, n);
+    }
+
+    template <typename It> inline static
+    void destroy_subtrees(It first, It last, allocators_type & allocators)
+    {
+        for ( ; first != last ; ++first )
+            visitors::destroy<MembersHolder>::apply(first->second, allocators);
+    }
+
+    template <typename It> inline static
+    void graft_subtrees(It first, It last, size_type level,
+                        node_pointer & root,
+                        size_type & leafs_level,
+                        parameters_type const& parameters,
+                        translator_type const& translator,
+                        allocators_type & allocators)
+    {
+        BOOST_TRY
+        {
+            for ( ; first != last ; ++first )
+            {
+                visitors::insert<internal_element, MembersHolder>
+                    insert_v(root, leafs_level, *first,
+                             parameters, translator, allocators, level);
+
+                rtree::apply_visitor(insert_v, *root);                                          // MAY THROW (V, E: alloc, copy, N: alloc)
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            destroy_subtrees(++first, last, allocators);
+            BOOST_RETHROW                                                                       // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+    // The packed tree is small, the values are inserted one by one.
+    inline static
+    void graft_values(node_pointer batch_root, size_type batch_leafs_level,
+                      node_pointer & root,
+                      size_type & leafs_level,
+                      parameters_type const& parameters,
+                      translator_type const& translator,
+                      allocators_type & allocators)
+    {
+        rtree::subtree_destroyer<MembersHolder> batch_destroyer(batch_root, allocators);
+        insert_values(batch_root, batch_leafs_level, root, leafs_level,
+                      parameters, translator, allocators);                                      // MAY THROW (V, E: alloc, copy, N: alloc)
+    }
+
+    inline static
+    void insert_values(node_pointer n, size_type height,
+                       node_pointer & root,
+                       size_type & leafs_level,
+                       parameters_type const& parameters,
+                       translator_type const& translator,
+                       allocators_type & allocators)
+    {
+        if ( height == 0 )
+        {
+            leaf_elements const& elements = rtree::elements(rtree::get<leaf>(*n));
+            for ( typename leaf_elements::const_iterator it = elements.begin() ;
+                  it != elements.end() ; ++it )
+            {
+                visitors::insert<value_type, MembersHolder>
+                    insert_v(root, leafs_level, *it, parameters, translator, allocators);
+
+                rtree::apply_visitor(insert_v, *root);                                          // MAY THROW (V, E: alloc, copy, N: alloc)
+            }
+        }
+        else
+        {
+            internal_elements const& elements = rtree::elements(rtree::get<internal_node>(*n));
+            for ( typename internal_elements::const_iterator it = elements.begin() ;
+                  it != elements.end() ; ++it )
+            {
+                insert_values(it->second, height - 1, root, leafs_level,
+                              parameters, translator, allocators);                              // MAY THROW (V, E: alloc, copy, N: alloc)
+            }
+        }
+    }
+};
+
+}}}}} // namespace boost::geometry::index::detail::rtree
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_INSERT_HPP
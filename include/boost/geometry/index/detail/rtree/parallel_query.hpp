@@ -0,0 +1,138 @@
+// Boost.Geometry Index
+//
+// R-tree parallel spatial query implementation
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PARALLEL_QUERY_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PARALLEL_QUERY_HPP
+
+#include <iterator>
+#include <vector>
+
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/query_output.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/spatial_query.hpp>
+
+#include <boost/geometry/util/parallel.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
+
+// The top levels of the tree are traversed level by level and the nodes
+// meeting the predicates are gathered until there are several nodes for each
+// thread. Then the threads take the nodes one by one and query the subtrees
+// with the default spatial query visitor. The values found in each subtree are
+// stored in a separate buffer and the buffers are written to the output by
+// the calling thread in the order of the nodes. So the values are written
+// in the same order as by the sequential query.
+template <typename MembersHolder, typename Predicates>
+class parallel_query
+{
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::size_type size_type;
+
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::node_pointer node_pointer;
+
+    typedef typename rtree::elements_type<internal_node>::type internal_elements;
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    typedef std::vector<value_type> buffer_type;
+    typedef std::back_insert_iterator<buffer_type> buffer_iterator;
+    typedef visitors::spatial_query<MembersHolder, Predicates, buffer_iterator> query_type;
+
+    static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
+
+public:
+    static const std::size_t nodes_per_thread = 16;
+
+    template <typename OutIter>
+    static inline size_type apply(MembersHolder const& members, Predicates const& predicates,
+                                  OutIter out_it, std::size_t threads)
+    {
+        std::vector<node_pointer> nodes;
+        nodes.push_back(members.root);
+
+        strategy_type const strategy = index::detail::get_strategy(members.parameters());
+
+        // split the internal nodes, all of the nodes are at the same level
+        std::vector<node_pointer> next;
+        for ( size_type level = 0 ;
+              level < members.leafs_level && nodes.size() < threads * nodes_per_thread ;
+              ++level )
+        {
+            next.clear();
+            for ( std::size_t i = 0 ; i < nodes.size() ; ++i )
+            {
+                internal_elements const& elements = rtree::elements(rtree::get<internal_node>(*nodes[i]));
+                for ( typename internal_elements::const_iterator it = elements.begin() ;
+                      it != elements.end() ; ++it )
+                {
+                    // 0 - dummy value
+                    if ( index::detail::predicates_check
+                            <
+                                index::detail::bounds_tag, 0, predicates_len
+                            >(predicates, 0, it->first, strategy) )
+                    {
+                        next.push_back(it->second);
+                    }
+                }
+            }
+            nodes.swap(next);
+        }
+
+        std::vector<buffer_type> buffers(nodes.size());
+        geometry::detail::parallel::for_each_index(nodes.size(), threads,
+            query_node(members, predicates, nodes, buffers));
+
+        typedef index::detail::query_output<OutIter> output_type;
+
+        size_type result = 0;
+        for ( std::size_t i = 0 ; i < buffers.size() ; ++i )
+        {
+            for ( typename buffer_type::const_iterator it = buffers[i].begin() ;
+                  it != buffers[i].end() ; ++it )
+            {
+                ++result;
+
+                if ( ! output_type::apply(out_it, *it) )
+                    return result;
+            }
+        }
+        return result;
+    }
+
+private:
+    // Queries the subtree of the node into its buffer.
+    struct query_node
+    {
+        query_node(MembersHolder const& m, Predicates const& p,
+                   std::vector<node_pointer> const& n,
+                   std::vector<buffer_type> & b)
+            : members(m), predicates(p), nodes(n), buffers(b)
+        {}
+
+        bool operator()(std::size_t i) const
+        {
+            query_type query_v(members.parameters(), members.translator(),
+                               predicates, std::back_inserter(buffers[i]));
+            rtree::apply_visitor(query_v, *nodes[i]);
+            return true;
+        }
+
+        MembersHolder const& members;
+        Predicates const& predicates;
+        std::vector<node_pointer> const& nodes;
+        std::vector<buffer_type> & buffers;
+    };
+};
+
+}}}}} // namespace boost::geometry::index::detail::rtree
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PARALLEL_QUERY_HPP
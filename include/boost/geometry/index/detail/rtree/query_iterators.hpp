@@ -62,14 +62,19 @@ struct end_query_iterator
     }
 };
 
-template <typename MembersHolder, typename Predicates>
+template
+<
+    typename MembersHolder,
+    typename Predicates,
+    typename Statistics = index::detail::no_query_statistics
+>
 class spatial_query_iterator
 {
     typedef typename MembersHolder::parameters_type parameters_type;
     typedef typename MembersHolder::translator_type translator_type;
     typedef typename MembersHolder::allocators_type allocators_type;
 
-    typedef visitors::spatial_query_incremental<MembersHolder, Predicates> visitor_type;
+    typedef visitors::spatial_query_incremental<MembersHolder, Predicates, Statistics> visitor_type;
     typedef typename visitor_type::node_pointer node_pointer;
 
 public:
@@ -82,12 +87,14 @@ public:
     inline spatial_query_iterator()
     {}
 
-    inline spatial_query_iterator(parameters_type const& par, translator_type const& t, Predicates const& p)
-        : m_visitor(par, t, p)
+    inline spatial_query_iterator(parameters_type const& par, translator_type const& t, Predicates const& p,
+                                  Statistics const& stats = Statistics())
+        : m_visitor(par, t, p, stats)
     {}
 
-    inline spatial_query_iterator(node_pointer root, parameters_type const& par, translator_type const& t, Predicates const& p)
-        : m_visitor(par, t, p)
+    inline spatial_query_iterator(node_pointer root, parameters_type const& par, translator_type const& t, Predicates const& p,
+                                  Statistics const& stats = Statistics())
+        : m_visitor(par, t, p, stats)
     {
         m_visitor.initialize(root);
     }
@@ -134,14 +141,20 @@ private:
     visitor_type m_visitor;
 };
 
-template <typename MembersHolder, typename Predicates, unsigned NearestPredicateIndex>
+template
+<
+    typename MembersHolder,
+    typename Predicates,
+    unsigned NearestPredicateIndex,
+    typename Statistics = index::detail::no_query_statistics
+>
 class distance_query_iterator
 {
     typedef typename MembersHolder::parameters_type parameters_type;
     typedef typename MembersHolder::translator_type translator_type;
     typedef typename MembersHolder::allocators_type allocators_type;
 
-    typedef visitors::distance_query_incremental<MembersHolder, Predicates, NearestPredicateIndex> visitor_type;
+    typedef visitors::distance_query_incremental<MembersHolder, Predicates, NearestPredicateIndex, Statistics> visitor_type;
     typedef typename visitor_type::node_pointer node_pointer;
 
 public:
@@ -154,12 +167,14 @@ public:
     inline distance_query_iterator()
     {}
 
-    inline distance_query_iterator(parameters_type const& par, translator_type const& t, Predicates const& p)
-        : m_visitor(par, t, p)
+    inline distance_query_iterator(parameters_type const& par, translator_type const& t, Predicates const& p,
+                                   Statistics const& stats = Statistics())
+        : m_visitor(par, t, p, stats)
     {}
 
-    inline distance_query_iterator(node_pointer root, parameters_type const& par, translator_type const& t, Predicates const& p)
-        : m_visitor(par, t, p)
+    inline distance_query_iterator(node_pointer root, parameters_type const& par, translator_type const& t, Predicates const& p,
+                                   Statistics const& stats = Statistics())
+        : m_visitor(par, t, p, stats)
     {
         m_visitor.initialize(root);
     }
@@ -121,9 +121,13 @@ bool are_boxes_ok(Rtree const& tree, bool exact_match = true)
     typedef utilities::view<Rtree> RTV;
     RTV rtv(tree);
 
+    // the visitor stores references so the copies must outlive it
+    typename Rtree::parameters_type const parameters = tree.parameters();
+    typename RTV::translator_type const translator = rtv.translator();
+
     visitors::are_boxes_ok<
         typename RTV::members_holder
-    > v(tree.parameters(), rtv.translator(), exact_match);
+    > v(parameters, translator, exact_match);
     
     rtv.apply_visitor(v);
 
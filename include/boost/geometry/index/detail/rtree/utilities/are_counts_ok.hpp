@@ -102,9 +102,12 @@ bool are_counts_ok(Rtree const& tree, bool check_min = true)
     typedef utilities::view<Rtree> RTV;
     RTV rtv(tree);
 
+    // the visitor stores a reference so the copy must outlive it
+    typename Rtree::parameters_type const parameters = tree.parameters();
+
     visitors::are_counts_ok<
         typename RTV::members_holder
-    > v(tree.parameters(), check_min);
+    > v(parameters, check_min);
     
     rtv.apply_visitor(v);
 
@@ -0,0 +1,177 @@
+// Boost.Geometry Index
+//
+// R-tree visitor calculating the quality of the structure
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_UTILITIES_QUALITY_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_UTILITIES_QUALITY_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/algorithms/content.hpp>
+#include <boost/geometry/index/detail/algorithms/intersection_content.hpp>
+#include <boost/geometry/index/detail/algorithms/margin.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree { namespace utilities {
+
+// The quality of the nodes at one level of the tree.
+// The comparable margin is the sum of the lengths of the edges of a box
+// adjacent to one corner, it's proportional to the margin of the box.
+// The overlap is the sum of the contents of the intersections of the boxes
+// of the elements of the same node. The dead content is the content of the
+// nodes not covered by the boxes of their elements. It is approximated with
+// the sum of the contents of the elements minus the overlap.
+struct level_quality
+{
+    level_quality()
+        : nodes(0), elements(0), fill_factor(0)
+        , content(0), comparable_margin(0), overlap(0), dead_content(0)
+    {}
+
+    std::size_t nodes;
+    std::size_t elements;
+    double fill_factor;
+    double content;
+    double comparable_margin;
+    double overlap;
+    double dead_content;
+};
+
+namespace visitors {
+
+template <typename MembersHolder>
+class quality
+    : public MembersHolder::visitor_const
+{
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+public:
+    quality(parameters_type const& parameters, translator_type const& tr, box_type const& root_box)
+        : m_tr(tr), m_strategy(index::detail::get_strategy(parameters))
+        , m_box(root_box), m_level(0)
+    {}
+
+    void operator()(internal_node const& n)
+    {
+        typedef typename rtree::elements_type<internal_node>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        m_boxes.clear();
+        for ( typename elements_type::const_iterator it = elements.begin() ; it != elements.end() ; ++it )
+            m_boxes.push_back(it->first);
+        update_level();
+
+        box_type const box_bckup = m_box;
+        ++m_level;
+
+        for ( typename elements_type::const_iterator it = elements.begin() ; it != elements.end() ; ++it )
+        {
+            m_box = it->first;
+            rtree::apply_visitor(*this, *it->second);
+        }
+
+        --m_level;
+        m_box = box_bckup;
+    }
+
+    void operator()(leaf const& n)
+    {
+        typedef typename rtree::elements_type<leaf>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        m_boxes.clear();
+        for ( typename elements_type::const_iterator it = elements.begin() ; it != elements.end() ; ++it )
+        {
+            box_type b;
+            index::detail::bounds(m_tr(*it), b, m_strategy);
+            m_boxes.push_back(b);
+        }
+        update_level();
+    }
+
+    std::vector<level_quality> levels;
+
+private:
+    void update_level()
+    {
+        if ( levels.size() <= m_level )
+            levels.resize(m_level + 1);
+
+        level_quality & q = levels[m_level];
+
+        double const content = index::detail::content(m_box);
+        double elements_content = 0;
+        double overlap = 0;
+        for ( std::size_t i = 0 ; i < m_boxes.size() ; ++i )
+        {
+            elements_content += index::detail::content(m_boxes[i]);
+            for ( std::size_t j = i + 1 ; j < m_boxes.size() ; ++j )
+                overlap += index::detail::intersection_content(m_boxes[i], m_boxes[j], m_strategy);
+        }
+
+        double const covered = elements_content - overlap;
+
+        ++q.nodes;
+        q.elements += m_boxes.size();
+        q.content += content;
+        q.comparable_margin += index::detail::comparable_margin(m_box);
+        q.overlap += overlap;
+        q.dead_content += covered < content ? content - (covered > 0 ? covered : 0) : 0;
+    }
+
+    translator_type const& m_tr;
+    strategy_type m_strategy;
+    box_type m_box;
+    std::size_t m_level;
+    std::vector<box_type> m_boxes;
+};
+
+} // namespace visitors
+
+// Returns the quality of each level of the tree, starting from the root.
+// For an empty tree one level with all members equal to 0 is returned.
+template <typename Rtree> inline
+std::vector<level_quality> quality(Rtree const& tree)
+{
+    if ( tree.empty() )
+        return std::vector<level_quality>(1);
+
+    typedef utilities::view<Rtree> RTV;
+    RTV rtv(tree);
+
+    // the visitor stores references so the copies must outlive it
+    typename Rtree::parameters_type const parameters = tree.parameters();
+    typename RTV::translator_type const translator = rtv.translator();
+
+    visitors::quality<
+        typename RTV::members_holder
+    > v(parameters, translator, tree.bounds());
+
+    rtv.apply_visitor(v);
+
+    for ( std::size_t i = 0 ; i < v.levels.size() ; ++i )
+    {
+        level_quality & q = v.levels[i];
+        q.fill_factor = double(q.elements) / double(q.nodes * parameters.get_max_elements());
+    }
+
+    return v.levels;
+}
+
+}}}}}} // namespace boost::geometry::index::detail::rtree::utilities
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_UTILITIES_QUALITY_HPP
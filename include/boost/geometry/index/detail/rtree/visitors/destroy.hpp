@@ -15,6 +15,11 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_DELETE_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_DELETE_HPP
 
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
+
+#include <boost/geometry/index/arena_allocator.hpp>
+
 namespace boost { namespace geometry { namespace index {
 
 namespace detail { namespace rtree { namespace visitors {
@@ -31,6 +36,16 @@ public:
     typedef typename MembersHolder::allocators_type allocators_type;
     typedef typename MembersHolder::node_pointer node_pointer;
 
+    // The nodes allocated in the arena own nothing but the memory of the arena
+    // if Values and Boxes are trivially destructible. So they're not destroyed
+    // one by one and their memory is freed when the arena is released.
+    typedef boost::mpl::bool_
+        <
+            index::detail::is_arena_allocator<typename allocators_type::allocator_type>::value
+         && boost::has_trivial_destructor<typename MembersHolder::value_type>::value
+         && boost::has_trivial_destructor<typename MembersHolder::box_type>::value
+        > is_released_by_arena;
+
     inline destroy(node_pointer node, allocators_type & allocators)
         : m_current_node(node)
         , m_allocators(allocators)
@@ -48,8 +63,12 @@ public:
         for (typename elements_type::iterator it = elements.begin();
              it != elements.end(); ++it)
         {
-            m_current_node = it->second;
-            rtree::apply_visitor(*this, *m_current_node);
+            // the nodes shared with other versions of the tree are not destroyed
+            if ( ! rtree::is_shared_node(it->second, m_allocators) )
+            {
+                m_current_node = it->second;
+                rtree::apply_visitor(*this, *m_current_node);
+            }
             it->second = 0;
         }
 
@@ -66,6 +85,9 @@ public:
 
     static inline void apply(node_pointer node, allocators_type & allocators)
     {
+        if ( is_released_by_arena::value || rtree::is_shared_node(node, allocators) )
+            return;
+
         destroy v(node, allocators);
         rtree::apply_visitor(v, *node);
     }
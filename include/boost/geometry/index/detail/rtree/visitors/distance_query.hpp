@@ -15,6 +15,9 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_DISTANCE_QUERY_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_DISTANCE_QUERY_HPP
 
+#include <boost/geometry/index/detail/query_output.hpp>
+#include <boost/geometry/index/detail/query_statistics.hpp>
+
 namespace boost { namespace geometry { namespace index {
 
 namespace detail { namespace rtree { namespace visitors {
@@ -73,10 +76,15 @@ public:
     inline size_t finish()
     {
         typedef typename std::vector< std::pair<distance_type, Value> >::const_iterator neighbors_iterator;
-        for ( neighbors_iterator it = m_neighbors.begin() ; it != m_neighbors.end() ; ++it, ++m_out_it )
-            *m_out_it = it->second;
+        size_t result = 0;
+        for ( neighbors_iterator it = m_neighbors.begin() ; it != m_neighbors.end() ; ++it )
+        {
+            ++result;
+            if ( ! index::detail::query_output<OutIt>::apply(m_out_it, it->second) )
+                break;
+        }
 
-        return m_neighbors.size();
+        return result;
     }
 
 private:
@@ -98,7 +106,8 @@ template
     typename MembersHolder,
     typename Predicates,
     unsigned DistancePredicateIndex,
-    typename OutIter
+    typename OutIter,
+    typename Statistics = index::detail::no_query_statistics
 >
 class distance_query
     : public MembersHolder::visitor_const
@@ -127,15 +136,19 @@ public:
 
     static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
 
-    inline distance_query(parameters_type const& parameters, translator_type const& translator, Predicates const& pred, OutIter out_it)
+    inline distance_query(parameters_type const& parameters, translator_type const& translator, Predicates const& pred, OutIter out_it,
+                          Statistics const& stats = Statistics())
         : m_parameters(parameters), m_translator(translator)
         , m_pred(pred)
         , m_result(nearest_predicate_access::get(m_pred).count, out_it)
         , m_strategy(index::detail::get_strategy(parameters))
+        , m_stats(stats)
     {}
 
     inline void operator()(internal_node const& n)
     {
+        m_stats.internal_node();
+
         typedef typename rtree::elements_type<internal_node>::type elements_type;
 
         // array of active nodes
@@ -153,6 +166,8 @@ public:
         for (typename elements_type::const_iterator it = elements.begin();
             it != elements.end(); ++it)
         {
+            m_stats.box();
+
             // if current node meets predicates
             // 0 - dummy value
             if ( index::detail::predicates_check
@@ -178,6 +193,7 @@ public:
 
                 // add current node's data into the list
                 active_branch_list.push_back( std::make_pair(node_distance, it->second) );
+                m_stats.heap_push();
             }
         }
 
@@ -195,8 +211,12 @@ public:
             // if current node is further than furthest neighbor, the rest of nodes also will be further
             if ( m_result.has_enough_neighbors() &&
                  is_node_prunable(m_result.greatest_comparable_distance(), it->first) )
+            {
+                m_stats.heap_pop(active_branch_list.end() - it);
                 break;
+            }
 
+            m_stats.heap_pop();
             rtree::apply_visitor(*this, *(it->second));
         }
 
@@ -230,6 +250,8 @@ public:
 
     inline void operator()(leaf const& n)
     {
+        m_stats.leaf();
+
         typedef typename rtree::elements_type<leaf>::type elements_type;
         elements_type const& elements = rtree::elements(n);
         
@@ -237,6 +259,8 @@ public:
         for (typename elements_type::const_iterator it = elements.begin();
             it != elements.end(); ++it)
         {
+            m_stats.value();
+
             // if value meets predicates
             if ( index::detail::predicates_check
                     <
@@ -258,7 +282,9 @@ public:
 
     inline size_t finish()
     {
-        return m_result.finish();
+        size_t const result = m_result.finish();
+        m_stats.found(result);
+        return result;
     }
 
 private:
@@ -294,12 +320,191 @@ private:
     distance_query_result<value_type, translator_type, value_distance_type, OutIter> m_result;
 
     strategy_type m_strategy;
+    Statistics m_stats;
+};
+
+// Best-first knn query. In contrary to distance_query the active branches
+// of all levels are stored in one priority queue and the nearest one is
+// always visited next.
+template
+<
+    typename MembersHolder,
+    typename Predicates,
+    unsigned DistancePredicateIndex,
+    typename OutIter,
+    typename Statistics = index::detail::no_query_statistics
+>
+class distance_query_best_first
+    : public MembersHolder::visitor_const
+{
+public:
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef index::detail::predicates_element<DistancePredicateIndex, Predicates> nearest_predicate_access;
+    typedef typename nearest_predicate_access::type nearest_predicate_type;
+    typedef typename indexable_type<translator_type>::type indexable_type;
+
+    typedef index::detail::calculate_distance<nearest_predicate_type, indexable_type, strategy_type, value_tag> calculate_value_distance;
+    typedef index::detail::calculate_distance<nearest_predicate_type, box_type, strategy_type, bounds_tag> calculate_node_distance;
+    typedef typename calculate_value_distance::result_type value_distance_type;
+    typedef typename calculate_node_distance::result_type node_distance_type;
+
+    typedef std::pair<node_distance_type, typename allocators_type::node_pointer> branch_data;
+
+    static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
+
+    inline distance_query_best_first(parameters_type const& parameters, translator_type const& translator, Predicates const& pred, OutIter out_it,
+                                     size_t leafs_level, Statistics const& stats = Statistics())
+        : m_translator(translator)
+        , m_pred(pred)
+        , m_result(nearest_predicate_access::get(m_pred).count, out_it)
+        , m_strategy(index::detail::get_strategy(parameters))
+        , m_stats(stats)
+    {
+        // usually enough to avoid reallocations
+        m_branches.reserve(parameters.get_max_elements() * (leafs_level + 1));
+    }
+
+    inline void apply(node const& root)
+    {
+        rtree::apply_visitor(*this, root);
+
+        while ( !m_branches.empty() )
+        {
+            // the nearest branch is further than the furthest neighbor
+            // so all of the remaining branches are too
+            if ( m_result.has_enough_neighbors() &&
+                 is_node_prunable(m_result.greatest_comparable_distance(), m_branches.front().first) )
+                break;
+
+            typename allocators_type::node_pointer ptr = m_branches.front().second;
+            std::pop_heap(m_branches.begin(), m_branches.end(), branch_greater());
+            m_branches.pop_back();
+            m_stats.heap_pop();
+
+            rtree::apply_visitor(*this, *ptr);
+        }
+    }
+
+    inline void operator()(internal_node const& n)
+    {
+        m_stats.internal_node();
+
+        typedef typename rtree::elements_type<internal_node>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        for (typename elements_type::const_iterator it = elements.begin();
+            it != elements.end(); ++it)
+        {
+            m_stats.box();
+
+            if ( index::detail::predicates_check
+                    <
+                        index::detail::bounds_tag, 0, predicates_len
+                    >(m_pred, 0, it->first, m_strategy) )
+            {
+                node_distance_type node_distance;
+                if ( !calculate_node_distance::apply(predicate(), it->first,
+                                                     m_strategy, node_distance) )
+                {
+                    continue;
+                }
+
+                if ( m_result.has_enough_neighbors() &&
+                     is_node_prunable(m_result.greatest_comparable_distance(), node_distance) )
+                {
+                    continue;
+                }
+
+                m_branches.push_back(std::make_pair(node_distance, it->second));
+                std::push_heap(m_branches.begin(), m_branches.end(), branch_greater());
+                m_stats.heap_push();
+            }
+        }
+    }
+
+    inline void operator()(leaf const& n)
+    {
+        m_stats.leaf();
+
+        typedef typename rtree::elements_type<leaf>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        for (typename elements_type::const_iterator it = elements.begin();
+            it != elements.end(); ++it)
+        {
+            m_stats.value();
+
+            if ( index::detail::predicates_check
+                    <
+                        index::detail::value_tag, 0, predicates_len
+                    >(m_pred, *it, m_translator(*it), m_strategy) )
+            {
+                value_distance_type value_distance;
+                if ( calculate_value_distance::apply(predicate(), m_translator(*it),
+                                                     m_strategy, value_distance) )
+                {
+                    m_result.store(*it, value_distance);
+                }
+            }
+        }
+    }
+
+    inline size_t finish()
+    {
+        size_t const result = m_result.finish();
+        m_stats.found(result);
+        return result;
+    }
+
+private:
+    // function object, inlined by heap algorithms in contrary to a function pointer
+    struct branch_greater
+    {
+        inline bool operator()(branch_data const& p1, branch_data const& p2) const
+        {
+            return p1.first > p2.first;
+        }
+    };
+
+    template <typename Distance>
+    static inline bool is_node_prunable(Distance const& greatest_dist, node_distance_type const& d)
+    {
+        return greatest_dist <= d;
+    }
+
+    nearest_predicate_type const& predicate() const
+    {
+        return nearest_predicate_access::get(m_pred);
+    }
+
+    translator_type const& m_translator;
+
+    Predicates m_pred;
+    distance_query_result<value_type, translator_type, value_distance_type, OutIter> m_result;
+
+    strategy_type m_strategy;
+    Statistics m_stats;
+
+    // min-heap of the branches to visit
+    std::vector<branch_data> m_branches;
 };
 
 template <
     typename MembersHolder,
     typename Predicates,
-    unsigned DistancePredicateIndex
+    unsigned DistancePredicateIndex,
+    typename Statistics = index::detail::no_query_statistics
 >
 class distance_query_incremental
     : public MembersHolder::visitor_const
@@ -365,12 +570,14 @@ public:
 //        , m_strategy_type()
     {}
 
-    inline distance_query_incremental(parameters_type const& params, translator_type const& translator, Predicates const& pred)
+    inline distance_query_incremental(parameters_type const& params, translator_type const& translator, Predicates const& pred,
+                                      Statistics const& stats = Statistics())
         : m_translator(::boost::addressof(translator))
         , m_pred(pred)
         , current_neighbor((std::numeric_limits<size_type>::max)())
         , next_closest_node_distance((std::numeric_limits<node_distance_type>::max)())
         , m_strategy(index::detail::get_strategy(params))
+        , m_stats(stats)
     {
         BOOST_GEOMETRY_INDEX_ASSERT(0 < max_count(), "k must be greather than 0");
     }
@@ -395,7 +602,10 @@ public:
             if ( internal_stack.empty() )
             {
                 if ( new_neighbor < neighbors.size() )
+                {
                     current_neighbor = new_neighbor;
+                    m_stats.found();
+                }
                 else
                 {
                     current_neighbor = (std::numeric_limits<size_type>::max)();
@@ -423,6 +633,7 @@ public:
                      neighbors[new_neighbor].first < next_closest_node_distance )
                 {
                     current_neighbor = new_neighbor;
+                    m_stats.found();
                     return;
                 }
 
@@ -432,6 +643,7 @@ public:
                      is_node_prunable(neighbors.back().first, branches[current_branch].first) )
                 {
                     // stop traversing current level
+                    m_stats.heap_pop(branches.size() - current_branch);
                     internal_stack.pop_back();
                     continue;
                 }
@@ -439,6 +651,7 @@ public:
                 {
                     // new level - must increment current_branch before traversing of another level (mem reallocation)
                     ++current_branch;
+                    m_stats.heap_pop();
                     rtree::apply_visitor(*this, *(branches[current_branch - 1].second));
 
                     next_closest_node_distance = calc_closest_node_distance(internal_stack.begin(), internal_stack.end());
@@ -467,6 +680,8 @@ public:
     // and aren't further than found neighbours (if there is enough neighbours)
     inline void operator()(internal_node const& n)
     {
+        m_stats.internal_node();
+
         typedef typename rtree::elements_type<internal_node>::type elements_type;
         elements_type const& elements = rtree::elements(n);
 
@@ -476,6 +691,8 @@ public:
         // fill active branch list array of nodes meeting predicates
         for ( typename elements_type::const_iterator it = elements.begin() ; it != elements.end() ; ++it )
         {
+            m_stats.box();
+
             // if current node meets predicates
             // 0 - dummy value
             if ( index::detail::predicates_check
@@ -501,6 +718,7 @@ public:
 
                 // add current node's data into the list
                 internal_stack.back().branches.push_back( std::make_pair(node_distance, it->second) );
+                m_stats.heap_push();
             }
         }
 
@@ -516,6 +734,8 @@ public:
     // and aren't further than already found neighbours (if there is enough neighbours)
     inline void operator()(leaf const& n)
     {
+        m_stats.leaf();
+
         typedef typename rtree::elements_type<leaf>::type elements_type;
         elements_type const& elements = rtree::elements(n);
 
@@ -526,6 +746,8 @@ public:
         // search leaf for closest value meeting predicates
         for ( typename elements_type::const_iterator it = elements.begin() ; it != elements.end() ; ++it)
         {
+            m_stats.value();
+
             // if value meets predicates
             if ( index::detail::predicates_check
                     <
@@ -610,6 +832,7 @@ private:
     node_distance_type next_closest_node_distance;
 
     strategy_type m_strategy;
+    Statistics m_stats;
 };
 
 }}} // namespace detail::rtree::visitors
@@ -0,0 +1,425 @@
+// Boost.Geometry Index
+//
+// R-tree batched k nearest neighbors query visitor implementation
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_DISTANCE_QUERY_BATCH_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_DISTANCE_QUERY_BATCH_HPP
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/space_filling_curve.hpp>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace visitors {
+
+// k nearest neighbors query performed for many query geometries one after
+// another. In contrary to distance_query the containers of active branches
+// (one per level in depth-first traversal or one priority queue in best-first
+// traversal) and the heap of neighbors are kept between the queries so
+// the memory is allocated only for the first few queries.
+// The values found are referenced by pointers so the rtree can't be
+// modified before the results are retrieved with finish().
+template <typename MembersHolder, typename QueryGeometry, typename Traversal>
+class distance_query_batch
+    : public MembersHolder::visitor_const
+{
+public:
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef index::detail::predicates::nearest<QueryGeometry> nearest_predicate_type;
+    typedef typename indexable_type<translator_type>::type indexable_type;
+
+    typedef index::detail::calculate_distance<nearest_predicate_type, indexable_type, strategy_type, value_tag> calculate_value_distance;
+    typedef index::detail::calculate_distance<nearest_predicate_type, box_type, strategy_type, bounds_tag> calculate_node_distance;
+    typedef typename calculate_value_distance::result_type value_distance_type;
+    typedef typename calculate_node_distance::result_type node_distance_type;
+
+    typedef typename allocators_type::size_type size_type;
+    typedef typename allocators_type::node_pointer node_pointer;
+
+    typedef std::pair<node_distance_type, node_pointer> branch_data;
+    typedef std::pair<value_distance_type, value_type const*> neighbor_type;
+
+    typedef typename rtree::elements_type<internal_node>::type internal_elements;
+    typedef typename index::detail::rtree::container_from_elements_type<
+        internal_elements,
+        branch_data
+    >::type active_branch_list_type;
+
+    inline distance_query_batch(parameters_type const& parameters,
+                                translator_type const& translator,
+                                unsigned k, size_type leafs_level)
+        : m_translator(translator)
+        , m_pred(QueryGeometry(), k)
+        , m_strategy(index::detail::get_strategy(parameters))
+        , m_level(0)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(0 < k, "Number of neighbors should be greater than 0");
+
+        init(parameters, leafs_level, Traversal());
+        m_neighbors.reserve(k);
+    }
+
+    // Searches for the nearest neighbors of a geometry. Previous results are discarded.
+    inline void apply(node const& root, QueryGeometry const& geometry)
+    {
+        m_pred.point_or_relation = geometry;
+        m_neighbors.clear();
+
+        apply_dispatch(root, Traversal());
+    }
+
+    inline void operator()(internal_node const& n)
+    {
+        visit(n, Traversal());
+    }
+
+private:
+    inline void init(parameters_type const& parameters, size_type leafs_level, index::depth_first const&)
+    {
+        // one list per level of internal nodes
+        m_active_branch_lists.resize(leafs_level);
+        for ( size_type i = 0 ; i < leafs_level ; ++i )
+            m_active_branch_lists[i].reserve(parameters.get_max_elements());
+    }
+
+    inline void init(parameters_type const& , size_type , index::best_first const&)
+    {}
+
+    inline void apply_dispatch(node const& root, index::depth_first const&)
+    {
+        m_level = 0;
+
+        rtree::apply_visitor(*this, root);
+    }
+
+    inline void apply_dispatch(node const& root, index::best_first const&)
+    {
+        m_branches.clear();
+
+        rtree::apply_visitor(*this, root);
+
+        while ( !m_branches.empty() )
+        {
+            // the nearest branch is further than the furthest neighbor
+            if ( has_enough_neighbors() &&
+                 is_node_prunable(greatest_comparable_distance(), m_branches.front().first) )
+                break;
+
+            node_pointer ptr = m_branches.front().second;
+            std::pop_heap(m_branches.begin(), m_branches.end(), branch_greater());
+            m_branches.pop_back();
+
+            rtree::apply_visitor(*this, *ptr);
+        }
+    }
+
+    // gather branches, sort them and visit recursively
+    inline void visit(internal_node const& n, index::depth_first const&)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_level < m_active_branch_lists.size(), "unexpected level");
+
+        active_branch_list_type & active_branch_list = m_active_branch_lists[m_level];
+        active_branch_list.clear();
+
+        internal_elements const& elements = rtree::elements(n);
+
+        for ( typename internal_elements::const_iterator it = elements.begin();
+              it != elements.end(); ++it )
+        {
+            node_distance_type node_distance;
+            if ( !calculate_node_distance::apply(m_pred, it->first,
+                                                 m_strategy, node_distance) )
+            {
+                continue;
+            }
+
+            if ( has_enough_neighbors() &&
+                 is_node_prunable(greatest_comparable_distance(), node_distance) )
+            {
+                continue;
+            }
+
+            active_branch_list.push_back(std::make_pair(node_distance, it->second));
+        }
+
+        if ( active_branch_list.empty() )
+            return;
+
+        std::sort(active_branch_list.begin(), active_branch_list.end(), abl_less);
+
+        ++m_level;
+
+        for ( typename active_branch_list_type::const_iterator it = active_branch_list.begin();
+              it != active_branch_list.end() ; ++it )
+        {
+            // the rest of nodes is further than the furthest neighbor
+            if ( has_enough_neighbors() &&
+                 is_node_prunable(greatest_comparable_distance(), it->first) )
+                break;
+
+            rtree::apply_visitor(*this, *(it->second));
+        }
+
+        --m_level;
+    }
+
+    // push branches into the priority queue
+    inline void visit(internal_node const& n, index::best_first const&)
+    {
+        internal_elements const& elements = rtree::elements(n);
+
+        for ( typename internal_elements::const_iterator it = elements.begin();
+              it != elements.end(); ++it )
+        {
+            node_distance_type node_distance;
+            if ( !calculate_node_distance::apply(m_pred, it->first,
+                                                 m_strategy, node_distance) )
+            {
+                continue;
+            }
+
+            if ( has_enough_neighbors() &&
+                 is_node_prunable(greatest_comparable_distance(), node_distance) )
+            {
+                continue;
+            }
+
+            m_branches.push_back(std::make_pair(node_distance, it->second));
+            std::push_heap(m_branches.begin(), m_branches.end(), branch_greater());
+        }
+    }
+
+public:
+
+    inline void operator()(leaf const& n)
+    {
+        typedef typename rtree::elements_type<leaf>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        for ( typename elements_type::const_iterator it = elements.begin();
+              it != elements.end(); ++it )
+        {
+            value_distance_type value_distance;
+            if ( calculate_value_distance::apply(m_pred, m_translator(*it),
+                                                 m_strategy, value_distance) )
+            {
+                store(*it, value_distance);
+            }
+        }
+    }
+
+    // Sorts the neighbors by distance and writes them into the output.
+    template <typename OutIter>
+    inline size_type finish(OutIter & out_it)
+    {
+        std::sort(m_neighbors.begin(), m_neighbors.end(), neighbors_less);
+
+        typedef typename std::vector<neighbor_type>::const_iterator neighbors_iterator;
+        for ( neighbors_iterator it = m_neighbors.begin() ; it != m_neighbors.end() ; ++it, ++out_it )
+            *out_it = *(it->second);
+
+        return m_neighbors.size();
+    }
+
+    // Sorts the neighbors by distance and writes pointers to them into the output.
+    template <typename PtrOutIter>
+    inline size_type finish_pointers(PtrOutIter ptr_out_it)
+    {
+        std::sort(m_neighbors.begin(), m_neighbors.end(), neighbors_less);
+
+        typedef typename std::vector<neighbor_type>::const_iterator neighbors_iterator;
+        for ( neighbors_iterator it = m_neighbors.begin() ; it != m_neighbors.end() ; ++it, ++ptr_out_it )
+            *ptr_out_it = it->second;
+
+        return m_neighbors.size();
+    }
+
+private:
+    inline void store(value_type const& val, value_distance_type const& dist)
+    {
+        if ( m_neighbors.size() < m_pred.count )
+        {
+            m_neighbors.push_back(std::make_pair(dist, boost::addressof(val)));
+
+            if ( m_neighbors.size() == m_pred.count )
+                std::make_heap(m_neighbors.begin(), m_neighbors.end(), neighbors_less);
+        }
+        else if ( dist < m_neighbors.front().first )
+        {
+            std::pop_heap(m_neighbors.begin(), m_neighbors.end(), neighbors_less);
+            m_neighbors.back().first = dist;
+            m_neighbors.back().second = boost::addressof(val);
+            std::push_heap(m_neighbors.begin(), m_neighbors.end(), neighbors_less);
+        }
+    }
+
+    inline bool has_enough_neighbors() const
+    {
+        return m_pred.count <= m_neighbors.size();
+    }
+
+    // valid only if has_enough_neighbors()
+    inline value_distance_type const& greatest_comparable_distance() const
+    {
+        return m_neighbors.front().first;
+    }
+
+    static inline bool abl_less(branch_data const& p1, branch_data const& p2)
+    {
+        return p1.first < p2.first;
+    }
+
+    struct branch_greater
+    {
+        inline bool operator()(branch_data const& p1, branch_data const& p2) const
+        {
+            return p1.first > p2.first;
+        }
+    };
+
+    static inline bool neighbors_less(neighbor_type const& p1, neighbor_type const& p2)
+    {
+        return p1.first < p2.first;
+    }
+
+    template <typename Distance>
+    static inline bool is_node_prunable(Distance const& greatest_dist, node_distance_type const& d)
+    {
+        return greatest_dist <= d;
+    }
+
+    translator_type const& m_translator;
+
+    nearest_predicate_type m_pred;
+    strategy_type m_strategy;
+
+    std::vector<active_branch_list_type> m_active_branch_lists;
+    size_type m_level;
+    // min-heap of the branches to visit
+    std::vector<branch_data> m_branches;
+
+    std::vector<neighbor_type> m_neighbors;
+};
+
+// Performs the k nearest neighbors queries for all geometries in a range
+// and writes the results in the CSR format. For each query the offset of
+// the end of its results is written into offsets output.
+// If group_queries is true the queries are performed in the order of the
+// Z-order curve so the nodes visited by consecutive queries are likely
+// to be close in memory. The results are buffered and written in
+// the order of the queries.
+template <typename MembersHolder, typename QueryRange, typename OffsetIter, typename OutIter, typename Traversal>
+inline typename MembersHolder::size_type
+distance_query_batch_apply(typename MembersHolder::node const& root,
+                           typename MembersHolder::box_type const& root_box,
+                           typename MembersHolder::parameters_type const& parameters,
+                           typename MembersHolder::translator_type const& translator,
+                           typename MembersHolder::size_type leafs_level,
+                           QueryRange const& queries, unsigned k,
+                           OffsetIter offsets_it, OutIter out_it,
+                           bool group_queries, Traversal const& )
+{
+    typedef typename boost::range_value<QueryRange>::type query_type;
+    typedef typename boost::range_const_iterator<QueryRange>::type query_iterator;
+    typedef distance_query_batch<MembersHolder, query_type, Traversal> visitor_type;
+    typedef typename visitor_type::size_type size_type;
+    typedef typename visitor_type::value_type value_type;
+    typedef typename MembersHolder::box_type box_type;
+
+    visitor_type v(parameters, translator, k, leafs_level);
+
+    size_type result = 0;
+
+    if ( ! group_queries )
+    {
+        for ( query_iterator it = boost::const_begin(queries) ;
+              it != boost::const_end(queries) ; ++it, ++offsets_it )
+        {
+            v.apply(root, *it);
+            result += v.finish(out_it);
+            *offsets_it = result;
+        }
+
+        return result;
+    }
+
+    size_type const queries_count = boost::size(queries);
+
+    std::vector<query_iterator> query_its;
+    query_its.reserve(queries_count);
+    std::vector<std::pair<boost::uint64_t, size_type> > order;
+    order.reserve(queries_count);
+
+    typename index::detail::strategy_type<
+        typename MembersHolder::parameters_type
+    >::type const strategy = index::detail::get_strategy(parameters);
+
+    for ( query_iterator it = boost::const_begin(queries) ;
+          it != boost::const_end(queries) ; ++it )
+    {
+        box_type query_box;
+        index::detail::bounds(*it, query_box, strategy);
+        boost::uint64_t const code
+            = geometry::detail::space_filling_curve::morton_code(query_box, root_box);
+        order.push_back(std::make_pair(code, query_its.size()));
+        query_its.push_back(it);
+    }
+
+    std::sort(order.begin(), order.end());
+
+    // k pointers are reserved for each query
+    std::vector<value_type const*> neighbors(queries_count * k);
+    std::vector<size_type> counts(queries_count);
+
+    for ( size_type i = 0 ; i < queries_count ; ++i )
+    {
+        size_type const q = order[i].second;
+        v.apply(root, *query_its[q]);
+        counts[q] = v.finish_pointers(neighbors.begin() + q * k);
+    }
+
+    for ( size_type q = 0 ; q < queries_count ; ++q, ++offsets_it )
+    {
+        typename std::vector<value_type const*>::const_iterator
+            first = neighbors.begin() + q * k;
+        for ( size_type i = 0 ; i < counts[q] ; ++i, ++out_it )
+            *out_it = *first[i];
+
+        result += counts[q];
+        *offsets_it = result;
+    }
+
+    return result;
+}
+
+}}} // namespace detail::rtree::visitors
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_DISTANCE_QUERY_BATCH_HPP
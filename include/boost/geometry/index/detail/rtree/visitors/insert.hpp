@@ -382,6 +382,9 @@ protected:
         // calculate new traverse inputs
         m_traverse_data.move_to_next_level(&n, choosen_node_index);
 
+        // the child node may be shared with other versions of the tree
+        rtree::make_writable<MembersHolder>(rtree::elements(n)[choosen_node_index].second, m_allocators);      // MAY THROW, STRONG (V, E: alloc, copy, N:alloc)
+
         // next traversing step
         rtree::apply_visitor(visitor, *rtree::elements(n)[choosen_node_index].second);                          // MAY THROW (V, E: alloc, copy, N:alloc)
 
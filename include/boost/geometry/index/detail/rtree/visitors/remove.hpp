@@ -206,6 +206,9 @@ private:
         m_current_child_index = choosen_node_index;
         ++m_current_level;
 
+        // the child node may be shared with other versions of the tree
+        rtree::make_writable<MembersHolder>(rtree::elements(n)[choosen_node_index].second, m_allocators); // MAY THROW, STRONG (V, E: alloc, copy, N: alloc)
+
         // next traversing step
         rtree::apply_visitor(*this, *rtree::elements(n)[choosen_node_index].second);                    // MAY THROW (V, E: alloc, copy, N: alloc)
 
@@ -0,0 +1,427 @@
+// Boost.Geometry Index
+//
+// R-tree removing by predicates visitor implementation
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_REMOVE_IF_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_REMOVE_IF_HPP
+
+#include <vector>
+
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/insert.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace visitors {
+
+// Removes all values meeting predicates in one traversal. Only the nodes meeting
+// the predicates are traversed. The nodes which underflowed are removed from their
+// parents and stored. Their elements are reinserted after the traversal, when
+// the tree is already shortened, the same way as in the default remove algorithm.
+// If the elements of a node can't be reinserted because the tree is too short
+// the node is split into its children, which are reinserted at the lower level.
+template <typename MembersHolder, typename Predicates>
+class remove_if
+    : public MembersHolder::visitor
+{
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename allocators_type::node_pointer node_pointer;
+    typedef typename allocators_type::size_type size_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    typedef typename rtree::elements_type<internal_node>::type internal_elements;
+    typedef typename rtree::elements_type<leaf>::type leaf_elements;
+    typedef typename internal_elements::size_type internal_size_type;
+
+    //typedef typename Allocators::internal_node_pointer internal_node_pointer;
+    typedef internal_node * internal_node_pointer;
+
+    static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
+
+public:
+    inline remove_if(node_pointer & root,
+                     size_type & leafs_level,
+                     Predicates const& predicates,
+                     parameters_type const& parameters,
+                     translator_type const& translator,
+                     allocators_type & allocators)
+        : m_pred(predicates)
+        , m_parameters(parameters)
+        , m_translator(translator)
+        , m_allocators(allocators)
+        , m_strategy(index::detail::get_strategy(parameters))
+        , m_root_node(root)
+        , m_leafs_level(leafs_level)
+        , m_removed_count(0)
+        , m_parent(0)
+        , m_current_child_index(0)
+        , m_current_level(0)
+        , m_is_modified(false)
+        , m_is_underflow(false)
+    {}
+
+    ~remove_if()
+    {
+        // the nodes are stored here only if an exception was thrown
+        destroy_underflowed_nodes();
+    }
+
+    inline void operator()(internal_node & n)
+    {
+        internal_elements & elements = rtree::elements(n);
+
+        bool is_modified = false;
+
+        // traverse children which boxes meet predicates
+        for ( internal_size_type i = 0 ; i < elements.size() ; )
+        {
+            // 0 - dummy value
+            if ( ! index::detail::predicates_check
+                    <
+                        index::detail::bounds_tag, 0, predicates_len
+                    >(m_pred, 0, elements[i].first, m_strategy) )
+            {
+                ++i;
+                continue;
+            }
+
+            m_is_modified = false;
+            m_is_underflow = false;
+
+            // next traversing step
+            traverse_apply_visitor(n, i);                                                               // MAY THROW (E: alloc, copy)
+
+            if ( m_is_modified )
+            {
+                is_modified = true;
+
+                // the child is removed and replaced by the last one which is checked next
+                if ( m_is_underflow )
+                {
+                    size_type relative_level = m_leafs_level - m_current_level;
+                    store_underflowed_node(elements, elements.begin() + i, relative_level);             // MAY THROW (E: alloc, copy)
+                    continue;
+                }
+            }
+
+            ++i;
+        }
+
+        m_is_modified = is_modified;
+
+        if ( ! is_modified )
+            return;
+
+        // n is not root - adjust aabb
+        if ( 0 != m_parent )
+        {
+            m_is_underflow = elements.size() < m_parameters.get_min_elements();
+
+            if ( ! m_is_underflow )
+            {
+                rtree::elements(*m_parent)[m_current_child_index].first
+                    = rtree::elements_box<box_type>(elements.begin(), elements.end(), m_translator, m_strategy);
+            }
+        }
+        // n is root node
+        else
+        {
+            BOOST_GEOMETRY_INDEX_ASSERT(&n == &rtree::get<internal_node>(*m_root_node), "node must be the root");
+
+            // shorten the tree and reinsert elements from removed nodes (underflows)
+            shorten_tree();
+            reinsert_removed_nodes_elements();                                                          // MAY THROW (V, E: alloc, copy, N: alloc)
+        }
+    }
+
+    inline void operator()(leaf & n)
+    {
+        leaf_elements & elements = rtree::elements(n);
+
+        size_type removed_count = 0;
+
+        // find values and remove them
+        for ( typename leaf_elements::iterator it = elements.begin() ; it != elements.end() ; )
+        {
+            if ( index::detail::predicates_check
+                    <
+                        index::detail::value_tag, 0, predicates_len
+                    >(m_pred, *it, m_translator(*it), m_strategy) )
+            {
+                rtree::move_from_back(elements, it);                                                    // MAY THROW (V: copy)
+                elements.pop_back();
+                ++removed_count;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        m_is_modified = 0 < removed_count;
+        m_removed_count += removed_count;
+
+        // n is not root - adjust aabb
+        if ( m_is_modified && 0 != m_parent )
+        {
+            BOOST_GEOMETRY_INDEX_ASSERT(0 < m_parameters.get_min_elements(), "min number of elements is too small");
+
+            m_is_underflow = elements.size() < m_parameters.get_min_elements();
+
+            if ( ! m_is_underflow )
+            {
+                rtree::elements(*m_parent)[m_current_child_index].first
+                    = rtree::values_box<box_type>(elements.begin(), elements.end(), m_translator, m_strategy);
+            }
+        }
+    }
+
+    size_type removed_count() const
+    {
+        return m_removed_count;
+    }
+
+private:
+
+    // the nodes stored at the index of their relative level
+    typedef std::vector< std::vector<node_pointer> > underflow_nodes;
+
+    void traverse_apply_visitor(internal_node &n, internal_size_type choosen_node_index)
+    {
+        // save previous traverse inputs and set new ones
+        internal_node_pointer parent_bckup = m_parent;
+        internal_size_type current_child_index_bckup = m_current_child_index;
+        size_type current_level_bckup = m_current_level;
+
+        m_parent = &n;
+        m_current_child_index = choosen_node_index;
+        ++m_current_level;
+
+        // the child node may be shared with other versions of the tree
+        rtree::make_writable<MembersHolder>(rtree::elements(n)[choosen_node_index].second, m_allocators); // MAY THROW, STRONG (V, E: alloc, copy, N: alloc)
+
+        // next traversing step
+        rtree::apply_visitor(*this, *rtree::elements(n)[choosen_node_index].second);                    // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        // restore previous traverse inputs
+        m_parent = parent_bckup;
+        m_current_child_index = current_child_index_bckup;
+        m_current_level = current_level_bckup;
+    }
+
+    void store_underflowed_node(internal_elements & elements,
+                                typename internal_elements::iterator underfl_el_it,
+                                size_type relative_level)
+    {
+        // move node to the container - store node's relative level as well
+        if ( m_underflowed_nodes.size() <= relative_level )
+            m_underflowed_nodes.resize(relative_level + 1);                                             // MAY THROW (E: alloc)
+        m_underflowed_nodes[relative_level].push_back(underfl_el_it->second);                           // MAY THROW (E: alloc, copy)
+
+        BOOST_TRY
+        {
+            rtree::move_from_back(elements, underfl_el_it);                                             // MAY THROW (E: copy)
+            elements.pop_back();
+        }
+        BOOST_CATCH(...)
+        {
+            m_underflowed_nodes[relative_level].pop_back();
+            BOOST_RETHROW                                                                               // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+    // Removes the roots having less than 2 children. If the root has no children
+    // the highest non-empty underflowed node becomes the root.
+    void shorten_tree()
+    {
+        while ( 0 < m_leafs_level )
+        {
+            internal_elements & elements = rtree::elements(rtree::get<internal_node>(*m_root_node));
+            if ( 1 < elements.size() )
+                break;
+
+            node_pointer root_to_destroy = m_root_node;
+            if ( elements.size() == 1 )
+            {
+                m_root_node = elements[0].second;
+                --m_leafs_level;
+            }
+            else
+            {
+                m_root_node = 0;
+                m_leafs_level = 0;
+                pop_highest_underflowed_node(m_root_node, m_leafs_level);
+            }
+
+            rtree::destroy_node<allocators_type, internal_node>::apply(m_allocators, root_to_destroy);
+
+            if ( 0 == m_root_node )
+                break;
+        }
+    }
+
+    void pop_highest_underflowed_node(node_pointer & root, size_type & leafs_level)
+    {
+        for ( size_type relative_level = m_underflowed_nodes.size() ; relative_level-- > 1 ; )
+        {
+            std::vector<node_pointer> & nodes = m_underflowed_nodes[relative_level];
+            while ( ! nodes.empty() )
+            {
+                node_pointer n = nodes.back();
+                nodes.pop_back();
+
+                if ( is_empty(n, relative_level) )
+                {
+                    visitors::destroy<MembersHolder>::apply(n, m_allocators);
+                }
+                else
+                {
+                    root = n;
+                    leafs_level = relative_level - 1;
+                    return;
+                }
+            }
+        }
+    }
+
+    void reinsert_removed_nodes_elements()
+    {
+        // begin with levels closer to the root
+        for ( size_type relative_level = m_underflowed_nodes.size() ; relative_level-- > 1 ; )
+        {
+            std::vector<node_pointer> & nodes = m_underflowed_nodes[relative_level];
+            while ( ! nodes.empty() )
+            {
+                // relative_level is an index of a level of a node, not children
+                // counted from the leafs level
+                if ( relative_level == 1 )
+                {
+                    reinsert_node_elements(rtree::get<leaf>(*nodes.back()), relative_level);            // MAY THROW (V, E: alloc, copy, N: alloc)
+                    rtree::destroy_node<allocators_type, leaf>::apply(m_allocators, nodes.back());
+                }
+                else
+                {
+                    internal_node & n = rtree::get<internal_node>(*nodes.back());
+                    // the elements can't be inserted at the level higher than the level of the root
+                    if ( relative_level - 1 <= m_leafs_level )
+                    {
+                        reinsert_node_elements(n, relative_level);                                      // MAY THROW (V, E: alloc, copy, N: alloc)
+                    }
+                    else
+                    {
+                        move_children(rtree::elements(n), m_underflowed_nodes[relative_level - 1]);     // MAY THROW (E: alloc)
+                    }
+                    rtree::destroy_node<allocators_type, internal_node>::apply(m_allocators, nodes.back());
+                }
+                nodes.pop_back();
+            }
+        }
+
+        m_underflowed_nodes.clear();
+    }
+
+    template <typename Node>
+    void reinsert_node_elements(Node &n, size_type node_relative_level)
+    {
+        typedef typename rtree::elements_type<Node>::type elements_type;
+        elements_type & elements = rtree::elements(n);
+
+        BOOST_GEOMETRY_INDEX_ASSERT(elements.empty() || 0 != m_root_node, "there is no root node");
+
+        typename elements_type::iterator it = elements.begin();
+        BOOST_TRY
+        {
+            for ( ; it != elements.end() ; ++it )
+            {
+                visitors::insert<typename elements_type::value_type, MembersHolder>
+                    insert_v(m_root_node, m_leafs_level, *it,
+                             m_parameters, m_translator, m_allocators,
+                             node_relative_level - 1);
+
+                rtree::apply_visitor(insert_v, *m_root_node);                                           // MAY THROW (V, E: alloc, copy, N: alloc)
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            ++it;
+            rtree::destroy_elements<MembersHolder>::apply(it, elements.end(), m_allocators);
+            elements.clear();
+            BOOST_RETHROW                                                                               // RETHROW
+        }
+        BOOST_CATCH_END
+
+        // the elements are owned by the tree now
+        elements.clear();
+    }
+
+    static void move_children(internal_elements & elements, std::vector<node_pointer> & nodes)
+    {
+        nodes.reserve(nodes.size() + elements.size());                                                  // MAY THROW (E: alloc)
+        for ( typename internal_elements::iterator it = elements.begin() ; it != elements.end() ; ++it )
+            nodes.push_back(it->second);
+        elements.clear();
+    }
+
+    static bool is_empty(node_pointer n, size_type relative_level)
+    {
+        return relative_level == 1
+             ? rtree::elements(rtree::get<leaf>(*n)).empty()
+             : rtree::elements(rtree::get<internal_node>(*n)).empty();
+    }
+
+    void destroy_underflowed_nodes()
+    {
+        for ( typename underflow_nodes::iterator it = m_underflowed_nodes.begin() ;
+              it != m_underflowed_nodes.end() ; ++it )
+        {
+            for ( typename std::vector<node_pointer>::iterator nit = it->begin() ; nit != it->end() ; ++nit )
+                visitors::destroy<MembersHolder>::apply(*nit, m_allocators);
+        }
+        m_underflowed_nodes.clear();
+    }
+
+    Predicates m_pred;
+    parameters_type const& m_parameters;
+    translator_type const& m_translator;
+    allocators_type & m_allocators;
+    strategy_type m_strategy;
+
+    node_pointer & m_root_node;
+    size_type & m_leafs_level;
+
+    size_type m_removed_count;
+    underflow_nodes m_underflowed_nodes;
+
+    // traversing input parameters
+    internal_node_pointer m_parent;
+    internal_size_type m_current_child_index;
+    size_type m_current_level;
+
+    // traversing output parameters
+    bool m_is_modified;
+    bool m_is_underflow;
+};
+
+}}} // namespace detail::rtree::visitors
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_REMOVE_IF_HPP
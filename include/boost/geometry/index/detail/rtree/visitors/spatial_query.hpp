@@ -15,19 +15,34 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_SPATIAL_QUERY_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_SPATIAL_QUERY_HPP
 
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/bool.hpp>
+
+#include <boost/geometry/index/detail/algorithms/intersects_simd.hpp>
+#include <boost/geometry/index/detail/query_output.hpp>
+#include <boost/geometry/index/detail/query_statistics.hpp>
+
 namespace boost { namespace geometry { namespace index {
 
 namespace detail { namespace rtree { namespace visitors {
 
-template <typename MembersHolder, typename Predicates, typename OutIter>
+template
+<
+    typename MembersHolder,
+    typename Predicates,
+    typename OutIter,
+    typename Statistics = index::detail::no_query_statistics
+>
 struct spatial_query
     : public MembersHolder::visitor_const
 {
     typedef typename MembersHolder::parameters_type parameters_type;
     typedef typename MembersHolder::translator_type translator_type;
     typedef typename MembersHolder::allocators_type allocators_type;
+    typedef typename MembersHolder::box_type box_type;
 
     typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+    typedef typename index::detail::indexable_type<translator_type>::type indexable_type;
 
     typedef typename MembersHolder::node node;
     typedef typename MembersHolder::internal_node internal_node;
@@ -37,11 +52,86 @@ struct spatial_query
 
     static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
 
-    inline spatial_query(parameters_type const& par, translator_type const& t, Predicates const& p, OutIter out_it)
+    typedef index::detail::query_output<OutIter> output_type;
+    typedef typename output_type::is_stoppable is_stoppable;
+
+    // The boxes of nodes and the indexables of values are tested directly
+    // with vectorized comparisons of coordinates if possible.
+    typedef boost::mpl::and_
+        <
+            index::detail::box_intersects_predicate<Predicates, box_type>,
+            index::detail::simd::contiguous_coordinates<box_type>
+        > simd_bounds_check;
+    typedef boost::mpl::and_
+        <
+            index::detail::value_intersects_predicate<Predicates, indexable_type>,
+            index::detail::simd::contiguous_coordinates<indexable_type>
+        > simd_values_check;
+
+    inline spatial_query(parameters_type const& par, translator_type const& t, Predicates const& p, OutIter out_it,
+                         Statistics const& stats = Statistics())
         : tr(t), pred(p), out_iter(out_it), found_count(0), strategy(index::detail::get_strategy(par))
-    {}
+        , stopped(false), m_stats(stats)
+    {
+        init_bounds_filter(boost::mpl::bool_<simd_bounds_check::value>());
+        init_values_filter(boost::mpl::bool_<simd_values_check::value>());
+    }
 
     inline void operator()(internal_node const& n)
+    {
+        m_stats.internal_node();
+        traverse(n, boost::mpl::bool_<simd_bounds_check::value>());
+    }
+
+    inline void operator()(leaf const& n)
+    {
+        m_stats.leaf();
+        traverse(n, boost::mpl::bool_<simd_values_check::value>());
+    }
+
+private:
+    // Always false for output iterators so the checks are optimized out.
+    inline bool is_stopped() const
+    {
+        return is_stoppable::value && stopped;
+    }
+
+    inline void init_bounds_filter(boost::mpl::true_ const& /*simd_bounds_check*/)
+    {
+        bounds_filter.init(pred);
+    }
+
+    inline void init_bounds_filter(boost::mpl::false_ const& /*simd_bounds_check*/)
+    {}
+
+    inline void init_values_filter(boost::mpl::true_ const& /*simd_values_check*/)
+    {
+        values_filter.init(pred);
+    }
+
+    inline void init_values_filter(boost::mpl::false_ const& /*simd_values_check*/)
+    {}
+
+    inline void traverse(internal_node const& n, boost::mpl::true_ const& /*simd_bounds_check*/)
+    {
+        typedef typename rtree::elements_type<internal_node>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        for (typename elements_type::const_iterator it = elements.begin();
+            it != elements.end(); ++it)
+        {
+            m_stats.box();
+            if ( bounds_filter(it->first) )
+            {
+                rtree::apply_visitor(*this, *it->second);
+
+                if ( is_stopped() )
+                    return;
+            }
+        }
+    }
+
+    inline void traverse(internal_node const& n, boost::mpl::false_ const& /*simd_bounds_check*/)
     {
         typedef typename rtree::elements_type<internal_node>::type elements_type;
         elements_type const& elements = rtree::elements(n);
@@ -50,6 +140,8 @@ struct spatial_query
         for (typename elements_type::const_iterator it = elements.begin();
             it != elements.end(); ++it)
         {
+            m_stats.box();
+
             // if node meets predicates
             // 0 - dummy value
             if ( index::detail::predicates_check
@@ -58,11 +150,37 @@ struct spatial_query
                     >(pred, 0, it->first, strategy) )
             {
                 rtree::apply_visitor(*this, *it->second);
+
+                if ( is_stopped() )
+                    return;
             }
         }
     }
 
-    inline void operator()(leaf const& n)
+    inline void traverse(leaf const& n, boost::mpl::true_ const& /*simd_values_check*/)
+    {
+        typedef typename rtree::elements_type<leaf>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        for (typename elements_type::const_iterator it = elements.begin();
+            it != elements.end(); ++it)
+        {
+            m_stats.value();
+            if ( values_filter(tr(*it)) )
+            {
+                ++found_count;
+                m_stats.found();
+
+                if ( ! output_type::apply(out_iter, *it) )
+                {
+                    stopped = true;
+                    return;
+                }
+            }
+        }
+    }
+
+    inline void traverse(leaf const& n, boost::mpl::false_ const& /*simd_values_check*/)
     {
         typedef typename rtree::elements_type<leaf>::type elements_type;
         elements_type const& elements = rtree::elements(n);
@@ -71,20 +189,27 @@ struct spatial_query
         for (typename elements_type::const_iterator it = elements.begin();
             it != elements.end(); ++it)
         {
+            m_stats.value();
+
             // if value meets predicates
             if ( index::detail::predicates_check
                     <
                         index::detail::value_tag, 0, predicates_len
                     >(pred, *it, tr(*it), strategy) )
             {
-                *out_iter = *it;
-                ++out_iter;
-
                 ++found_count;
+                m_stats.found();
+
+                if ( ! output_type::apply(out_iter, *it) )
+                {
+                    stopped = true;
+                    return;
+                }
             }
         }
     }
 
+public:
     translator_type const& tr;
 
     Predicates pred;
@@ -93,9 +218,21 @@ struct spatial_query
     size_type found_count;
 
     strategy_type strategy;
+
+private:
+    bool stopped;
+    Statistics m_stats;
+
+    index::detail::simd::intersects_filter<box_type> bounds_filter;
+    index::detail::simd::intersects_filter<indexable_type> values_filter;
 };
 
-template <typename MembersHolder, typename Predicates>
+template
+<
+    typename MembersHolder,
+    typename Predicates,
+    typename Statistics = index::detail::no_query_statistics
+>
 class spatial_query_incremental
     : public MembersHolder::visitor_const
 {
@@ -129,16 +266,20 @@ public:
 //        , m_strategy()
     {}
 
-    inline spatial_query_incremental(parameters_type const& params, translator_type const& t, Predicates const& p)
+    inline spatial_query_incremental(parameters_type const& params, translator_type const& t, Predicates const& p,
+                                     Statistics const& stats = Statistics())
         : m_translator(::boost::addressof(t))
         , m_pred(p)
         , m_values(NULL)
         , m_current()
         , m_strategy(index::detail::get_strategy(params))
+        , m_stats(stats)
     {}
 
     inline void operator()(internal_node const& n)
     {
+        m_stats.internal_node();
+
         typedef typename rtree::elements_type<internal_node>::type elements_type;
         elements_type const& elements = rtree::elements(n);
 
@@ -147,6 +288,8 @@ public:
 
     inline void operator()(leaf const& n)
     {
+        m_stats.leaf();
+
         m_values = ::boost::addressof(rtree::elements(n));
         m_current = rtree::elements(n).begin();
     }
@@ -180,11 +323,13 @@ public:
                 {
                     // return if next value is found
                     value_type const& v = *m_current;
+                    m_stats.value();
                     if (index::detail::predicates_check
                             <
                                index::detail::value_tag, 0, predicates_len
                             >(m_pred, v, (*m_translator)(v), m_strategy))
                     {
+                        m_stats.found();
                         return;
                     }
 
@@ -214,6 +359,7 @@ public:
                 ++m_internal_stack.back().first;
 
                 // next node is found, push it to the stack
+                m_stats.box();
                 if (index::detail::predicates_check
                         <
                             index::detail::bounds_tag, 0, predicates_len
@@ -246,6 +392,7 @@ private:
     leaf_iterator m_current;
 
     strategy_type m_strategy;
+    Statistics m_stats;
 };
 
 }}} // namespace detail::rtree::visitors
@@ -199,6 +199,32 @@ points are further than some distance and closer than some other distance.
 //    return detail::bounded<PointRelation, MinRelation, MaxRelation>(pr, minr, maxr);
 //}
 
+// nearest neighbors traversals
+
+/*!
+\brief The depth-first traversal of the rtree in knn query.
+
+The children of each internal node are sorted by the distance and visited recursively,
+nearest first. The branches further than the k-th neighbor found so far are skipped.
+This is the default traversal.
+
+\ingroup distance_predicates
+*/
+struct depth_first {};
+
+/*!
+\brief The best-first traversal of the rtree in knn query.
+
+The nodes are visited in the order of increasing distance, regardless of their level,
+using one priority queue for the whole tree. The traversal stops when the nearest node in
+the queue is further than the k-th neighbor found so far. This way only the nodes closer than
+the k-th nearest neighbor are visited but the priority queue has to be maintained. Whether it's
+faster than \c depth_first depends on the data, the parameters of the rtree and k.
+
+\ingroup distance_predicates
+*/
+struct best_first {};
+
 }}} // namespace boost::geometry::index
 
 #endif // BOOST_GEOMETRY_INDEX_DISTANCE_PREDICATES_HPP
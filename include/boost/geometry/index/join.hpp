@@ -0,0 +1,182 @@
+// Boost.Geometry Index
+//
+// Spatial join of two R-trees
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_JOIN_HPP
+#define BOOST_GEOMETRY_INDEX_JOIN_HPP
+
+#include <cstddef>
+
+#include <boost/core/ignore_unused.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/cs.hpp>
+
+#include <boost/geometry/index/parallel.hpp>
+#include <boost/geometry/index/predicates.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/index/detail/rtree/join.hpp>
+#include <boost/geometry/index/detail/rtree/members_access.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace join {
+
+template <typename RtreeA, typename RtreeB>
+struct check_rtrees
+{
+    typedef typename RtreeA::bounds_type box_type_a;
+    typedef typename RtreeB::bounds_type box_type_b;
+
+    BOOST_MPL_ASSERT_MSG((boost::is_same
+                            <
+                                typename geometry::cs_tag<box_type_a>::type,
+                                typename geometry::cs_tag<box_type_b>::type
+                            >::value),
+                         COORDINATE_SYSTEMS_OF_RTREES_MUST_BE_THE_SAME,
+                         (box_type_a, box_type_b));
+
+    BOOST_MPL_ASSERT_MSG((geometry::dimension<box_type_a>::value
+                       == geometry::dimension<box_type_b>::value),
+                         DIMENSIONS_OF_RTREES_MUST_BE_THE_SAME,
+                         (box_type_a, box_type_b));
+};
+
+}}} // namespace detail::rtree::join
+
+/*!
+\brief Finds the pairs of values stored in two rtrees meeting the passed predicate.
+
+This function performs the spatial join of two rtrees. Both trees are traversed
+at the same time and only the pairs of nodes which bounds intersect are visited.
+So the second rtree isn't traversed from the root for each value stored in the first
+one. The gain depends on the data. If the rtrees are small enough to stay in cache
+the queries of the second rtree are cheap and the join is only slightly faster.
+The pairs of values are written to the output iterator as
+<tt>std::pair<Value1, Value2></tt>, the value of the first rtree first.
+The order of the pairs is not specified.
+
+The predicate may be generated by one of the functions listed below:
+\li \c boost::geometry::index::contains(),
+\li \c boost::geometry::index::covered_by(),
+\li \c boost::geometry::index::covers(),
+\li \c boost::geometry::index::intersects(),
+\li \c boost::geometry::index::overlaps(),
+\li \c boost::geometry::index::within().
+
+The predicate is tested for the Indexables of the values. The coordinate
+systems and dimensions of the Indexables must be the same. The strategy
+of the first rtree is used.
+
+\par Example
+\verbatim
+std::vector< std::pair<parcel_t, zone_t> > result;
+bgi::join(parcels, flood_zones, bgi::intersects(), std::back_inserter(result));
+\endverbatim
+
+\par Throws
+If Value copy constructor or copy assignment throws.
+If OutIter dereference or increment throws.
+If memory allocation throws.
+
+\param rtree1       The first rtree.
+\param rtree2       The second rtree.
+\param predicate    The spatial predicate.
+\param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+\return             The number of pairs of values found.
+*/
+template <typename Value1, typename Parameters1, typename IndexableGetter1, typename EqualTo1, typename Allocator1,
+          typename Value2, typename Parameters2, typename IndexableGetter2, typename EqualTo2, typename Allocator2,
+          typename Tag, typename OutIter>
+inline std::size_t join(rtree<Value1, Parameters1, IndexableGetter1, EqualTo1, Allocator1> const& rtree1,
+                        rtree<Value2, Parameters2, IndexableGetter2, EqualTo2, Allocator2> const& rtree2,
+                        detail::predicates::join_predicate<Tag> const& predicate,
+                        OutIter out_it)
+{
+    typedef rtree<Value1, Parameters1, IndexableGetter1, EqualTo1, Allocator1> rtree1_type;
+    typedef rtree<Value2, Parameters2, IndexableGetter2, EqualTo2, Allocator2> rtree2_type;
+
+    boost::ignore_unused(predicate, detail::rtree::join::check_rtrees<rtree1_type, rtree2_type>());
+
+    if ( rtree1.empty() || rtree2.empty() )
+        return 0;
+
+    return detail::rtree::join::apply<Tag>(
+                detail::rtree::members_access<rtree1_type>::get(rtree1), rtree1.bounds(),
+                detail::rtree::members_access<rtree2_type>::get(rtree2), rtree2.bounds(),
+                out_it);
+}
+
+/*!
+\brief Finds the pairs of values stored in two rtrees meeting the passed predicate using several threads.
+
+This function works like the sequential \c join() but the top levels of the rtrees are
+traversed first in order to find the pairs of nodes which bounds intersect. Then the
+pairs of nodes are divided between the threads and joined concurrently. The pairs of
+values found by each thread are stored in a buffer and written to the output iterator
+by the calling thread after all of the threads are finished. So only the traversal is
+parallel, writing the pairs isn't, and the buffers need memory for all of the pairs.
+If the join finds many pairs compared to the number of visited nodes, writing them
+limits the speedup.
+
+The rtrees mustn't be modified during the join.
+
+\par Example
+\verbatim
+bgi::join(parcels, flood_zones, bgi::intersects(), std::back_inserter(result), bgi::parallel(4));
+\endverbatim
+
+\par Throws
+If Value copy constructor or copy assignment throws.
+If OutIter dereference or increment throws.
+If memory allocation throws.
+
+\param rtree1       The first rtree.
+\param rtree2       The second rtree.
+\param predicate    The spatial predicate.
+\param out_it       The output iterator, e.g. generated by std::back_inserter().
+\param policy       The parallel execution policy.
+
+\return             The number of pairs of values found.
+*/
+template <typename Value1, typename Parameters1, typename IndexableGetter1, typename EqualTo1, typename Allocator1,
+          typename Value2, typename Parameters2, typename IndexableGetter2, typename EqualTo2, typename Allocator2,
+          typename Tag, typename OutIter>
+inline std::size_t join(rtree<Value1, Parameters1, IndexableGetter1, EqualTo1, Allocator1> const& rtree1,
+                        rtree<Value2, Parameters2, IndexableGetter2, EqualTo2, Allocator2> const& rtree2,
+                        detail::predicates::join_predicate<Tag> const& predicate,
+                        OutIter out_it,
+                        index::parallel const& policy)
+{
+    typedef rtree<Value1, Parameters1, IndexableGetter1, EqualTo1, Allocator1> rtree1_type;
+    typedef rtree<Value2, Parameters2, IndexableGetter2, EqualTo2, Allocator2> rtree2_type;
+    typedef typename detail::rtree::members_access<rtree1_type>::members_holder members_holder1;
+    typedef typename detail::rtree::members_access<rtree2_type>::members_holder members_holder2;
+
+    if ( policy.threads() <= 1 )
+        return index::join(rtree1, rtree2, predicate, out_it);
+
+    boost::ignore_unused(detail::rtree::join::check_rtrees<rtree1_type, rtree2_type>());
+
+    if ( rtree1.empty() || rtree2.empty() )
+        return 0;
+
+    return detail::rtree::join::parallel_join<members_holder1, members_holder2, Tag>::apply(
+                detail::rtree::members_access<rtree1_type>::get(rtree1), rtree1.bounds(),
+                detail::rtree::members_access<rtree2_type>::get(rtree2), rtree2.bounds(),
+                out_it, policy.threads());
+}
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_JOIN_HPP
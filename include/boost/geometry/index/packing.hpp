@@ -0,0 +1,210 @@
+// Boost.Geometry Index
+//
+// Packing algorithms policies
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_PACKING_HPP
+#define BOOST_GEOMETRY_INDEX_PACKING_HPP
+
+#include <cstddef>
+#include <string>
+
+#include <boost/geometry/index/parallel.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The Hilbert curve used by the sort-based packing algorithm.
+*/
+struct hilbert_curve {};
+
+/*!
+\brief The Z-order curve (Morton order) used by the sort-based packing algorithm.
+*/
+struct morton_curve {};
+
+/*!
+\brief The sort-based packing algorithm policy.
+
+An object of this type may be passed into the packing constructor of the rtree
+instead of the default top-down partitioning algorithm. The values are sorted
+by the positions of the centers of their bounding boxes on a space-filling curve.
+Then the leafs are filled sequentially with the maximum number of elements
+and the levels of the tree are created bottom-up the same way.
+
+The sorting is faster than the partitioning and all nodes except the last ones
+on each level are full. The nodes created this way may overlap more than
+the nodes created by the default algorithm, especially for the Z-order curve,
+so the queries may be slower.
+
+\par Example
+\verbatim
+bgi::rtree< value_t, bgi::rstar<16> > rt(values, bgi::hilbert_packing());
+// sort the values and create the leafs using 4 threads
+bgi::rtree< value_t, bgi::rstar<16> > rt2(values, bgi::hilbert_packing(bgi::parallel(4)));
+\endverbatim
+
+\tparam Curve   The space-filling curve, \c hilbert_curve or \c morton_curve.
+*/
+template <typename Curve>
+class sort_packing
+{
+public:
+    /*!
+    \brief The constructor.
+
+    \param policy   The parallel execution policy. Default: one thread.
+    */
+    explicit sort_packing(index::parallel const& policy = index::parallel(1))
+        : m_threads(policy.threads())
+    {}
+
+    /*!
+    \brief Returns the maximum number of threads used.
+    */
+    std::size_t threads() const { return m_threads; }
+
+private:
+    std::size_t m_threads;
+};
+
+/*!
+\brief The packing algorithm sorting the values along the Hilbert curve.
+*/
+typedef sort_packing<hilbert_curve> hilbert_packing;
+
+/*!
+\brief The packing algorithm sorting the values along the Z-order curve.
+*/
+typedef sort_packing<morton_curve> morton_packing;
+
+/*!
+\brief The external memory sort-based packing algorithm policy.
+
+An object of this type may be passed into the packing constructor of the rtree
+or into <tt>boost::geometry::index::write_flat()</tt> in order to create the tree
+from the values which don't fit in the memory. The values are read from the input
+range only once so the range may be defined by input iterators, e.g. reading
+the values from a stream.
+
+The values are sorted along the space-filling curve the same way as with
+\c sort_packing but with the external merge sort. The parts of the input containing
+at most max_values values are sorted in memory and stored in temporary files.
+Then the sorted parts are merged and the tree is created bottom-up from the values
+in the order of leafs. If the input range is defined by input iterators all of the
+values are additionally stored in a temporary file in order to calculate their
+bounds before sorting. The rtree created this way has the same structure as
+the one created with \c sort_packing using the same curve.
+
+The Values are stored in temporary files byte by byte. Therefore they must be
+trivially copyable types, e.g. Points, Boxes and pairs of Boxes and integral ids.
+
+\par Example
+\verbatim
+std::ifstream ifs("values.bin", std::ios::binary);
+value_reader first(ifs), last;
+// at most 16M values in memory, temporary files in /data/tmp
+bgi::external_hilbert_packing policy(16 * 1024 * 1024, "/data/tmp");
+std::ofstream ofs("tree.bin", std::ios::binary);
+bgi::write_flat(first, last, ofs, policy, bgi::rstar<16>());
+\endverbatim
+
+\tparam Curve   The space-filling curve, \c hilbert_curve or \c morton_curve.
+*/
+template <typename Curve>
+class external_sort_packing
+{
+public:
+    /*!
+    \brief The constructor.
+
+    \param max_values           The maximum number of values sorted or buffered in memory at once.
+    \param temporary_directory  The directory where temporary files are created. If empty
+                                the files are created with <tt>std::tmpfile()</tt>.
+    */
+    explicit external_sort_packing(std::size_t max_values,
+                                   std::string const& temporary_directory = std::string())
+        : m_max_values(max_values < 2 ? 2 : max_values)
+        , m_temporary_directory(temporary_directory)
+    {}
+
+    /*!
+    \brief Returns the maximum number of values stored in memory at once.
+    */
+    std::size_t max_values() const { return m_max_values; }
+
+    /*!
+    \brief Returns the directory where temporary files are created.
+    */
+    std::string const& temporary_directory() const { return m_temporary_directory; }
+
+private:
+    std::size_t m_max_values;
+    std::string m_temporary_directory;
+};
+
+/*!
+\brief The external memory packing algorithm sorting the values along the Hilbert curve.
+*/
+typedef external_sort_packing<hilbert_curve> external_hilbert_packing;
+
+/*!
+\brief The external memory packing algorithm sorting the values along the Z-order curve.
+*/
+typedef external_sort_packing<morton_curve> external_morton_packing;
+
+/*!
+\brief The bulk insertion policy.
+
+An object of this type may be passed into <tt>rtree::insert()</tt> together with
+a range of values in order to insert them faster than one by one. The values are
+packed into subtrees with the default packing algorithm. Then the subtrees are
+inserted into the existing tree at the level corresponding to their height, so
+only one path of the tree is traversed for each of them instead of for each value.
+If there are at least as many new values as the values already stored in the rtree
+the tree is created again from all of the values with the packing algorithm.
+
+The subtrees are the children of the nodes of the packed tree at the graft level,
+counted from the leafs. So for graft level 1 the leafs are inserted, for graft
+level 2 the nodes containing leafs, etc. The higher the subtrees are the faster
+the insertion is, but the more the nodes of the resulting tree may overlap
+if the new values are spread over the area of the existing ones. For graft level
+0 the values are inserted one by one.
+
+\par Example
+\verbatim
+bgi::rtree< value_t, bgi::rstar<16> > rt(values);
+rt.insert(new_values, bgi::bulk_insert());
+rt.insert(new_values2.begin(), new_values2.end(), bgi::bulk_insert(2));
+\endverbatim
+*/
+class bulk_insert
+{
+public:
+    /*!
+    \brief The constructor.
+
+    \param graft_level  The level of the nodes of the packed tree whose children are
+                        inserted into the existing tree. Default: 1, the leafs are inserted.
+    */
+    explicit bulk_insert(std::size_t graft_level = 1)
+        : m_graft_level(graft_level)
+    {}
+
+    /*!
+    \brief Returns the level of the nodes whose children are inserted.
+    */
+    std::size_t graft_level() const { return m_graft_level; }
+
+private:
+    std::size_t m_graft_level;
+};
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_PACKING_HPP
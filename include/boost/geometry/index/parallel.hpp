@@ -0,0 +1,60 @@
+// Boost.Geometry Index
+//
+// Parallel execution policy
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_PARALLEL_HPP
+#define BOOST_GEOMETRY_INDEX_PARALLEL_HPP
+
+#include <cstddef>
+
+#include <boost/geometry/util/parallel.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The parallel execution policy.
+
+An object of this type may be passed into the operations of the rtree which
+are able to use several threads, e.g. the packing constructor. The threads
+are used only if the C++11 threads support is available. Otherwise
+the operations are performed sequentially.
+
+\par Example
+\verbatim
+// create the rtree using packing algorithm and 4 threads
+bgi::rtree< value_t, bgi::rstar<16> > rt(values, bgi::parallel(4));
+// use all hardware threads
+bgi::rtree< value_t, bgi::rstar<16> > rt2(values, bgi::parallel());
+\endverbatim
+*/
+class parallel
+{
+public:
+    /*!
+    \brief The constructor.
+
+    \param threads  The maximum number of threads used. Default: 0 - the number
+                    of hardware threads.
+    */
+    explicit parallel(std::size_t threads = 0)
+        : m_threads(geometry::detail::parallel::threads_count(threads))
+    {}
+
+    /*!
+    \brief Returns the maximum number of threads used.
+    */
+    std::size_t threads() const { return m_threads; }
+
+private:
+    std::size_t m_threads;
+};
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_PARALLEL_HPP
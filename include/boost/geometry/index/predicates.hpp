@@ -375,6 +375,150 @@ path(SegmentOrLinestring const& linestring, unsigned k)
 
 #endif // BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL
 
+/*!
+\brief Generate \c contains() predicate of the spatial join.
+
+Generate a predicate defining the relationship of Values stored in two rtrees.
+With this predicate \c boost::geometry::index::join() returns the pairs of Values
+where the first Value contains the second one.
+A pair is returned if <tt>bg::within(Indexable2, Indexable1)</tt> returns <tt>true</tt>, where Indexable1
+is the Indexable of the Value stored in the first rtree and Indexable2 of the Value
+stored in the second one.
+
+\par Example
+\verbatim
+bgi::join(rtree1, rtree2, bgi::contains(), std::back_inserter(result));
+\endverbatim
+
+\ingroup predicates
+*/
+inline
+detail::predicates::join_predicate<detail::predicates::contains_tag>
+contains()
+{
+    return detail::predicates::join_predicate<detail::predicates::contains_tag>();
+}
+
+/*!
+\brief Generate \c covered_by() predicate of the spatial join.
+
+Generate a predicate defining the relationship of Values stored in two rtrees.
+With this predicate \c boost::geometry::index::join() returns the pairs of Values
+where the first Value is covered by the second one.
+A pair is returned if <tt>bg::covered_by(Indexable1, Indexable2)</tt> returns <tt>true</tt>, where Indexable1
+is the Indexable of the Value stored in the first rtree and Indexable2 of the Value
+stored in the second one.
+
+\par Example
+\verbatim
+bgi::join(rtree1, rtree2, bgi::covered_by(), std::back_inserter(result));
+\endverbatim
+
+\ingroup predicates
+*/
+inline
+detail::predicates::join_predicate<detail::predicates::covered_by_tag>
+covered_by()
+{
+    return detail::predicates::join_predicate<detail::predicates::covered_by_tag>();
+}
+
+/*!
+\brief Generate \c covers() predicate of the spatial join.
+
+Generate a predicate defining the relationship of Values stored in two rtrees.
+With this predicate \c boost::geometry::index::join() returns the pairs of Values
+where the first Value covers the second one.
+A pair is returned if <tt>bg::covered_by(Indexable2, Indexable1)</tt> returns <tt>true</tt>, where Indexable1
+is the Indexable of the Value stored in the first rtree and Indexable2 of the Value
+stored in the second one.
+
+\par Example
+\verbatim
+bgi::join(rtree1, rtree2, bgi::covers(), std::back_inserter(result));
+\endverbatim
+
+\ingroup predicates
+*/
+inline
+detail::predicates::join_predicate<detail::predicates::covers_tag>
+covers()
+{
+    return detail::predicates::join_predicate<detail::predicates::covers_tag>();
+}
+
+/*!
+\brief Generate \c intersects() predicate of the spatial join.
+
+Generate a predicate defining the relationship of Values stored in two rtrees.
+With this predicate \c boost::geometry::index::join() returns the pairs of Values
+which intersect each other.
+A pair is returned if <tt>bg::intersects(Indexable1, Indexable2)</tt> returns <tt>true</tt>, where Indexable1
+is the Indexable of the Value stored in the first rtree and Indexable2 of the Value
+stored in the second one.
+
+\par Example
+\verbatim
+bgi::join(rtree1, rtree2, bgi::intersects(), std::back_inserter(result));
+\endverbatim
+
+\ingroup predicates
+*/
+inline
+detail::predicates::join_predicate<detail::predicates::intersects_tag>
+intersects()
+{
+    return detail::predicates::join_predicate<detail::predicates::intersects_tag>();
+}
+
+/*!
+\brief Generate \c overlaps() predicate of the spatial join.
+
+Generate a predicate defining the relationship of Values stored in two rtrees.
+With this predicate \c boost::geometry::index::join() returns the pairs of Values
+which overlap each other.
+A pair is returned if <tt>bg::overlaps(Indexable1, Indexable2)</tt> returns <tt>true</tt>, where Indexable1
+is the Indexable of the Value stored in the first rtree and Indexable2 of the Value
+stored in the second one.
+
+\par Example
+\verbatim
+bgi::join(rtree1, rtree2, bgi::overlaps(), std::back_inserter(result));
+\endverbatim
+
+\ingroup predicates
+*/
+inline
+detail::predicates::join_predicate<detail::predicates::overlaps_tag>
+overlaps()
+{
+    return detail::predicates::join_predicate<detail::predicates::overlaps_tag>();
+}
+
+/*!
+\brief Generate \c within() predicate of the spatial join.
+
+Generate a predicate defining the relationship of Values stored in two rtrees.
+With this predicate \c boost::geometry::index::join() returns the pairs of Values
+where the first Value is within the second one.
+A pair is returned if <tt>bg::within(Indexable1, Indexable2)</tt> returns <tt>true</tt>, where Indexable1
+is the Indexable of the Value stored in the first rtree and Indexable2 of the Value
+stored in the second one.
+
+\par Example
+\verbatim
+bgi::join(rtree1, rtree2, bgi::within(), std::back_inserter(result));
+\endverbatim
+
+\ingroup predicates
+*/
+inline
+detail::predicates::join_predicate<detail::predicates::within_tag>
+within()
+{
+    return detail::predicates::join_predicate<detail::predicates::within_tag>();
+}
+
 namespace detail { namespace predicates {
 
 // operator! generators
@@ -0,0 +1,81 @@
+// Boost.Geometry Index
+//
+// Query statistics
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_QUERY_STATISTICS_HPP
+#define BOOST_GEOMETRY_INDEX_QUERY_STATISTICS_HPP
+
+#include <cstddef>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The counters of the work done by queries.
+
+An object of this type may be passed into the rtree query functions in order
+to gather the statistics of the traversal, e.g. to choose the parameters and
+the balancing algorithm of the rtree for a specific data set and queries.
+The counters are not reset by the query so the statistics of several queries
+may be gathered by passing the same object. The counters are increased only
+if the object is passed, otherwise the queries are not instrumented at all.
+
+The heap counters are used only by the \c nearest() queries. The heap contains
+the nodes which are going to be visited, i.e. the active branches.
+
+\par Example
+\verbatim
+bgi::query_statistics stats;
+for ( std::size_t i = 0 ; i < boxes.size() ; ++i )
+    tree.query(bgi::intersects(boxes[i]), std::back_inserter(result), stats);
+std::cout << stats.leaves << " leaves visited, " << stats.found << " values found\n";
+\endverbatim
+*/
+struct query_statistics
+{
+    /*!
+    \brief The constructor, all of the counters are set to 0.
+    */
+    query_statistics()
+    {
+        reset();
+    }
+
+    /*!
+    \brief Sets all of the counters to 0.
+    */
+    void reset()
+    {
+        internal_nodes = 0;
+        leaves = 0;
+        boxes = 0;
+        values = 0;
+        found = 0;
+        heap_pushes = 0;
+        heap_max = 0;
+    }
+
+    /*! \brief The number of internal nodes visited. */
+    std::size_t internal_nodes;
+    /*! \brief The number of leaves visited. */
+    std::size_t leaves;
+    /*! \brief The number of bounding boxes of nodes tested. */
+    std::size_t boxes;
+    /*! \brief The number of values tested. */
+    std::size_t values;
+    /*! \brief The number of values returned. */
+    std::size_t found;
+    /*! \brief The number of nodes pushed into the heap of the knn query. */
+    std::size_t heap_pushes;
+    /*! \brief The maximum number of nodes stored in the heap of the knn query at once. */
+    std::size_t heap_max;
+};
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_QUERY_STATISTICS_HPP
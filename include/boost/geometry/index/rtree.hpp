@@ -65,23 +65,35 @@
 #include <boost/geometry/index/detail/rtree/visitors/insert.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/iterator.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/remove.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/remove_if.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/copy.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/spatial_query.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/distance_query.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/distance_query_batch.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/count.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/children_box.hpp>
 
 #include <boost/geometry/index/detail/rtree/linear/linear.hpp>
 #include <boost/geometry/index/detail/rtree/quadratic/quadratic.hpp>
 #include <boost/geometry/index/detail/rtree/rstar/rstar.hpp>
-//#include <boost/geometry/extensions/index/detail/rtree/kmeans/kmeans.hpp>
+#include <boost/geometry/index/detail/rtree/kmeans/kmeans.hpp>
 
 #include <boost/geometry/index/detail/rtree/pack_create.hpp>
+#include <boost/geometry/index/detail/rtree/pack_external.hpp>
+#include <boost/geometry/index/detail/rtree/pack_insert.hpp>
+#include <boost/geometry/index/detail/rtree/optimize.hpp>
+#include <boost/geometry/index/detail/rtree/parallel_query.hpp>
 
+#include <boost/geometry/index/arena_allocator.hpp>
+#include <boost/geometry/index/callback.hpp>
 #include <boost/geometry/index/inserter.hpp>
+#include <boost/geometry/index/parallel.hpp>
+#include <boost/geometry/index/packing.hpp>
+#include <boost/geometry/index/query_statistics.hpp>
 
 #include <boost/geometry/index/detail/rtree/utilities/view.hpp>
+#include <boost/geometry/index/detail/rtree/members_access.hpp>
 
 #include <boost/geometry/index/detail/rtree/iterators.hpp>
 #include <boost/geometry/index/detail/rtree/query_iterators.hpp>
@@ -114,13 +126,15 @@ algorithm with specific parameters like min and max number of elements in node.
 Predefined algorithms with compile-time parameters are:
 \li <tt>boost::geometry::index::linear</tt>,
  \li <tt>boost::geometry::index::quadratic</tt>,
- \li <tt>boost::geometry::index::rstar</tt>.
+ \li <tt>boost::geometry::index::rstar</tt>,
+ \li <tt>boost::geometry::index::kmeans</tt>.
 
 \par
 Predefined algorithms with run-time parameters are:
  \li \c boost::geometry::index::dynamic_linear,
  \li \c boost::geometry::index::dynamic_quadratic,
- \li \c boost::geometry::index::dynamic_rstar.
+ \li \c boost::geometry::index::dynamic_rstar,
+ \li \c boost::geometry::index::dynamic_kmeans.
 
 \par IndexableGetter
 The object of IndexableGetter type translates from Value to Indexable each time
@@ -142,6 +156,11 @@ some Geometry concept defined in Boost.Geometry and the result of
 <tt>operator==</tt> for other types. Components of Pairs and Tuples are
 compared left-to-right.
 
+\par Allocator
+The nodes may be allocated in an arena with <tt>boost::geometry::index::arena_allocator</tt>.
+Then clearing and destroying the rtree takes constant time if Value and Box are
+trivially destructible and the memory is freed by the arena.
+
 \tparam Value           The type of objects stored in the container.
 \tparam Parameters      Compile-time parameters.
 \tparam IndexableGetter The function object extracting Indexable from Value.
@@ -306,6 +325,7 @@ private:
     typedef typename members_holder::allocator_traits_type allocator_traits_type;
 
     friend class detail::rtree::utilities::view<rtree>;
+    friend struct detail::rtree::members_access<rtree>;
 #ifdef BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL
     friend class detail::rtree::private_view<rtree>;
     friend class detail::rtree::const_private_view<rtree>;
@@ -491,6 +511,229 @@ public:
     /*!
     \brief The constructor.
 
+    The tree is created using packing algorithm. The subtrees are created
+    concurrently. The structure of the tree is the same as the structure
+    of the tree created by the sequential packing algorithm.
+
+    \param first        The beginning of the range of Values.
+    \param last         The end of the range of Values.
+    \param policy       The parallel execution policy.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    The nodes are allocated concurrently so the allocator must be thread-safe.
+    Using \c arena_allocator is a compile-time error.
+    */
+    template<typename Iterator>
+    inline rtree(Iterator first, Iterator last,
+                 index::parallel const& policy,
+                 parameters_type const& parameters = parameters_type(),
+                 indexable_getter const& getter = indexable_getter(),
+                 value_equal const& equal = value_equal(),
+                 allocator_type const& allocator = allocator_type())
+        : m_members(getter, equal, parameters, allocator)
+    {
+        BOOST_MPL_ASSERT_MSG((! detail::is_arena_allocator<allocator_type>::value),
+                             ARENA_ALLOCATOR_CANNOT_BE_USED_BY_SEVERAL_THREADS,
+                             (allocator_type));
+
+        pack_construct(first, last, boost::container::new_allocator<void>(), policy.threads());
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using packing algorithm. The subtrees are created
+    concurrently. The structure of the tree is the same as the structure
+    of the tree created by the sequential packing algorithm.
+
+    \param rng          The range of Values.
+    \param policy       The parallel execution policy.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    The nodes are allocated concurrently so the allocator must be thread-safe.
+    Using \c arena_allocator is a compile-time error.
+    */
+    template<typename Range>
+    inline rtree(Range const& rng,
+                 index::parallel const& policy,
+                 parameters_type const& parameters = parameters_type(),
+                 indexable_getter const& getter = indexable_getter(),
+                 value_equal const& equal = value_equal(),
+                 allocator_type const& allocator = allocator_type())
+        : m_members(getter, equal, parameters, allocator)
+    {
+        BOOST_MPL_ASSERT_MSG((! detail::is_arena_allocator<allocator_type>::value),
+                             ARENA_ALLOCATOR_CANNOT_BE_USED_BY_SEVERAL_THREADS,
+                             (allocator_type));
+
+        pack_construct(::boost::begin(rng), ::boost::end(rng), boost::container::new_allocator<void>(), policy.threads());
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using sort-based packing algorithm. The values are sorted
+    along the space-filling curve and the nodes are filled sequentially.
+
+    \param first        The beginning of the range of Values.
+    \param last         The end of the range of Values.
+    \param policy       The packing algorithm policy, e.g. \c hilbert_packing.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    If more than one thread is used the nodes are allocated concurrently
+    so the allocator must be thread-safe. The exception is \c arena_allocator,
+    with which the values are sorted by several threads but the nodes are created
+    by one thread. Unlike in the case of the parallel constructors this isn't
+    a compile-time error because the number of threads of \c sort_packing
+    is known only at run-time and the same constructor is used by one thread.
+    */
+    template<typename Iterator, typename Curve>
+    inline rtree(Iterator first, Iterator last,
+                 index::sort_packing<Curve> const& policy,
+                 parameters_type const& parameters = parameters_type(),
+                 indexable_getter const& getter = indexable_getter(),
+                 value_equal const& equal = value_equal(),
+                 allocator_type const& allocator = allocator_type())
+        : m_members(getter, equal, parameters, allocator)
+    {
+        pack_construct_sorted<Curve>(first, last, boost::container::new_allocator<void>(), policy.threads());
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using sort-based packing algorithm. The values are sorted
+    along the space-filling curve and the nodes are filled sequentially.
+
+    \param rng          The range of Values.
+    \param policy       The packing algorithm policy, e.g. \c hilbert_packing.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    If more than one thread is used the nodes are allocated concurrently
+    so the allocator must be thread-safe. The exception is \c arena_allocator,
+    with which the values are sorted by several threads but the nodes are created
+    by one thread. Unlike in the case of the parallel constructors this isn't
+    a compile-time error because the number of threads of \c sort_packing
+    is known only at run-time and the same constructor is used by one thread.
+    */
+    template<typename Range, typename Curve>
+    inline rtree(Range const& rng,
+                 index::sort_packing<Curve> const& policy,
+                 parameters_type const& parameters = parameters_type(),
+                 indexable_getter const& getter = indexable_getter(),
+                 value_equal const& equal = value_equal(),
+                 allocator_type const& allocator = allocator_type())
+        : m_members(getter, equal, parameters, allocator)
+    {
+        pack_construct_sorted<Curve>(::boost::begin(rng), ::boost::end(rng), boost::container::new_allocator<void>(), policy.threads());
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using external memory sort-based packing algorithm.
+    The values are read from the range once, sorted along the space-filling curve
+    with the external merge sort using temporary files and the nodes are filled
+    sequentially. The range may be defined by input iterators.
+
+    \param first        The beginning of the range of Values.
+    \param last         The end of the range of Values.
+    \param policy       The packing algorithm policy, e.g. \c external_hilbert_packing.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    \li If a temporary file can't be created, written or read.
+    */
+    template<typename Iterator, typename Curve>
+    inline rtree(Iterator first, Iterator last,
+                 index::external_sort_packing<Curve> const& policy,
+                 parameters_type const& parameters = parameters_type(),
+                 indexable_getter const& getter = indexable_getter(),
+                 value_equal const& equal = value_equal(),
+                 allocator_type const& allocator = allocator_type())
+        : m_members(getter, equal, parameters, allocator)
+    {
+        pack_construct_external(first, last, policy);
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using external memory sort-based packing algorithm.
+    The values are read from the range once, sorted along the space-filling curve
+    with the external merge sort using temporary files and the nodes are filled
+    sequentially.
+
+    \param rng          The range of Values.
+    \param policy       The packing algorithm policy, e.g. \c external_hilbert_packing.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    \li If a temporary file can't be created, written or read.
+    */
+    template<typename Range, typename Curve>
+    inline rtree(Range const& rng,
+                 index::external_sort_packing<Curve> const& policy,
+                 parameters_type const& parameters = parameters_type(),
+                 indexable_getter const& getter = indexable_getter(),
+                 value_equal const& equal = value_equal(),
+                 allocator_type const& allocator = allocator_type())
+        : m_members(getter, equal, parameters, allocator)
+    {
+        pack_construct_external(::boost::begin(rng), ::boost::end(rng), policy);
+    }
+
+    /*!
+    \brief The constructor.
+
     The tree is created using packing algorithm and a temporary packing allocator.
 
     \param first        The beginning of the range of Values.
@@ -852,6 +1095,63 @@ public:
             this->raw_insert(*first);
     }
 
+    /*!
+    \brief Insert a range of values to the index using the bulk insertion algorithm.
+
+    The values are packed into subtrees which are inserted into the tree. If there are
+    at least as many new values as the values already stored in the container the tree
+    is created again from all of the values with the packing algorithm.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+    \param policy   The bulk insertion policy.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    template <typename Iterator>
+    inline void insert(Iterator first, Iterator last, index::bulk_insert const& policy)
+    {
+        this->raw_insert_packed(first, last, policy);
+    }
+
+    /*!
+    \brief Insert a range of values to the index using the bulk insertion algorithm.
+
+    The values are packed into subtrees which are inserted into the tree. If there are
+    at least as many new values as the values already stored in the container the tree
+    is created again from all of the values with the packing algorithm.
+
+    \param rng      The range of values.
+    \param policy   The bulk insertion policy.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    template <typename Range>
+    inline void insert(Range const& rng, index::bulk_insert const& policy)
+    {
+        BOOST_MPL_ASSERT_MSG((detail::is_range<Range>::value),
+                             PASSED_OBJECT_IS_NOT_A_RANGE,
+                             (Range));
+
+        this->raw_insert_packed(::boost::begin(rng), ::boost::end(rng), policy);
+    }
+
     /*!
     \brief Insert a value created using convertible object or a range of values to the index.
 
@@ -980,6 +1280,84 @@ public:
         return this->remove_dispatch(conv_or_rng, is_conv_t());
     }
 
+    /*!
+    \brief Remove all values meeting passed spatial predicates, e.g. intersecting some Box.
+
+    All of the values are removed in one traversal of the tree. Only the nodes meeting
+    the predicates are visited. The nodes containing too few elements after the removal
+    are removed from the tree and their elements are reinserted at the end.
+
+    \par Example
+    \verbatim
+    // remove all values intersecting box
+    tree.remove_if(bgi::intersects(box));
+    // remove all values intersecting box with timestamp older than t
+    tree.remove_if(bgi::intersects(box) && bgi::satisfies(older_than(t)));
+    \endverbatim
+
+    \param predicates   Spatial predicates. The \c nearest() predicate can't be passed.
+
+    \return             The number of removed values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If predicates copy throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    template <typename Predicates>
+    inline size_type remove_if(Predicates const& predicates)
+    {
+        if ( !m_members.root )
+            return 0;
+
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count == 0), NEAREST_PREDICATE_CAN_NOT_BE_PASSED, (Predicates));
+
+        return this->raw_remove_if(predicates);
+    }
+
+    /*!
+    \brief Reorganizes the nodes degraded by insertions and removals.
+
+    The tree is traversed bottom-up. For each internal node the elements of its children are
+    distributed between the minimal number of new children with the top-down split used by
+    the packing algorithm. The new children replace the old ones only if the sum of the contents
+    of their boxes is smaller. The values and the height of the tree are not changed.
+
+    \par Example
+    \verbatim
+    // after many insertions and removals
+    tree.optimize();
+    \endverbatim
+
+    \return             The number of reorganized nodes.
+
+    \par Throws
+    \li If Value copy constructor throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown some of the nodes may be reorganized and other not.
+    */
+    inline size_type optimize()
+    {
+        if ( !m_members.root )
+            return 0;
+
+        return detail::rtree::optimize<members_holder>::apply(m_members.root,
+                                                              m_members.leafs_level,
+                                                              m_members.parameters(),
+                                                              m_members.translator(),
+                                                              m_members.allocators());              // MAY THROW (V, E: alloc, copy, N: alloc)
+    }
+
     /*!
     \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
 
@@ -1023,6 +1401,12 @@ public:
 
     Predicates may be passed together connected with \c operator&&().
 
+    <b>Callback</b>
+
+    Instead of the output iterator an object generated by \c boost::geometry::index::callback()
+    may be passed. Then the values found are passed to the function object by const reference
+    and the query is stopped when the function object returns \c false.
+
     \par Example
     \verbatim
     // return elements intersecting box
@@ -1034,34 +1418,176 @@ public:
     // return 5 elements nearest to pt and elements are intersecting box
     tree.query(bgi::nearest(pt, 5) && bgi::intersects(box), std::back_inserter(result));
 
-    // For each found value do_something (it is a type of function object)
-    tree.query(bgi::intersects(box),
-               boost::make_function_output_iterator(do_something()));
+    // For each found value do_something (it is a type of function object)
+    tree.query(bgi::intersects(box),
+               boost::make_function_output_iterator(do_something()));
+
+    // For each value stored in the rtree do_something
+    // always_true is a type of function object always returning true
+    tree.query(bgi::satisfies(always_true()),
+               boost::make_function_output_iterator(do_something()));
+
+    // C++11 (lambda expression)
+    tree.query(bgi::intersects(box),
+               boost::make_function_output_iterator([](value_type const& val){
+                   // do something
+               }));
+
+    // C++14 (generic lambda expression)
+    tree.query(bgi::intersects(box),
+               boost::make_function_output_iterator([](auto const& val){
+                   // do something
+               }));
+
+    // C++11 (lambda expression) check if any element intersects box
+    bool any = tree.query(bgi::intersects(box),
+                          bgi::callback([](value_type const&){ return false; })) > 0;
+    \endverbatim
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If predicates copy throws.
+
+    \warning
+    Only one \c nearest() predicate may be passed to the query. Passing more of them results in compile-time error.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter(),
+                        or the callback generated by boost::geometry::index::callback().
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it) const
+    {
+        if ( !m_members.root )
+            return 0;
+
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        static const bool is_distance_predicate = 0 < distance_predicates_count;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
+
+        return query_dispatch(predicates, out_it, boost::mpl::bool_<is_distance_predicate>(),
+                              detail::no_query_statistics());
+    }
+
+    /*!
+    \brief Finds values meeting passed predicates and gathers the statistics of the query.
+
+    This function is equivalent to query() but additionally the counters of the nodes
+    and values visited and tested are increased. The counters are not reset so
+    the statistics of several queries may be gathered. See
+    \c boost::geometry::index::query_statistics.
+
+    \par Example
+    \verbatim
+    bgi::query_statistics stats;
+    tree.query(bgi::intersects(box), std::back_inserter(result), stats);
+    tree.query(bgi::nearest(pt, 5), std::back_inserter(result), stats);
+    \endverbatim
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If predicates copy throws.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter(),
+                        or the callback generated by boost::geometry::index::callback().
+    \param stats        The statistics of the query.
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it, index::query_statistics & stats) const
+    {
+        if ( !m_members.root )
+            return 0;
+
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        static const bool is_distance_predicate = 0 < distance_predicates_count;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
+
+        return query_dispatch(predicates, out_it, boost::mpl::bool_<is_distance_predicate>(),
+                              detail::query_statistics_counter(stats));
+    }
+
+    /*!
+    \brief Finds values meeting passed predicates using depth-first traversal in knn query.
+
+    This function is equivalent to query(). See \c boost::geometry::index::depth_first.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it, index::depth_first const& /*traversal*/) const
+    {
+        return this->query(predicates, out_it);
+    }
+
+    /*!
+    \brief Finds values meeting passed spatial predicates using several threads.
+
+    The top levels of the rtree are traversed first in order to find the nodes meeting
+    the predicates. Then the threads take these nodes one by one and query their subtrees
+    concurrently. The values found in each subtree are stored in a separate buffer.
+    After all of the threads are finished, the calling thread writes the buffers to the
+    output iterator in the order of the subtrees, so the values are written in the same
+    order as by the sequential query(). The callback generated by
+    boost::geometry::index::callback() is also called by the calling thread, after
+    the whole query is performed. If the \c nearest() predicate is passed the query
+    is performed sequentially.
+
+    The rtree mustn't be modified during the query.
+
+    \par Example
+    \verbatim
+    tree.query(bgi::intersects(box), std::back_inserter(result), bgi::parallel(4));
+    \endverbatim
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If predicates copy throws.
+    If memory allocation throws.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter(),
+                        or the callback generated by boost::geometry::index::callback().
+    \param policy       The parallel execution policy.
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it, index::parallel const& policy) const
+    {
+        if ( !m_members.root )
+            return 0;
+
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        static const bool is_distance_predicate = 0 < distance_predicates_count;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
 
-    // For each value stored in the rtree do_something
-    // always_true is a type of function object always returning true
-    tree.query(bgi::satisfies(always_true()),
-               boost::make_function_output_iterator(do_something()));
+        return query_parallel_dispatch(predicates, out_it, policy.threads(), boost::mpl::bool_<is_distance_predicate>());
+    }
 
-    // C++11 (lambda expression)
-    tree.query(bgi::intersects(box),
-               boost::make_function_output_iterator([](value_type const& val){
-                   // do something
-               }));
+    /*!
+    \brief Finds values meeting passed predicates using best-first traversal in knn query.
 
-    // C++14 (generic lambda expression)
-    tree.query(bgi::intersects(box),
-               boost::make_function_output_iterator([](auto const& val){
-                   // do something
-               }));
+    This function works like query() but if the nearest predicate is passed the nodes of the rtree
+    are visited in the order of increasing distance. See \c boost::geometry::index::best_first.
+    Spatial queries are performed the same way as in the case of query().
+
+    \par Example
+    \verbatim
+    tree.query(bgi::nearest(pt, 5), std::back_inserter(result), bgi::best_first());
     \endverbatim
 
     \par Throws
     If Value copy constructor or copy assignment throws.
     If predicates copy throws.
-
-    \warning
-    Only one \c nearest() predicate may be passed to the query. Passing more of them results in compile-time error.
+    If memory allocation throws.
 
     \param predicates   Predicates.
     \param out_it       The output iterator, e.g. generated by std::back_inserter().
@@ -1069,7 +1595,7 @@ public:
     \return             The number of values found.
     */
     template <typename Predicates, typename OutIter>
-    size_type query(Predicates const& predicates, OutIter out_it) const
+    size_type query(Predicates const& predicates, OutIter out_it, index::best_first const& /*traversal*/) const
     {
         if ( !m_members.root )
             return 0;
@@ -1078,9 +1604,107 @@ public:
         static const bool is_distance_predicate = 0 < distance_predicates_count;
         BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
 
-        return query_dispatch(predicates, out_it, boost::mpl::bool_<is_distance_predicate>());
+        return query_best_first_dispatch(predicates, out_it, boost::mpl::bool_<is_distance_predicate>());
+    }
+
+    /*!
+    \brief Finds k nearest values for each geometry in a range.
+
+    This function performs k-nearest neighbor searches for many geometries at once. It's equivalent
+    to calling query() with \c boost::geometry::index::nearest() predicate for each geometry
+    but the memory used internally is allocated only once for the whole batch.
+
+    The results are returned in the Compressed Sparse Row format. The values found for all geometries
+    are written to \c out_it, the values of one query after the values of the previous one. The values
+    of each query are sorted by the distance to the query geometry, nearest first. Before the first query
+    0 is written to \c offsets_it and after each query the total number of values found so far.
+    So <tt>size(queries) + 1</tt> offsets are written and the values found for the i-th geometry are
+    at positions <tt>[offsets[i], offsets[i+1])</tt> of the output.
+
+    If \c group_queries is \c true the queries are internally performed in the order of the Z-order
+    curve covering the bounds of the rtree. Then spatially close queries are performed one after
+    another and visit mostly the same nodes which are likely to be still in the cache. In this case
+    the results are buffered and written in the order of the geometries in the range after all queries
+    are performed. This option is useful if the geometries in the range are not ordered spatially.
+
+    \par Example
+    \verbatim
+    std::vector<size_type> offsets;
+    std::vector<value_type> result;
+    tree.nearest_batch(points, 5, std::back_inserter(offsets), std::back_inserter(result));
+    // values nearest to points[i] are in [result.begin() + offsets[i], result.begin() + offsets[i+1])
+    \endverbatim
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If memory allocation throws.
+
+    \warning
+    The number of neighbors must be greater than 0.
+
+    \param queries        The range of geometries for which the nearest values are searched.
+    \param k              The number of nearest values searched for each geometry.
+    \param offsets_it     The output iterator of offsets, e.g. generated by std::back_inserter().
+    \param out_it         The output iterator of values, e.g. generated by std::back_inserter().
+    \param group_queries  If \c true the queries are performed in spatial order.
+
+    \return               The number of values found.
+    */
+    template <typename QueryRange, typename OffsetIter, typename OutIter>
+    size_type nearest_batch(QueryRange const& queries, unsigned k,
+                            OffsetIter offsets_it, OutIter out_it,
+                            bool group_queries = false) const
+    {
+        return nearest_batch_dispatch(queries, k, offsets_it, out_it, group_queries, index::depth_first());
+    }
+
+    /*!
+    \brief Finds k nearest values for each geometry in a range using passed traversal.
+
+    This function works like nearest_batch() but the traversal of the rtree may be chosen.
+    It may be \c boost::geometry::index::depth_first or \c boost::geometry::index::best_first.
+
+    \param queries        The range of geometries for which the nearest values are searched.
+    \param k              The number of nearest values searched for each geometry.
+    \param offsets_it     The output iterator of offsets, e.g. generated by std::back_inserter().
+    \param out_it         The output iterator of values, e.g. generated by std::back_inserter().
+    \param group_queries  If \c true the queries are performed in spatial order.
+    \param traversal      The traversal of the rtree.
+
+    \return               The number of values found.
+    */
+    template <typename QueryRange, typename OffsetIter, typename OutIter>
+    size_type nearest_batch(QueryRange const& queries, unsigned k,
+                            OffsetIter offsets_it, OutIter out_it,
+                            bool group_queries, index::depth_first const& traversal) const
+    {
+        return nearest_batch_dispatch(queries, k, offsets_it, out_it, group_queries, traversal);
+    }
+
+    /*!
+    \brief Finds k nearest values for each geometry in a range using passed traversal.
+
+    This function works like nearest_batch() but the traversal of the rtree may be chosen.
+    It may be \c boost::geometry::index::depth_first or \c boost::geometry::index::best_first.
+
+    \param queries        The range of geometries for which the nearest values are searched.
+    \param k              The number of nearest values searched for each geometry.
+    \param offsets_it     The output iterator of offsets, e.g. generated by std::back_inserter().
+    \param out_it         The output iterator of values, e.g. generated by std::back_inserter().
+    \param group_queries  If \c true the queries are performed in spatial order.
+    \param traversal      The traversal of the rtree.
+
+    \return               The number of values found.
+    */
+    template <typename QueryRange, typename OffsetIter, typename OutIter>
+    size_type nearest_batch(QueryRange const& queries, unsigned k,
+                            OffsetIter offsets_it, OutIter out_it,
+                            bool group_queries, index::best_first const& traversal) const
+    {
+        return nearest_batch_dispatch(queries, k, offsets_it, out_it, group_queries, traversal);
     }
 
+
     /*!
     \brief Returns a query iterator pointing at the begin of the query range.
 
@@ -1129,6 +1753,70 @@ public:
         return const_query_iterator(qbegin_(predicates));
     }
 
+    /*!
+    \brief Returns a query iterator pointing at the begin of the query range and gathering the statistics.
+
+    This method is equivalent to qbegin() but additionally the counters of the nodes
+    and values visited and tested are increased during the iteration. The copies
+    of the iterator increase the same counters so the statistics object must exist
+    as long as the iterator and its copies are used. See
+    \c boost::geometry::index::query_statistics.
+
+    \par Example
+    \verbatim
+    bgi::query_statistics stats;
+    for ( Rtree::const_query_iterator it = tree.qbegin(bgi::nearest(pt, 100), stats) ;
+          it != tree.qend() ; ++it )
+    {
+        // do something with value
+    }
+    \endverbatim
+
+    \par Iterator category
+    ForwardIterator
+
+    \par Throws
+    If predicates copy throws.
+    If allocation throws.
+
+    \warning
+    The modification of the rtree may invalidate the iterators.
+
+    \param predicates   Predicates.
+    \param stats        The statistics of the query.
+
+    \return             The iterator pointing at the begin of the query range.
+    */
+    template <typename Predicates>
+    const_query_iterator qbegin(Predicates const& predicates, index::query_statistics & stats) const
+    {
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
+
+        typedef typename boost::mpl::if_c<
+            detail::predicates_count_distance<Predicates>::value == 0,
+            detail::rtree::iterators::spatial_query_iterator
+                <
+                    members_holder, Predicates, detail::query_statistics_counter
+                >,
+            detail::rtree::iterators::distance_query_iterator
+                <
+                    members_holder, Predicates,
+                    detail::predicates_find_distance<Predicates>::value,
+                    detail::query_statistics_counter
+                >
+        >::type iterator_type;
+
+        detail::query_statistics_counter const counter(stats);
+
+        if ( !m_members.root )
+            return const_query_iterator(iterator_type(m_members.parameters(), m_members.translator(),
+                                                      predicates, counter));
+
+        return const_query_iterator(iterator_type(m_members.root, m_members.parameters(), m_members.translator(),
+                                                  predicates, counter));
+    }
+
     /*!
     \brief Returns a query iterator pointing at the end of the query range.
 
@@ -1691,6 +2379,26 @@ private:
         ++m_members.values_count;
     }
 
+    /*!
+    \brief Insert the values packed into subtrees.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+    \param policy   The bulk insertion policy.
+
+    \par Exception-safety
+    basic
+    */
+    template <typename Iterator>
+    inline void raw_insert_packed(Iterator first, Iterator last, index::bulk_insert const& policy)
+    {
+        detail::rtree::pack_insert<members_holder>::apply(first, last,
+                                                          m_members.root, m_members.values_count, m_members.leafs_level,
+                                                          static_cast<size_type>(policy.graft_level()),
+                                                          m_members.parameters(), m_members.translator(),
+                                                          m_members.allocators(), boost::container::new_allocator<void>());
+    }
+
     /*!
     \brief Remove the value from the container.
 
@@ -1724,6 +2432,34 @@ private:
         return 0;
     }
 
+    /*!
+    \brief Remove all values meeting predicates.
+
+    \param predicates   The spatial predicates.
+
+    \par Exception-safety
+    basic
+    */
+    template <typename Predicates>
+    inline size_type raw_remove_if(Predicates const& predicates)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_members.root, "The root must exist");
+
+        detail::rtree::visitors::remove_if<members_holder, Predicates>
+            remove_v(m_members.root, m_members.leafs_level, predicates,
+                     m_members.parameters(), m_members.translator(), m_members.allocators());
+
+        detail::rtree::apply_visitor(remove_v, *m_members.root);
+
+        // If exception is thrown, m_values_count may be invalid
+
+        BOOST_GEOMETRY_INDEX_ASSERT(remove_v.removed_count() <= m_members.values_count, "unexpected state");
+
+        m_members.values_count -= remove_v.removed_count();
+
+        return remove_v.removed_count();
+    }
+
     /*!
     \brief Create an empty R-tree i.e. new empty root node and clear other attributes.
 
@@ -1879,11 +2615,12 @@ private:
     \par Exception-safety
     strong
     */
-    template <typename Predicates, typename OutIter>
-    size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<false> const& /*is_distance_predicate*/) const
+    template <typename Predicates, typename OutIter, typename Statistics>
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<false> const& /*is_distance_predicate*/,
+                             Statistics const& stats) const
     {
-        detail::rtree::visitors::spatial_query<members_holder, Predicates, OutIter>
-            find_v(m_members.parameters(), m_members.translator(), predicates, out_it);
+        detail::rtree::visitors::spatial_query<members_holder, Predicates, OutIter, Statistics>
+            find_v(m_members.parameters(), m_members.translator(), predicates, out_it, stats);
 
         detail::rtree::apply_visitor(find_v, *m_members.root);
 
@@ -1891,13 +2628,44 @@ private:
     }
 
     /*!
-    \brief Perform nearest neighbour search.
+    \brief Return values meeting predicates using several threads.
+
+    \par Exception-safety
+    strong
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query_parallel_dispatch(Predicates const& predicates, OutIter out_it, std::size_t threads,
+                                      boost::mpl::bool_<false> const& is_distance_predicate) const
+    {
+        if ( threads <= 1 )
+            return query_dispatch(predicates, out_it, is_distance_predicate, detail::no_query_statistics());
+
+        return detail::rtree::parallel_query<members_holder, Predicates>
+                ::apply(m_members, predicates, out_it, threads);
+    }
+
+    /*!
+    \brief Perform nearest neighbour search sequentially.
 
     \par Exception-safety
     strong
     */
     template <typename Predicates, typename OutIter>
-    size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<true> const& /*is_distance_predicate*/) const
+    size_type query_parallel_dispatch(Predicates const& predicates, OutIter out_it, std::size_t /*threads*/,
+                                      boost::mpl::bool_<true> const& is_distance_predicate) const
+    {
+        return query_dispatch(predicates, out_it, is_distance_predicate, detail::no_query_statistics());
+    }
+
+    /*!
+    \brief Perform nearest neighbour search.
+
+    \par Exception-safety
+    strong
+    */
+    template <typename Predicates, typename OutIter, typename Statistics>
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<true> const& /*is_distance_predicate*/,
+                             Statistics const& stats) const
     {
         BOOST_GEOMETRY_INDEX_ASSERT(m_members.root, "The root must exist");
 
@@ -1906,14 +2674,79 @@ private:
             members_holder,
             Predicates,
             distance_predicate_index,
-            OutIter
-        > distance_v(m_members.parameters(), m_members.translator(), predicates, out_it);
+            OutIter,
+            Statistics
+        > distance_v(m_members.parameters(), m_members.translator(), predicates, out_it, stats);
 
         detail::rtree::apply_visitor(distance_v, *m_members.root);
 
         return distance_v.finish();
     }
     
+    /*!
+    \brief Return values meeting predicates.
+
+    \par Exception-safety
+    strong
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query_best_first_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<false> const& is_distance_predicate) const
+    {
+        return query_dispatch(predicates, out_it, is_distance_predicate, detail::no_query_statistics());
+    }
+
+    /*!
+    \brief Perform nearest neighbour search using best-first traversal.
+
+    \par Exception-safety
+    strong
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query_best_first_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<true> const& /*is_distance_predicate*/) const
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_members.root, "The root must exist");
+
+        static const unsigned distance_predicate_index = detail::predicates_find_distance<Predicates>::value;
+        detail::rtree::visitors::distance_query_best_first<
+            members_holder,
+            Predicates,
+            distance_predicate_index,
+            OutIter
+        > distance_v(m_members.parameters(), m_members.translator(), predicates, out_it,
+                     m_members.leafs_level);
+
+        distance_v.apply(*m_members.root);
+
+        return distance_v.finish();
+    }
+
+    /*!
+    \brief Perform k nearest neighbours search for each geometry in a range.
+
+    \par Exception-safety
+    strong
+    */
+    template <typename QueryRange, typename OffsetIter, typename OutIter, typename Traversal>
+    size_type nearest_batch_dispatch(QueryRange const& queries, unsigned k,
+                                     OffsetIter offsets_it, OutIter out_it,
+                                     bool group_queries, Traversal const& traversal) const
+    {
+        *offsets_it = 0;
+        ++offsets_it;
+
+        if ( !m_members.root )
+        {
+            for ( typename boost::range_size<QueryRange>::type i = boost::size(queries) ; i > 0 ; --i, ++offsets_it )
+                *offsets_it = 0;
+            return 0;
+        }
+
+        return detail::rtree::visitors::distance_query_batch_apply<members_holder>(
+                    *m_members.root, this->bounds(),
+                    m_members.parameters(), m_members.translator(), m_members.leafs_level,
+                    queries, k, offsets_it, out_it, group_queries, traversal);
+    }
+
     /*!
     \brief Count elements corresponding to value or indexable.
 
@@ -1944,6 +2777,7 @@ private:
     \param first             The beginning of the range of Values.
     \param last              The end of the range of Values.
     \param temp_allocator    The temporary allocator object to be used by the packing algorithm.
+    \param threads           The maximum number of threads used by the packing algorithm.
 
     \par Throws
     \li If allocator copy constructor throws.
@@ -1951,13 +2785,76 @@ private:
     \li If allocation throws or returns invalid value.
     */
     template<typename Iterator, typename PackAlloc>
-    inline void pack_construct(Iterator first, Iterator last, PackAlloc const& temp_allocator)
+    inline void pack_construct(Iterator first, Iterator last, PackAlloc const& temp_allocator,
+                               std::size_t threads = 1)
     {
         typedef detail::rtree::pack<members_holder> pack;
         size_type vc = 0, ll = 0;
         m_members.root = pack::apply(first, last, vc, ll,
                                      m_members.parameters(), m_members.translator(),
-                                     m_members.allocators(), temp_allocator);
+                                     m_members.allocators(), temp_allocator, threads);
+        m_members.values_count = vc;
+        m_members.leafs_level = ll;
+    }
+
+    /*!
+    \brief Creates the tree using sort-based packing algorithm.
+
+    \param first             The beginning of the range of Values.
+    \param last              The end of the range of Values.
+    \param temp_allocator    The temporary allocator object to be used by the packing algorithm.
+    \param threads           The maximum number of threads used by the packing algorithm.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    */
+    template<typename Curve, typename Iterator, typename PackAlloc>
+    inline void pack_construct_sorted(Iterator first, Iterator last, PackAlloc const& temp_allocator,
+                                      std::size_t threads)
+    {
+        // the arena isn't thread-safe so the nodes are created by one thread
+        std::size_t const nodes_threads = detail::is_arena_allocator<allocator_type>::value ? 1 : threads;
+
+        typedef detail::rtree::pack<members_holder> pack;
+        size_type vc = 0, ll = 0;
+        m_members.root = pack::template apply_sorted<Curve>(first, last, vc, ll,
+                                                            m_members.parameters(), m_members.translator(),
+                                                            m_members.allocators(), temp_allocator,
+                                                            threads, nodes_threads);
+        m_members.values_count = vc;
+        m_members.leafs_level = ll;
+    }
+
+    /*!
+    \brief Creates the tree using external memory sort-based packing algorithm.
+
+    \param first     The beginning of the range of Values.
+    \param last      The end of the range of Values.
+    \param policy    The packing algorithm policy.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    \li If a temporary file can't be created, written or read.
+    */
+    template<typename Iterator, typename Curve>
+    inline void pack_construct_external(Iterator first, Iterator last,
+                                        index::external_sort_packing<Curve> const& policy)
+    {
+        typedef detail::rtree::pack<members_holder> pack;
+        typedef detail::rtree::external::external_sort<value_type, box_type> external_sort;
+
+        external_sort sorted(first, last, m_members.translator(),
+                             detail::get_strategy(m_members.parameters()), policy);
+
+        size_type const vc = static_cast<size_type>(sorted.values_count());
+        size_type ll = 0;
+        m_members.root = pack::apply_sorted_source(sorted, vc, ll,
+                                                   m_members.parameters(), m_members.translator(),
+                                                   m_members.allocators());
         m_members.values_count = vc;
         m_members.leafs_level = ll;
     }
@@ -2095,6 +2992,27 @@ remove(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> & tree,
     return tree.remove(conv_or_rng);
 }
 
+/*!
+\brief Remove all values meeting passed spatial predicates from the container.
+
+It calls <tt>rtree::remove_if(Predicates const&)</tt>.
+
+\ingroup rtree_functions
+
+\param tree         The spatial index.
+\param predicates   Spatial predicates.
+
+\return             The number of removed values.
+*/
+template<typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+         typename Predicates>
+inline typename rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::size_type
+remove_if(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> & tree,
+          Predicates const& predicates)
+{
+    return tree.remove_if(predicates);
+}
+
 /*!
 \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
 
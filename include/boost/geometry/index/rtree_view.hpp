@@ -0,0 +1,885 @@
+// Boost.Geometry Index
+//
+// Read-only view of the R-tree stored in the flat, pointer-free layout
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_RTREE_VIEW_HPP
+#define BOOST_GEOMETRY_INDEX_RTREE_VIEW_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/if.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/index/detail/rtree/flat/layout.hpp>
+#include <boost/geometry/index/detail/rtree/flat/quantized.hpp>
+#include <boost/geometry/index/detail/rtree/flat/query.hpp>
+#include <boost/geometry/index/detail/rtree/flat/write.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The level order of nodes in the flat layout.
+
+The nodes are stored level by level starting from the root. The nodes of the
+upper levels are close to each other which is good for queries touching many
+nodes.
+*/
+struct level_order {};
+
+/*!
+\brief The van Emde Boas order of nodes in the flat layout.
+
+The tree is recursively divided into the top half of levels and the subtrees
+below it and each part is stored contiguously. Therefore the nodes visited
+on a path from the root to a leaf are close to each other regardless of the
+size of the cache. This is good for queries returning few values.
+*/
+struct van_emde_boas_order {};
+
+/*!
+\brief Writes the rtree into the output stream in the flat, pointer-free layout.
+
+The data written may be stored in a file and then accessed with
+<tt>boost::geometry::index::rtree_view</tt> directly from the memory the file
+is mapped to without deserialization. The nodes of each subtree are stored
+in one contiguous array, the children of a node are stored next to each other
+and the coordinates of their boxes are stored as a structure of arrays, e.g.
+all min x coordinates together, so the boxes of children are checked with
+a linear scan. The values are stored in the order of leafs. The data is stored
+in the native byte order so it can only be read on a platform with the same byte
+order and sizes of types.
+
+The Values are written byte by byte. Therefore they must be trivially copyable
+types, e.g. Points, Boxes and pairs of Boxes and integral ids. The types
+owning resources, e.g. containers or pointers, can't be stored.
+
+\par Example
+\verbatim
+bgi::rtree< value_t, bgi::rstar<16> > rt(values);
+std::ofstream ofs("tree.bin", std::ios::binary);
+bgi::write_flat(rt, ofs, bgi::van_emde_boas_order());
+\endverbatim
+
+\par Throws
+If the stream is configured to throw exceptions.
+If allocation throws.
+
+\param tree     The rtree.
+\param os       The output stream opened in binary mode.
+\param order    The order of nodes, level_order or van_emde_boas_order.
+
+\ingroup rtree_functions
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline void write_flat(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
+                       std::ostream & os,
+                       level_order const& /*order*/ = level_order())
+{
+    detail::rtree::flat::write(tree, os, detail::rtree::flat::level_node_order);
+}
+
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline void write_flat(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
+                       std::ostream & os,
+                       van_emde_boas_order const& /*order*/)
+{
+    detail::rtree::flat::write(tree, os, detail::rtree::flat::van_emde_boas_node_order);
+}
+
+/*!
+\brief Creates the rtree from the values and writes it into the output stream in the flat, pointer-free layout.
+
+The values are read from the range once and sorted with the external memory
+sort-based packing algorithm. The tree is created bottom-up and written directly
+into the stream. Only the boxes of internal nodes and a part of the values
+and boxes of leafs are stored in memory. Therefore the tree can be created from
+the values which don't fit in the memory, e.g. read from a file with input iterators.
+The nodes are stored in the level order. The data is the same as the data written
+by <tt>write_flat()</tt> for the rtree created with \c sort_packing using the same
+curve.
+
+The output stream has to be seekable, e.g. a file stream. The Values must be
+trivially copyable types.
+
+\par Example
+\verbatim
+bgi::external_hilbert_packing policy(16 * 1024 * 1024, "/data/tmp");
+std::ofstream ofs("tree.bin", std::ios::binary);
+bgi::write_flat(first, last, ofs, policy, bgi::rstar<16>());
+\endverbatim
+
+\par Throws
+If the stream is configured to throw exceptions.
+If allocation throws.
+If a temporary file can't be created, written or read.
+
+\param first        The beginning of the range of Values.
+\param last         The end of the range of Values.
+\param os           The output stream opened in binary mode.
+\param policy       The packing algorithm policy, e.g. \c external_hilbert_packing.
+\param parameters   The parameters object.
+\param getter       The function object extracting Indexable from Value.
+
+\ingroup rtree_functions
+*/
+template <typename Iterator, typename Curve, typename Parameters, typename IndexableGetter>
+inline void write_flat(Iterator first, Iterator last,
+                       std::ostream & os,
+                       index::external_sort_packing<Curve> const& policy,
+                       Parameters const& parameters,
+                       IndexableGetter const& getter)
+{
+    typedef typename std::iterator_traits<Iterator>::value_type value_type;
+    typedef typename rtree<value_type, Parameters, IndexableGetter>::bounds_type box_type;
+    typedef detail::translator<IndexableGetter, index::equal_to<value_type> > translator_type;
+
+    translator_type const translator(getter, index::equal_to<value_type>());
+
+    detail::rtree::external::external_sort<value_type, box_type>
+        sorted(first, last, translator, detail::get_strategy(parameters), policy);
+
+    detail::rtree::flat::write_sorted<value_type, box_type>(sorted, sorted.values_count(), os,
+                                                            parameters, translator,
+                                                            detail::get_strategy(parameters));
+}
+
+template <typename Iterator, typename Curve, typename Parameters>
+inline void write_flat(Iterator first, Iterator last,
+                       std::ostream & os,
+                       index::external_sort_packing<Curve> const& policy,
+                       Parameters const& parameters)
+{
+    typedef typename std::iterator_traits<Iterator>::value_type value_type;
+
+    write_flat(first, last, os, policy, parameters, index::indexable<value_type>());
+}
+
+/*!
+\brief The quantization of boxes in the flat layout.
+
+The boxes of nodes and values are stored as coordinates of the grid dividing
+the box of the parent node into 2^Bits - 1 parts in each dimension. The leafs
+store the ids of values of type Id instead of the values.
+
+\tparam Bits    The number of bits of a quantized coordinate, 8 or 16.
+\tparam Id      The unsigned integral type of ids of values.
+*/
+template <unsigned Bits, typename Id = boost::uint32_t>
+struct quantized
+{
+    BOOST_MPL_ASSERT_MSG((Bits == 8 || Bits == 16), INVALID_NUMBER_OF_BITS, (quantized));
+
+    typedef Id id_type;
+    static const unsigned bits = Bits;
+};
+
+/*!
+\brief Writes the rtree into the output stream in the flat, pointer-free layout with quantized boxes.
+
+The structure of the tree is the same as in the case of the flat layout written
+by the other overloads of <tt>write_flat()</tt>. The box of each node and each
+value is stored relative to the box of its parent, quantized to 8 or 16 bits
+per coordinate and rounded outward so the stored boxes always contain the original
+ones. The leafs store the ids of values returned by the function object instead of
+the values. The data is read with <tt>boost::geometry::index::quantized_rtree_view</tt>.
+
+For 2d boxes of doubles and 32-bit ids a value takes 12 bytes with 16-bit quantization
+and 8 bytes with 8-bit quantization instead of 40 bytes of \c std::pair of Box and id.
+Queries return the ids of candidates. The exact geometries should be checked for the
+candidates only.
+
+The coordinates of the Indexables must be floating point numbers.
+
+\par Example
+\verbatim
+bgi::rtree< std::pair<box_t, unsigned>, bgi::rstar<16> > rt(values);
+std::ofstream ofs("tree.bin", std::ios::binary);
+bgi::write_flat(rt, ofs, bgi::quantized<16>(), get_second());
+\endverbatim
+
+\par Throws
+If the stream is configured to throw exceptions.
+If allocation throws.
+
+\param tree     The rtree.
+\param os       The output stream opened in binary mode.
+\param q        The quantization, e.g. quantized<16>.
+\param get_id   The function object returning the id of a Value convertible to quantized::id_type.
+\param order    The order of nodes, level_order or van_emde_boas_order.
+
+\ingroup rtree_functions
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+          unsigned Bits, typename Id, typename IdGetter>
+inline void write_flat(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
+                       std::ostream & os,
+                       quantized<Bits, Id> const& /*q*/,
+                       IdGetter const& get_id,
+                       level_order const& /*order*/ = level_order())
+{
+    detail::rtree::flat::write_quantized<Id, Bits>(tree, os, detail::rtree::flat::level_node_order, get_id);
+}
+
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+          unsigned Bits, typename Id, typename IdGetter>
+inline void write_flat(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
+                       std::ostream & os,
+                       quantized<Bits, Id> const& /*q*/,
+                       IdGetter const& get_id,
+                       van_emde_boas_order const& /*order*/)
+{
+    detail::rtree::flat::write_quantized<Id, Bits>(tree, os, detail::rtree::flat::van_emde_boas_node_order, get_id);
+}
+
+/*!
+\brief The read-only view of the R-tree stored in the flat, pointer-free layout.
+
+The data created with <tt>boost::geometry::index::write_flat()</tt> is accessed
+in place, e.g. in a memory-mapped file. Nothing is allocated or copied during the
+construction of the view. Since there are no pointers in the data a file may be
+mapped at any address, it only has to be aligned to the alignment of the Value,
+coordinate and 64-bit integer types. Memory mapping functions return addresses aligned
+to a page.
+
+The view doesn't own the data. The data must exist as long as the view and the
+query iterators are used.
+
+The types Value, IndexableGetter and EqualTo should be the same as the ones used
+by the rtree which was written. Parameters are used only to define the strategy
+so they may be different. The sizes of Value and coordinates and the dimension are checked
+during the construction of the view. The nodes are not read during the construction so
+opening the view takes constant time. The data coming from an untrusted source should be
+checked with <tt>is_valid()</tt> before the view is queried.
+
+\par Example
+\verbatim
+typedef bgi::rtree_view< value_t, bgi::rstar<16> > view_t;
+bip::file_mapping file("tree.bin", bip::read_only);
+bip::mapped_region region(file, bip::read_only);
+view_t view(region.get_address(), region.get_size());
+view.query(bgi::intersects(box), std::back_inserter(result));
+\endverbatim
+
+\tparam Value           The type of objects stored in the container.
+\tparam Parameters      Parameters of the rtree.
+\tparam IndexableGetter The function object extracting Indexable from Value.
+\tparam EqualTo         The function object comparing objects of type Value.
+*/
+template
+<
+    typename Value,
+    typename Parameters,
+    typename IndexableGetter = index::indexable<Value>,
+    typename EqualTo = index::equal_to<Value>
+>
+class rtree_view
+{
+public:
+    /*! \brief The type of Value stored in the container. */
+    typedef Value value_type;
+    /*! \brief R-tree parameters type. */
+    typedef Parameters parameters_type;
+    /*! \brief The function object extracting Indexable from Value. */
+    typedef IndexableGetter indexable_getter;
+    /*! \brief The function object comparing objects of type Value. */
+    typedef EqualTo value_equal;
+
+    /*! \brief The Indexable type to which Value is translated. */
+    typedef typename index::detail::indexable_type<
+        detail::translator<IndexableGetter, EqualTo>
+    >::type indexable_type;
+
+    /*! \brief The Box type used by the R-tree. */
+    typedef geometry::model::box<
+                geometry::model::point<
+                    typename coordinate_type<indexable_type>::type,
+                    dimension<indexable_type>::value,
+                    typename coordinate_system<indexable_type>::type
+                >
+            >
+    bounds_type;
+
+    /*! \brief Unsigned integral type used by the container. */
+    typedef std::size_t size_type;
+
+    /*! \brief Type of const iterator of all values, category RandomAccessIterator. */
+    typedef Value const* const_iterator;
+
+private:
+    typedef detail::translator<IndexableGetter, EqualTo> translator_type;
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+    typedef detail::rtree::flat::storage<value_type, bounds_type> storage_type;
+    typedef detail::rtree::flat::iterator_types<value_type> iterator_types;
+
+public:
+    /*! \brief Type of const query iterator, category ForwardIterator. */
+    typedef index::detail::rtree::iterators::query_iterator
+        <
+            value_type, iterator_types
+        > const_query_iterator;
+
+    /*!
+    \brief The constructor of an empty view.
+
+    \par Throws
+    If IndexableGetter, EqualTo or Parameters copy constructor throws.
+    */
+    inline explicit rtree_view(parameters_type const& parameters = parameters_type(),
+                               indexable_getter const& getter = indexable_getter(),
+                               value_equal const& equal = value_equal())
+        : m_translator(getter, equal)
+        , m_parameters(parameters)
+        , m_strategy(index::detail::get_strategy(m_parameters))
+    {}
+
+    /*!
+    \brief The constructor of the view of the data.
+
+    \param data         The pointer to the data created with write_flat().
+    \param size         The size of the data in bytes.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+
+    Only the header of the data is checked, see is_valid().
+
+    \par Throws
+    \li If the data isn't properly aligned, is too small, has corrupted header or was created
+        for different types - std::invalid_argument.
+    \li If IndexableGetter, EqualTo or Parameters copy constructor throws.
+    */
+    inline rtree_view(void const* data, std::size_t size,
+                      parameters_type const& parameters = parameters_type(),
+                      indexable_getter const& getter = indexable_getter(),
+                      value_equal const& equal = value_equal())
+        : m_storage(data, size)
+        , m_translator(getter, equal)
+        , m_parameters(parameters)
+        , m_strategy(index::detail::get_strategy(m_parameters))
+    {}
+
+    /*!
+    \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
+
+    The predicates and the results are the same as in the case of
+    <tt>boost::geometry::index::rtree::query()</tt>.
+
+    \par Example
+    \verbatim
+    view.query(bgi::intersects(box), std::back_inserter(result));
+    view.query(bgi::nearest(pt, 5) && bgi::intersects(box), std::back_inserter(result));
+    \endverbatim
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If predicates copy throws.
+    If allocation throws.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it) const
+    {
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        static const bool is_distance_predicate = 0 < distance_predicates_count;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
+
+        return query_dispatch(predicates, out_it, boost::mpl::bool_<is_distance_predicate>());
+    }
+
+    /*!
+    \brief Returns a query iterator pointing at the begin of the query range.
+
+    The values are returned in the same order as by
+    <tt>boost::geometry::index::rtree::qbegin()</tt>.
+
+    \par Throws
+    If predicates copy throws.
+    If allocation throws.
+
+    \param predicates   Predicates.
+
+    \return             The iterator pointing at the begin of the query range.
+    */
+    template <typename Predicates>
+    const_query_iterator qbegin(Predicates const& predicates) const
+    {
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
+
+        typedef typename boost::mpl::if_c<
+            distance_predicates_count == 0,
+            detail::rtree::flat::spatial_query_iterator
+                <
+                    value_type, bounds_type, translator_type, strategy_type, Predicates
+                >,
+            detail::rtree::flat::distance_query_iterator
+                <
+                    value_type, bounds_type, translator_type, strategy_type, Predicates,
+                    detail::predicates_find_distance<Predicates>::value
+                >
+        >::type iterator_type;
+
+        return const_query_iterator(iterator_type(m_storage, m_translator, m_strategy, predicates));
+    }
+
+    /*!
+    \brief Returns a query iterator pointing at the end of the query range.
+
+    \par Throws
+    Nothing
+
+    \return             The iterator pointing at the end of the query range.
+    */
+    const_query_iterator qend() const
+    {
+        return const_query_iterator();
+    }
+
+    /*!
+    \brief Returns the iterator pointing at the begin of the values range.
+
+    The values are stored in the order of leafs.
+
+    \par Throws
+    Nothing
+    */
+    const_iterator begin() const
+    {
+        return m_storage.values();
+    }
+
+    /*!
+    \brief Returns the iterator pointing at the end of the values range.
+
+    \par Throws
+    Nothing
+    */
+    const_iterator end() const
+    {
+        return m_storage.values() + size();
+    }
+
+    /*!
+    \brief Returns the number of stored values.
+
+    \return         The number of stored values.
+
+    \par Throws
+    Nothing.
+    */
+    inline size_type size() const
+    {
+        return static_cast<size_type>(m_storage.values_count());
+    }
+
+    /*!
+    \brief Query if the container is empty.
+
+    \return         true if the container is empty.
+
+    \par Throws
+    Nothing.
+    */
+    inline bool empty() const
+    {
+        return 0 == m_storage.values_count();
+    }
+
+    /*!
+    \brief Returns the box able to contain all values stored in the container.
+
+    If the container is empty the result of \c geometry::assign_inverse() is returned.
+
+    \return     The box able to contain all values stored in the container or an invalid box if
+                there are no values in the container.
+
+    \par Throws
+    Nothing.
+    */
+    inline bounds_type bounds() const
+    {
+        if ( 0 < m_storage.nodes_count() )
+            return m_storage.box(0);
+
+        bounds_type result;
+        geometry::assign_inverse(result);
+        return result;
+    }
+
+    /*!
+    \brief Returns the depth of the tree, the number of levels below the root.
+
+    \par Throws
+    Nothing.
+    */
+    inline size_type depth() const
+    {
+        return static_cast<size_type>(m_storage.leafs_level());
+    }
+
+    /*!
+    \brief Checks if the nodes of the data are valid.
+
+    Checks if each node refers to existing nodes or values, if each node is referred
+    only once and if all leafs are on the same level. The complexity is linear in the
+    number of nodes and all nodes are read. If the data is not valid the queries may
+    read outside the data.
+
+    \return     true if the nodes are valid.
+
+    \par Throws
+    If the memory for the visited nodes can't be allocated - std::bad_alloc.
+    */
+    inline bool is_valid() const
+    {
+        return m_storage.are_nodes_valid();
+    }
+
+    /*!
+    \brief Returns parameters.
+
+    \return     The parameters object.
+    */
+    inline parameters_type parameters() const
+    {
+        return m_parameters;
+    }
+
+    /*!
+    \brief Returns function retrieving Indexable from Value.
+
+    \return     The indexable_getter object.
+    */
+    indexable_getter indexable_get() const
+    {
+        return m_translator;
+    }
+
+    /*!
+    \brief Returns function comparing Values
+
+    \return     The value_equal function.
+    */
+    value_equal value_eq() const
+    {
+        return m_translator;
+    }
+
+private:
+    template <typename Predicates, typename OutIter>
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<false> const& /*is_distance_predicate*/) const
+    {
+        detail::rtree::flat::spatial_query
+            <
+                value_type, bounds_type, translator_type, strategy_type, Predicates, OutIter
+            > find_v(m_storage, m_translator, m_strategy, predicates, out_it);
+
+        return static_cast<size_type>(find_v.apply());
+    }
+
+    template <typename Predicates, typename OutIter>
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<true> const& /*is_distance_predicate*/) const
+    {
+        static const unsigned distance_predicate_index = detail::predicates_find_distance<Predicates>::value;
+        detail::rtree::flat::distance_query
+            <
+                value_type, bounds_type, translator_type, strategy_type, Predicates,
+                distance_predicate_index, OutIter
+            > distance_v(m_storage, m_translator, m_strategy, predicates, out_it);
+
+        return static_cast<size_type>(distance_v.apply());
+    }
+
+    storage_type m_storage;
+    translator_type m_translator;
+    parameters_type m_parameters;
+    strategy_type m_strategy;
+};
+
+/*!
+\brief Returns a query iterator pointing at the begin of the query range.
+
+\ingroup rtree_functions
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo,
+          typename Predicates> inline
+typename rtree_view<Value, Parameters, IndexableGetter, EqualTo>::const_query_iterator
+qbegin(rtree_view<Value, Parameters, IndexableGetter, EqualTo> const& view,
+       Predicates const& predicates)
+{
+    return view.qbegin(predicates);
+}
+
+/*!
+\brief Returns a query iterator pointing at the end of the query range.
+
+\ingroup rtree_functions
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo> inline
+typename rtree_view<Value, Parameters, IndexableGetter, EqualTo>::const_query_iterator
+qend(rtree_view<Value, Parameters, IndexableGetter, EqualTo> const& view)
+{
+    return view.qend();
+}
+
+/*!
+\brief The read-only view of the R-tree stored in the flat layout with quantized boxes.
+
+The data created with <tt>boost::geometry::index::write_flat()</tt> with the
+\c quantized parameter is accessed in place, the same way as by <tt>rtree_view</tt>.
+The values of the view are the ids stored in the leafs.
+
+The predicates are checked with the quantized boxes which contain the Indexables.
+Therefore a query returns the ids of all values meeting the predicates and possibly
+some other ones, the candidates which should be checked with the exact geometries.
+This can be done with the \c satisfies() predicate called with the id which is
+checked after the spatial predicates passed before it. Only the predicates
+for which the enlarged box can't exclude a value may be passed: \c intersects(),
+<tt>! disjoint()</tt>, \c contains(), \c covers() and \c satisfies().
+The nearest predicate isn't supported.
+
+As in the case of <tt>rtree_view</tt> the nodes are not read during the construction,
+the data coming from an untrusted source should be checked with <tt>is_valid()</tt>.
+
+\par Example
+\verbatim
+typedef bgi::quantized_rtree_view< box_t, bgi::rstar<16>, bgi::quantized<16> > view_t;
+view_t view(region.get_address(), region.get_size());
+view.query(bgi::intersects(box) && bgi::satisfies(exact_intersects(box, geometries)),
+           std::back_inserter(ids));
+\endverbatim
+
+\tparam Indexable       The type of Indexables of the rtree which was written.
+\tparam Parameters      Parameters of the rtree.
+\tparam Quantization    The quantization, the same as the one used to write the data.
+*/
+template
+<
+    typename Indexable,
+    typename Parameters,
+    typename Quantization = index::quantized<16>
+>
+class quantized_rtree_view
+{
+public:
+    /*! \brief The type of ids stored in the container. */
+    typedef typename Quantization::id_type value_type;
+    /*! \brief R-tree parameters type. */
+    typedef Parameters parameters_type;
+
+    /*! \brief The Box type used by the R-tree. */
+    typedef geometry::model::box<
+                geometry::model::point<
+                    typename coordinate_type<Indexable>::type,
+                    dimension<Indexable>::value,
+                    typename coordinate_system<Indexable>::type
+                >
+            >
+    bounds_type;
+
+    /*! \brief Unsigned integral type used by the container. */
+    typedef std::size_t size_type;
+
+    /*! \brief Type of const iterator of all ids, category RandomAccessIterator. */
+    typedef value_type const* const_iterator;
+
+private:
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+    typedef detail::rtree::flat::quantized_storage
+        <
+            value_type, bounds_type, Quantization::bits
+        > storage_type;
+
+public:
+    /*!
+    \brief The constructor of an empty view.
+
+    \par Throws
+    If Parameters copy constructor throws.
+    */
+    inline explicit quantized_rtree_view(parameters_type const& parameters = parameters_type())
+        : m_parameters(parameters)
+        , m_strategy(index::detail::get_strategy(m_parameters))
+    {}
+
+    /*!
+    \brief The constructor of the view of the data.
+
+    \param data         The pointer to the data created with write_flat().
+    \param size         The size of the data in bytes.
+    \param parameters   The parameters object.
+
+    Only the header of the data is checked, see is_valid().
+
+    \par Throws
+    \li If the data isn't properly aligned, is too small, has corrupted header or was created
+        for different types or quantization - std::invalid_argument.
+    \li If Parameters copy constructor throws.
+    */
+    inline quantized_rtree_view(void const* data, std::size_t size,
+                                parameters_type const& parameters = parameters_type())
+        : m_storage(data, size)
+        , m_parameters(parameters)
+        , m_strategy(index::detail::get_strategy(m_parameters))
+    {}
+
+    /*!
+    \brief Finds the ids of values which may meet passed predicates.
+
+    \par Example
+    \verbatim
+    view.query(bgi::intersects(box), std::back_inserter(candidates));
+    \endverbatim
+
+    \par Throws
+    If predicates copy throws.
+    If the output iterator throws.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+    \return             The number of ids found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it) const
+    {
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count == 0), NEAREST_PREDICATE_CAN_NOT_BE_PASSED, (Predicates));
+        BOOST_MPL_ASSERT_MSG((detail::rtree::flat::is_conservative_predicate<Predicates>::value),
+                             PREDICATE_CAN_NOT_BE_CHECKED_WITH_QUANTIZED_BOXES, (Predicates));
+
+        detail::rtree::flat::quantized_spatial_query
+            <
+                value_type, bounds_type, Quantization::bits, strategy_type, Predicates, OutIter
+            > find_v(m_storage, m_strategy, predicates, out_it);
+
+        return static_cast<size_type>(find_v.apply());
+    }
+
+    /*!
+    \brief Returns the iterator pointing at the begin of the ids range.
+
+    The ids are stored in the order of leafs.
+
+    \par Throws
+    Nothing
+    */
+    const_iterator begin() const
+    {
+        return m_storage.ids();
+    }
+
+    /*!
+    \brief Returns the iterator pointing at the end of the ids range.
+
+    \par Throws
+    Nothing
+    */
+    const_iterator end() const
+    {
+        return m_storage.ids() + size();
+    }
+
+    /*!
+    \brief Returns the number of stored values.
+
+    \par Throws
+    Nothing.
+    */
+    inline size_type size() const
+    {
+        return static_cast<size_type>(m_storage.values_count());
+    }
+
+    /*!
+    \brief Query if the container is empty.
+
+    \par Throws
+    Nothing.
+    */
+    inline bool empty() const
+    {
+        return 0 == m_storage.values_count();
+    }
+
+    /*!
+    \brief Returns the box able to contain all values stored in the container.
+
+    The box of the root isn't quantized so it's the same as the box of the rtree.
+    If the container is empty the result of \c geometry::assign_inverse() is returned.
+
+    \par Throws
+    Nothing.
+    */
+    inline bounds_type bounds() const
+    {
+        if ( 0 < m_storage.nodes_count() )
+            return m_storage.root_box();
+
+        bounds_type result;
+        geometry::assign_inverse(result);
+        return result;
+    }
+
+    /*!
+    \brief Returns the depth of the tree, the number of levels below the root.
+
+    \par Throws
+    Nothing.
+    */
+    inline size_type depth() const
+    {
+        return static_cast<size_type>(m_storage.leafs_level());
+    }
+
+    /*!
+    \brief Checks if the nodes of the data are valid.
+
+    The same checks as in the case of <tt>rtree_view::is_valid()</tt> are done,
+    the complexity is linear in the number of nodes.
+
+    \return     true if the nodes are valid.
+
+    \par Throws
+    If the memory for the visited nodes can't be allocated - std::bad_alloc.
+    */
+    inline bool is_valid() const
+    {
+        return m_storage.are_nodes_valid();
+    }
+
+    /*!
+    \brief Returns parameters.
+
+    \return     The parameters object.
+    */
+    inline parameters_type parameters() const
+    {
+        return m_parameters;
+    }
+
+private:
+    storage_type m_storage;
+    parameters_type m_parameters;
+    strategy_type m_strategy;
+};
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_RTREE_VIEW_HPP
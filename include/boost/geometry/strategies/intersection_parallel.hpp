@@ -0,0 +1,88 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_INTERSECTION_PARALLEL_HPP
+#define BOOST_GEOMETRY_STRATEGIES_INTERSECTION_PARALLEL_HPP
+
+
+#include <cstddef>
+
+#include <boost/geometry/util/parallel.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace intersection
+{
+
+
+/*!
+\brief Intersection strategy calculating the turns of two geometries
+    using several threads
+\ingroup strategies
+\details The strategy wraps another intersection strategy and behaves exactly
+    like it except that the pairs of the monotonic sections of two geometries
+    are intersected by several threads. The turns are gathered in the same
+    order as by the wrapped strategy so the results of the algorithms are
+    the same. It may be passed into the algorithms using get_turns, e.g.
+    intersection(), union_(), difference(), sym_difference() and relate().
+    The threads are used only if the C++11 threads support is available.
+    It may be combined with the plane_sweep strategy in any order, e.g.
+    parallel<plane_sweep<cartesian_segments<> > >, then the pairs of sections
+    are found with the plane sweep and intersected by several threads.
+\tparam Strategy The wrapped intersection strategy, e.g. cartesian_segments<>
+
+\qbk{
+[heading Example]
+\verbatim
+typedef bg::strategy::intersection::cartesian_segments<> base_t;
+bg::strategy::intersection::parallel<base_t> strategy(4);
+bg::intersection(coastline, boundaries, result, strategy);
+\endverbatim
+}
+ */
+template <typename Strategy>
+class parallel
+    : public Strategy
+{
+public:
+    /*!
+    \brief The constructor.
+    \param threads The maximum number of threads used. Default: 0 - the number
+        of hardware threads.
+    \param strategy The wrapped strategy.
+     */
+    explicit parallel(std::size_t threads = 0,
+                      Strategy const& strategy = Strategy())
+        : Strategy(strategy)
+        , m_threads(geometry::detail::parallel::threads_count(threads))
+    {}
+
+    //! Returns the maximum number of threads used.
+    std::size_t threads() const
+    {
+        return m_threads;
+    }
+
+    //! Returns the wrapped strategy.
+    Strategy const& base() const
+    {
+        return *this;
+    }
+
+private:
+    std::size_t m_threads;
+};
+
+
+}} // namespace strategy::intersection
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_INTERSECTION_PARALLEL_HPP
@@ -0,0 +1,76 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_INTERSECTION_PLANE_SWEEP_HPP
+#define BOOST_GEOMETRY_STRATEGIES_INTERSECTION_PLANE_SWEEP_HPP
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace intersection
+{
+
+
+/*!
+\brief Intersection strategy finding the pairs of the monotonic sections
+    of the geometries with a plane sweep
+\ingroup strategies
+\details The strategy wraps another intersection strategy and behaves exactly
+    like it except that the pairs of potentially intersecting monotonic
+    sections are found by sweeping a line over the bounding boxes of the
+    sections instead of partitioning the space. The sweep line moves along
+    the second coordinate and in cartesian coordinate systems only
+    the sections close to each other in the first coordinate are compared.
+    The turns are the same as calculated with the wrapped strategy but they
+    may be generated in a different order and the operations of the turns
+    of a geometry with itself may be swapped. The sweep compares far fewer
+    pairs of sections for the geometries consisting of many small separated
+    parts, e.g. vectorized rasters, where the partition performs many box
+    overlap tests.
+    It may be passed into the algorithms using get_turns, e.g.
+    intersection(), union_(), difference(), sym_difference(), relate()
+    and is_valid(). It may be combined with the parallel strategy in any
+    order.
+\tparam Strategy The wrapped intersection strategy, e.g. cartesian_segments<>
+
+\qbk{
+[heading Example]
+\verbatim
+typedef bg::strategy::intersection::cartesian_segments<> base_t;
+bg::strategy::intersection::plane_sweep<base_t> strategy;
+bg::intersection(raster1, raster2, result, strategy);
+\endverbatim
+}
+ */
+template <typename Strategy>
+class plane_sweep
+    : public Strategy
+{
+public:
+    /*!
+    \brief The constructor.
+    \param strategy The wrapped strategy.
+     */
+    explicit plane_sweep(Strategy const& strategy = Strategy())
+        : Strategy(strategy)
+    {}
+
+    //! Returns the wrapped strategy.
+    Strategy const& base() const
+    {
+        return *this;
+    }
+};
+
+
+}} // namespace strategy::intersection
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_INTERSECTION_PLANE_SWEEP_HPP
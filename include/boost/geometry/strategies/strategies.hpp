@@ -36,6 +36,8 @@
 #include <boost/geometry/strategies/distance.hpp>
 #include <boost/geometry/strategies/envelope.hpp>
 #include <boost/geometry/strategies/intersection.hpp>
+#include <boost/geometry/strategies/intersection_parallel.hpp>
+#include <boost/geometry/strategies/intersection_plane_sweep.hpp>
 #include <boost/geometry/strategies/intersection_strategies.hpp> // for backward compatibility
 #include <boost/geometry/strategies/relate.hpp>
 #include <boost/geometry/strategies/side.hpp>
@@ -0,0 +1,348 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_UTIL_PARALLEL_HPP
+#define BOOST_GEOMETRY_UTIL_PARALLEL_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+
+#include <boost/config.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+// The threads are used only if C++11 <thread> is available and
+// BOOST_GEOMETRY_DISABLE_THREADS is not defined. Otherwise the tasks
+// are executed sequentially in the calling thread.
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) \
+ && !defined(BOOST_NO_CXX11_HDR_MUTEX) \
+ && !defined(BOOST_NO_CXX11_HDR_ATOMIC) \
+ && !defined(BOOST_NO_CXX11_HDR_EXCEPTION) \
+ && !defined(BOOST_GEOMETRY_DISABLE_THREADS)
+#define BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+#endif
+
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel
+{
+
+// The number of threads which can run concurrently or 1 if unknown
+inline std::size_t hardware_concurrency()
+{
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+    std::size_t const result = std::thread::hardware_concurrency();
+    return result > 0 ? result : 1;
+#else
+    return 1;
+#endif
+}
+
+// The number of threads which may be used, 0 means hardware concurrency
+inline std::size_t threads_count(std::size_t threads)
+{
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+    return threads > 0 ? threads : hardware_concurrency();
+#else
+    boost::ignore_unused(threads);
+    return 1;
+#endif
+}
+
+// Mutex locked only if threads are supported.
+class mutex
+{
+    mutex(mutex const&);
+    mutex & operator=(mutex const&);
+
+public:
+    mutex() {}
+
+    void lock()
+    {
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+        m_mutex.lock();
+#endif
+    }
+
+    void unlock()
+    {
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+        m_mutex.unlock();
+#endif
+    }
+
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+private:
+    std::mutex m_mutex;
+#endif
+};
+
+class scoped_lock
+{
+    scoped_lock(scoped_lock const&);
+    scoped_lock & operator=(scoped_lock const&);
+
+public:
+    explicit scoped_lock(mutex & m)
+        : m_mutex(m)
+    {
+        m_mutex.lock();
+    }
+
+    ~scoped_lock()
+    {
+        m_mutex.unlock();
+    }
+
+private:
+    mutex & m_mutex;
+};
+
+// Flag set by one thread and checked by the others without locking,
+// atomic only if threads are supported. Once set it stays set.
+class flag
+{
+    flag(flag const&);
+    flag & operator=(flag const&);
+
+public:
+    flag()
+        : m_value(false)
+    {}
+
+    void set()
+    {
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+        m_value.store(true, std::memory_order_release);
+#else
+        m_value = true;
+#endif
+    }
+
+    bool is_set() const
+    {
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+        return m_value.load(std::memory_order_acquire);
+#else
+        return m_value;
+#endif
+    }
+
+private:
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+    std::atomic<bool> m_value;
+#else
+    bool m_value;
+#endif
+};
+
+// Fork-join group of tasks.
+// Each task passed to run() is executed in a new thread and wait() joins
+// all of them. If a task throws, the first exception is rethrown by wait().
+// Without threads support the tasks are executed immediately by run().
+// The destructor joins the threads which weren't joined by wait().
+class task_group
+{
+    task_group(task_group const&);
+    task_group & operator=(task_group const&);
+
+public:
+    task_group() {}
+
+    ~task_group()
+    {
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+        join();
+#endif
+    }
+
+    template <typename Task>
+    void run(Task const& task)
+    {
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+        // the vector grows before the thread is started, if the allocation
+        // threw after that the joinable thread would be destroyed
+        m_threads.push_back(std::thread());
+        m_threads.back() = std::thread(task_wrapper<Task>(task, *this));
+#else
+        task();
+#endif
+    }
+
+    void wait()
+    {
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+        join();
+        if (m_exception)
+        {
+            std::exception_ptr e = m_exception;
+            m_exception = std::exception_ptr();
+            std::rethrow_exception(e);
+        }
+#endif
+    }
+
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+private:
+    template <typename Task>
+    struct task_wrapper
+    {
+        task_wrapper(Task const& t, task_group & g)
+            : task(t), group(&g)
+        {}
+
+        void operator()()
+        {
+            try
+            {
+                task();
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(group->m_mutex);
+                if (! group->m_exception)
+                {
+                    group->m_exception = std::current_exception();
+                }
+            }
+        }
+
+        Task task;
+        task_group * group;
+    };
+
+    void join()
+    {
+        for (std::size_t i = 0 ; i < m_threads.size() ; ++i)
+        {
+            if (m_threads[i].joinable())
+            {
+                m_threads[i].join();
+            }
+        }
+        m_threads.clear();
+    }
+
+    std::vector<std::thread> m_threads;
+    std::exception_ptr m_exception;
+    std::mutex m_mutex;
+#endif
+};
+
+template <typename Function>
+class for_each_index_data
+{
+    for_each_index_data(for_each_index_data const&);
+    for_each_index_data & operator=(for_each_index_data const&);
+
+public:
+    for_each_index_data(std::size_t c, Function const& f)
+        : count(c), function(f), next_index(0), interrupted(c)
+    {}
+
+    // Returns the next index or count if all of them were already taken
+    // or if the function returned false for a smaller index.
+    std::size_t take_index()
+    {
+        scoped_lock lock(mutex);
+        return next_index < interrupted ? next_index++ : count;
+    }
+
+    void interrupt(std::size_t i)
+    {
+        scoped_lock lock(mutex);
+        if (i < interrupted)
+        {
+            interrupted = i;
+        }
+    }
+
+    std::size_t const count;
+    Function const& function;
+
+    parallel::mutex mutex;
+    std::size_t next_index;
+    std::size_t interrupted;
+};
+
+template <typename Function>
+struct for_each_index_task
+{
+    explicit for_each_index_task(for_each_index_data<Function> & d)
+        : data(&d)
+    {}
+
+    void operator()() const
+    {
+        for (std::size_t i = data->take_index(); i < data->count; i = data->take_index())
+        {
+            if (! data->function(i))
+            {
+                data->interrupt(i);
+            }
+        }
+    }
+
+    for_each_index_data<Function> * data;
+};
+
+// Calls the function for the indexes in [0, count) using at most threads
+// threads including the calling one. The indexes are taken one by one in
+// increasing order so the threads are busy until all of them are taken.
+// If the function returns false the greater indexes are not taken anymore.
+// Returns the smallest index for which the function returned false or count.
+template <typename Function>
+inline std::size_t for_each_index(std::size_t count, std::size_t threads,
+                                  Function const& function)
+{
+    if (threads <= 1 || count <= 1)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (! function(i))
+            {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    for_each_index_data<Function> data(count, function);
+    {
+        std::size_t const threads_count = (std::min)(threads, count);
+        task_group tasks;
+        for (std::size_t t = 1; t < threads_count; ++t)
+        {
+            tasks.run(for_each_index_task<Function>(data));
+        }
+        for_each_index_task<Function> const task(data);
+        task();
+        tasks.wait();
+    }
+    return data.interrupted;
+}
+
+}} // namespace detail::parallel
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_UTIL_PARALLEL_HPP
@@ -342,6 +342,20 @@ int main()
             std::cout << time << " - query(nearest(P, " << neighbours_count << ")) " << nearest_queries_count << " found " << temp << '\n';
         }
 
+        {
+            clock_t::time_point start = clock_t::now();
+            size_t temp = 0;
+            for (size_t i = 0 ; i < nearest_queries_count ; ++i )
+            {
+                float x = coords[i].first + 100;
+                float y = coords[i].second + 100;
+                result.clear();
+                temp += t.query(bgi::nearest(P(x, y), neighbours_count), std::back_inserter(result), bgi::best_first());
+            }
+            dur_t time = clock_t::now() - start;
+            std::cout << time << " - query(nearest(P, " << neighbours_count << "), best_first) " << nearest_queries_count << " found " << temp << '\n';
+        }
+
 #ifdef BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL
         {
             clock_t::time_point start = clock_t::now();
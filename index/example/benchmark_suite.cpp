@@ -0,0 +1,1482 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// The benchmark of the rtree covering the matrix of the parameters:
+//   linear/quadratic/rstar/kmeans, static/dynamic parameters, packed/inserted,
+//   2d/3d, float/double, uniform/clustered/real-like data
+// and the operations:
+//   insert, pack, remove, spatial query, knn query, path query, iteration.
+// It also covers the features compared with the alternatives: arena
+// allocator, bulk insert, callback query, spatial join, optimize, packing
+// policies, flat rtree, parallel query, query statistics and remove_if.
+//
+// The data is generated with fixed seeds so the results are reproducible.
+// The results are printed in CSV (default) or in JSON in the format
+// compatible with the output of the Google Benchmark library.
+//
+// Usage:
+//   benchmark_suite [--values N] [--queries N] [--repetitions N]
+//                   [--filter SUBSTRING] [--format csv|json]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/join.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/index/rtree_view.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/random.hpp>
+
+namespace bg = boost::geometry;
+namespace bgi = bg::index;
+
+typedef boost::chrono::steady_clock real_clock_type;
+typedef boost::chrono::thread_clock cpu_clock_type;
+typedef boost::chrono::duration<double, boost::nano> duration_type;
+
+struct options
+{
+    options()
+        : values(100000), queries(10000), repetitions(3), json(false)
+    {}
+
+    size_t values;
+    size_t queries;
+    size_t repetitions;
+    std::string filter;
+    bool json;
+};
+
+// The time of a single repetition of the benchmark
+struct sample
+{
+    sample() : real_time(0), cpu_time(0) {}
+    double real_time;
+    double cpu_time;
+};
+
+struct less_real_time
+{
+    bool operator()(sample const& l, sample const& r) const { return l.real_time < r.real_time; }
+};
+
+// The results are reported per operation, i.e. iterations is the number
+// of inserted values, performed queries, etc. and the times are divided by it.
+class reporter
+{
+public:
+    explicit reporter(options const& opt)
+        : m_options(opt), m_count(0)
+    {
+        if ( m_options.json )
+        {
+            std::cout << "{\n"
+                      << "  \"context\": {\n"
+                      << "    \"values\": " << m_options.values << ",\n"
+                      << "    \"queries\": " << m_options.queries << ",\n"
+                      << "    \"repetitions\": " << m_options.repetitions << "\n"
+                      << "  },\n"
+                      << "  \"benchmarks\": [";
+        }
+        else
+        {
+            std::cout << "name,iterations,real_time,cpu_time,real_time_min,time_unit,results\n";
+        }
+    }
+
+    ~reporter()
+    {
+        if ( m_options.json )
+            std::cout << "\n  ]\n}\n";
+    }
+
+    // The median and the minimum of the repetitions are reported
+    void report(std::string const& name, size_t iterations, std::vector<sample> samples, size_t results)
+    {
+        std::sort(samples.begin(), samples.end(), less_real_time());
+        sample const& median = samples[samples.size() / 2];
+        double const div = iterations > 0 ? double(iterations) : 1.0;
+
+        if ( m_options.json )
+        {
+            std::cout << (m_count > 0 ? ",\n" : "\n")
+                      << "    {\n"
+                      << "      \"name\": \"" << name << "\",\n"
+                      << "      \"iterations\": " << iterations << ",\n"
+                      << "      \"real_time\": " << median.real_time / div << ",\n"
+                      << "      \"cpu_time\": " << median.cpu_time / div << ",\n"
+                      << "      \"real_time_min\": " << samples.front().real_time / div << ",\n"
+                      << "      \"time_unit\": \"ns\",\n"
+                      << "      \"results\": " << results << "\n"
+                      << "    }";
+        }
+        else
+        {
+            std::cout << name << ',' << iterations << ','
+                      << median.real_time / div << ',' << median.cpu_time / div << ','
+                      << samples.front().real_time / div << ",ns," << results << '\n';
+        }
+        std::cout.flush();
+        ++m_count;
+    }
+
+    bool enabled(std::string const& name) const
+    {
+        return m_options.filter.empty()
+            || name.find(m_options.filter) != std::string::npos;
+    }
+
+private:
+    options const& m_options;
+    size_t m_count;
+};
+
+class stopwatch
+{
+public:
+    stopwatch()
+        : m_real(real_clock_type::now()), m_cpu(cpu_clock_type::now())
+    {}
+
+    sample elapsed() const
+    {
+        sample result;
+        result.real_time = duration_type(real_clock_type::now() - m_real).count();
+        result.cpu_time = duration_type(cpu_clock_type::now() - m_cpu).count();
+        return result;
+    }
+
+private:
+    real_clock_type::time_point m_real;
+    cpu_clock_type::time_point m_cpu;
+};
+
+// Data generation
+
+enum distribution { uniform, clustered, real_like };
+
+inline const char* distribution_name(distribution d)
+{
+    return d == uniform ? "uniform" : d == clustered ? "clustered" : "real_like";
+}
+
+template <typename Box, std::size_t I = 0,
+          std::size_t N = bg::dimension<Box>::value>
+struct set_box
+{
+    static inline void apply(Box & b, double const* center, double const* half)
+    {
+        typedef typename bg::coordinate_type<Box>::type coord_t;
+        bg::set<bg::min_corner, I>(b, coord_t(center[I] - half[I]));
+        bg::set<bg::max_corner, I>(b, coord_t(center[I] + half[I]));
+        set_box<Box, I + 1, N>::apply(b, center, half);
+    }
+};
+
+template <typename Box, std::size_t N>
+struct set_box<Box, N, N>
+{
+    static inline void apply(Box &, double const*, double const*) {}
+};
+
+template <typename Point, std::size_t I = 0,
+          std::size_t N = bg::dimension<Point>::value>
+struct set_point
+{
+    static inline void apply(Point & p, double const* coords)
+    {
+        typedef typename bg::coordinate_type<Point>::type coord_t;
+        bg::set<I>(p, coord_t(coords[I]));
+        set_point<Point, I + 1, N>::apply(p, coords);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct set_point<Point, N, N>
+{
+    static inline void apply(Point &, double const*) {}
+};
+
+template <typename Point, std::size_t I = 0,
+          std::size_t N = bg::dimension<Point>::value>
+struct to_array
+{
+    static inline void apply(Point const& p, double * coords)
+    {
+        coords[I] = double(bg::get<I>(p));
+        to_array<Point, I + 1, N>::apply(p, coords);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct to_array<Point, N, N>
+{
+    static inline void apply(Point const&, double *) {}
+};
+
+// Generates the centers of the values or queries and the half-sizes of the values
+//   uniform   - uniformly distributed in [-1000, 1000]
+//   clustered - normally distributed around 100 centers
+//   real_like - along random walks ("roads") of various lengths with
+//               the log-normally distributed sizes
+class generator
+{
+public:
+    generator(distribution d, std::size_t dimension, unsigned seed)
+        : m_distribution(d), m_dimension(dimension), m_rng(seed)
+        , m_step(0), m_walk_length(0)
+    {
+        boost::uniform_real<double> range(-1000, 1000);
+        for ( size_t i = 0 ; i < 100 * m_dimension ; ++i )
+            m_clusters.push_back(range(m_rng));
+        m_position.resize(m_dimension);
+        m_direction.resize(m_dimension);
+    }
+
+    void next(double * center, double * half)
+    {
+        if ( m_distribution == uniform )
+        {
+            boost::uniform_real<double> range(-1000, 1000);
+            for ( size_t i = 0 ; i < m_dimension ; ++i )
+            {
+                center[i] = range(m_rng);
+                half[i] = 0.25;
+            }
+        }
+        else if ( m_distribution == clustered )
+        {
+            boost::uniform_int<size_t> cluster(0, 99);
+            boost::normal_distribution<double> spread(0, 20);
+            size_t const c = cluster(m_rng);
+            for ( size_t i = 0 ; i < m_dimension ; ++i )
+            {
+                center[i] = m_clusters[c * m_dimension + i] + spread(m_rng);
+                half[i] = 0.25;
+            }
+        }
+        else
+        {
+            if ( m_step == m_walk_length )
+            {
+                boost::uniform_real<double> range(-1000, 1000);
+                boost::uniform_int<size_t> length(1, 2000);
+                for ( size_t i = 0 ; i < m_dimension ; ++i )
+                    m_position[i] = range(m_rng);
+                m_walk_length = length(m_rng);
+                m_step = 0;
+            }
+
+            boost::normal_distribution<double> turn(0, 0.3);
+            boost::lognormal_distribution<double> size(0.5, 1.0);
+            for ( size_t i = 0 ; i < m_dimension ; ++i )
+            {
+                m_direction[i] = (std::max)(-1.0, (std::min)(1.0, m_direction[i] + turn(m_rng)));
+                m_position[i] += m_direction[i];
+                center[i] = m_position[i];
+                half[i] = (std::min)(size(m_rng), 50.0) / 2;
+            }
+            ++m_step;
+        }
+    }
+
+private:
+    distribution m_distribution;
+    size_t m_dimension;
+    boost::mt19937 m_rng;
+    std::vector<double> m_clusters;
+    std::vector<double> m_position;
+    std::vector<double> m_direction;
+    size_t m_step;
+    size_t m_walk_length;
+};
+
+template <typename Box>
+struct data
+{
+    typedef typename bg::point_type<Box>::type point_type;
+    typedef bg::model::segment<point_type> segment_type;
+    static const std::size_t dimension = bg::dimension<Box>::value;
+
+    data(distribution d, options const& opt)
+    {
+        double center[dimension];
+        double half[dimension];
+
+        generator values_gen(d, dimension, 1);
+        values.resize(opt.values);
+        for ( size_t i = 0 ; i < values.size() ; ++i )
+        {
+            values_gen.next(center, half);
+            set_box<Box>::apply(values[i], center, half);
+        }
+
+        // The size of the query boxes chosen so the uniform query returns
+        // approximately 100 values
+        double const query_half = 1000 * std::pow(100.0 / (std::max)(opt.values, size_t(100)),
+                                                  1.0 / dimension);
+
+        // The queries follow the distribution of the data, they're placed
+        // around the randomly chosen values
+        boost::mt19937 rng(2);
+        boost::uniform_int<size_t> index(0, values.empty() ? 0 : values.size() - 1);
+        boost::uniform_real<double> offset(-query_half, query_half);
+        spatial_queries.resize(opt.queries);
+        knn_queries.resize(opt.queries);
+        path_queries.resize(opt.queries);
+        for ( size_t i = 0 ; i < opt.queries ; ++i )
+        {
+            point_type c;
+            if ( ! values.empty() )
+                bg::centroid(values[index(rng)], c);
+            else
+                bg::assign_zero(c);
+            to_array<point_type>::apply(c, center);
+
+            // The path starts at the value
+            double end[dimension];
+            for ( size_t j = 0 ; j < dimension ; ++j )
+                end[j] = center[j] + (j == 0 ? 4 * query_half : query_half);
+            point_type p0, p1;
+            set_point<point_type>::apply(p0, center);
+            set_point<point_type>::apply(p1, end);
+
+            for ( size_t j = 0 ; j < dimension ; ++j )
+            {
+                center[j] += offset(rng);
+                half[j] = query_half;
+            }
+            set_box<Box>::apply(spatial_queries[i], center, half);
+            set_point<point_type>::apply(knn_queries[i], center);
+
+            path_queries[i] = segment_type(p0, p1);
+        }
+    }
+
+    std::vector<Box> values;
+    std::vector<Box> spatial_queries;
+    std::vector<point_type> knn_queries;
+    std::vector<segment_type> path_queries;
+};
+
+// Benchmarks
+
+// bgi::path() is available only if BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL is defined
+// which also enables the serialization requiring additional headers and library
+template <typename Segment>
+inline bgi::detail::predicates::path<Segment> path(Segment const& segment, unsigned k)
+{
+    return bgi::detail::predicates::path<Segment>(segment, k);
+}
+
+template <typename Rtree, typename Box, typename Params>
+void build(Rtree & t, std::vector<Box> const& values, Params const& params, bool packed)
+{
+    if ( packed )
+    {
+        Rtree tmp(values, params);
+        t = boost::move(tmp);
+    }
+    else
+    {
+        Rtree tmp(params);
+        for ( size_t i = 0 ; i < values.size() ; ++i )
+            tmp.insert(values[i]);
+        t = boost::move(tmp);
+    }
+}
+
+template <typename Box, typename Params>
+void benchmark_rtree(std::string const& prefix, Params const& params,
+                     data<Box> const& d, bool packed,
+                     options const& opt, reporter & rep)
+{
+    typedef bgi::rtree<Box, Params> rtree_type;
+
+    std::vector<Box> const& values = d.values;
+    std::vector<sample> samples;
+    std::vector<Box> result;
+    result.reserve(1000);
+
+    // Construction - insert or pack
+    std::string const build_name = prefix + (packed ? "/pack" : "/insert");
+    rtree_type t(params);
+    if ( rep.enabled(build_name) )
+    {
+        samples.clear();
+        for ( size_t r = 0 ; r < opt.repetitions ; ++r )
+        {
+            rtree_type tmp(params);
+            t = boost::move(tmp);
+            stopwatch sw;
+            build(t, values, params, packed);
+            samples.push_back(sw.elapsed());
+        }
+        rep.report(build_name, values.size(), samples, t.size());
+    }
+    else
+    {
+        build(t, values, params, packed);
+    }
+
+    std::string name = prefix + "/query_spatial";
+    if ( rep.enabled(name) )
+    {
+        size_t found = 0;
+        samples.clear();
+        for ( size_t r = 0 ; r < opt.repetitions ; ++r )
+        {
+            found = 0;
+            stopwatch sw;
+            for ( size_t i = 0 ; i < d.spatial_queries.size() ; ++i )
+            {
+                result.clear();
+                found += t.query(bgi::intersects(d.spatial_queries[i]), std::back_inserter(result));
+            }
+            samples.push_back(sw.elapsed());
+        }
+        rep.report(name, d.spatial_queries.size(), samples, found);
+    }
+
+    name = prefix + "/query_knn";
+    if ( rep.enabled(name) )
+    {
+        size_t found = 0;
+        samples.clear();
+        for ( size_t r = 0 ; r < opt.repetitions ; ++r )
+        {
+            found = 0;
+            stopwatch sw;
+            for ( size_t i = 0 ; i < d.knn_queries.size() ; ++i )
+            {
+                result.clear();
+                found += t.query(bgi::nearest(d.knn_queries[i], 10), std::back_inserter(result));
+            }
+            samples.push_back(sw.elapsed());
+        }
+        rep.report(name, d.knn_queries.size(), samples, found);
+    }
+
+    name = prefix + "/query_path";
+    if ( rep.enabled(name) )
+    {
+        size_t found = 0;
+        samples.clear();
+        for ( size_t r = 0 ; r < opt.repetitions ; ++r )
+        {
+            found = 0;
+            stopwatch sw;
+            for ( size_t i = 0 ; i < d.path_queries.size() ; ++i )
+            {
+                result.clear();
+                found += t.query(path(d.path_queries[i], 10), std::back_inserter(result));
+            }
+            samples.push_back(sw.elapsed());
+        }
+        rep.report(name, d.path_queries.size(), samples, found);
+    }
+
+    name = prefix + "/iterate";
+    if ( rep.enabled(name) )
+    {
+        size_t found = 0;
+        samples.clear();
+        for ( size_t r = 0 ; r < opt.repetitions ; ++r )
+        {
+            found = 0;
+            double sum = 0;
+            stopwatch sw;
+            for ( typename rtree_type::const_iterator it = t.begin() ; it != t.end() ; ++it )
+            {
+                sum += bg::get<bg::min_corner, 0>(*it);
+                ++found;
+            }
+            samples.push_back(sw.elapsed());
+            // prevent the loop from being optimized away
+            if ( sum == 0.123456789 )
+                std::cerr << sum;
+        }
+        rep.report(name, t.size(), samples, found);
+    }
+
+    // Every 10th value is removed from the copy of the tree
+    name = prefix + "/remove";
+    if ( rep.enabled(name) )
+    {
+        size_t removed = 0;
+        samples.clear();
+        for ( size_t r = 0 ; r < opt.repetitions ; ++r )
+        {
+            rtree_type tmp(t);
+            removed = 0;
+            stopwatch sw;
+            for ( size_t i = 0 ; i < values.size() ; i += 10 )
+                removed += tmp.remove(values[i]);
+            samples.push_back(sw.elapsed());
+        }
+        rep.report(name, (values.size() + 9) / 10, samples, removed);
+    }
+}
+
+inline std::string params_name(bgi::linear<16, 4> const&) { return "linear<16,4>/static"; }
+inline std::string params_name(bgi::quadratic<16, 4> const&) { return "quadratic<16,4>/static"; }
+inline std::string params_name(bgi::rstar<16, 4> const&) { return "rstar<16,4>/static"; }
+inline std::string params_name(bgi::kmeans<16, 4> const&) { return "kmeans<16,4>/static"; }
+inline std::string params_name(bgi::dynamic_linear const&) { return "linear<16,4>/dynamic"; }
+inline std::string params_name(bgi::dynamic_quadratic const&) { return "quadratic<16,4>/dynamic"; }
+inline std::string params_name(bgi::dynamic_rstar const&) { return "rstar<16,4>/dynamic"; }
+
+template <typename Box>
+struct dimension_coordinate_name
+{
+    static std::string apply()
+    {
+        std::string result = bg::dimension<Box>::value == 2 ? "2d/" : "3d/";
+        result += boost::is_same<typename bg::coordinate_type<Box>::type, float>::value
+                ? "float" : "double";
+        return result;
+    }
+};
+
+template <typename Box>
+class benchmark_box
+{
+public:
+    benchmark_box(options const& opt, reporter & rep)
+        : m_options(opt), m_reporter(rep)
+    {}
+
+    void apply()
+    {
+        distribution const distributions[3] = { uniform, clustered, real_like };
+        for ( int i = 0 ; i < 3 ; ++i )
+        {
+            std::string const suffix = dimension_coordinate_name<Box>::apply()
+                                     + '/' + distribution_name(distributions[i]);
+            if ( ! any_enabled(suffix) )
+                continue;
+
+            data<Box> const d(distributions[i], m_options);
+
+            apply(bgi::linear<16, 4>(), d, suffix);
+            apply(bgi::quadratic<16, 4>(), d, suffix);
+            apply(bgi::rstar<16, 4>(), d, suffix);
+            apply(bgi::kmeans<16, 4>(), d, suffix);
+            apply(bgi::dynamic_linear(16, 4), d, suffix);
+            apply(bgi::dynamic_quadratic(16, 4), d, suffix);
+            apply(bgi::dynamic_rstar(16, 4), d, suffix);
+        }
+    }
+
+private:
+    template <typename Params>
+    void apply(Params const& params, data<Box> const& d, std::string const& suffix)
+    {
+        for ( int packed = 1 ; packed >= 0 ; --packed )
+        {
+            std::string const prefix = "rtree/" + params_name(params)
+                                     + (packed ? "/packed/" : "/inserted/") + suffix;
+            benchmark_rtree(prefix, params, d, packed != 0, m_options, m_reporter);
+        }
+    }
+
+    // Checks if any of the benchmarks using the data may be enabled
+    // to avoid the generation of the data
+    bool any_enabled(std::string const& suffix) const
+    {
+        if ( m_options.filter.empty() )
+            return true;
+        char const* ops[7] = { "/pack", "/insert", "/query_spatial", "/query_knn",
+                               "/query_path", "/iterate", "/remove" };
+        char const* params[7] = { "linear<16,4>/static", "quadratic<16,4>/static", "rstar<16,4>/static",
+                                  "kmeans<16,4>/static",
+                                  "linear<16,4>/dynamic", "quadratic<16,4>/dynamic", "rstar<16,4>/dynamic" };
+        for ( int p = 0 ; p < 7 ; ++p )
+            for ( int b = 0 ; b < 2 ; ++b )
+                for ( int o = 0 ; o < 7 ; ++o )
+                    if ( m_reporter.enabled(std::string("rtree/") + params[p]
+                                            + (b ? "/packed/" : "/inserted/") + suffix + ops[o]) )
+                        return true;
+        return false;
+    }
+
+    options const& m_options;
+    reporter & m_reporter;
+};
+
+// Benchmarks of the features
+//
+// The values and the queries are the same as in the benchmarks of the rtree
+// for 2d/double/uniform data. The names of the benchmarks start with
+// "feature/" followed by the name of the feature and of the variant.
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> feature_point;
+typedef bg::model::box<feature_point> feature_box;
+typedef std::pair<feature_box, std::size_t> feature_value;
+typedef bgi::rtree<feature_value, bgi::rstar<16, 4> > feature_rtree;
+
+// Runs the benchmark opt.repetitions times and reports it. The Benchmark
+// implements prepare() called before each repetition and not measured
+// and apply() returning the number of results. If the benchmark is disabled
+// but its result is needed by the following ones it's run once.
+template <typename Benchmark>
+void run_benchmark(std::string const& name, size_t iterations, Benchmark & b,
+                   options const& opt, reporter & rep, bool result_needed = false)
+{
+    if ( ! rep.enabled(name) )
+    {
+        if ( result_needed )
+        {
+            b.prepare();
+            b.apply();
+        }
+        return;
+    }
+
+    std::vector<sample> samples;
+    size_t results = 0;
+    for ( size_t r = 0 ; r < opt.repetitions ; ++r )
+    {
+        b.prepare();
+        stopwatch sw;
+        results = b.apply();
+        samples.push_back(sw.elapsed());
+    }
+    rep.report(name, iterations, samples, results);
+}
+
+// Spatial queries writing the results with back_inserter,
+// the Index may be an rtree or an rtree_view
+template <typename Index, typename Value>
+struct spatial_queries
+{
+    spatial_queries(Index const& i, std::vector<feature_box> const& q)
+        : index(&i), queries(&q)
+    {
+        result.reserve(1000);
+    }
+
+    void prepare() {}
+
+    size_t apply()
+    {
+        size_t found = 0;
+        for ( size_t i = 0 ; i < queries->size() ; ++i )
+        {
+            result.clear();
+            found += index->query(bgi::intersects((*queries)[i]), std::back_inserter(result));
+        }
+        return found;
+    }
+
+    Index const* index;
+    std::vector<feature_box> const* queries;
+    std::vector<Value> result;
+};
+
+template <typename Value, typename Index>
+void run_spatial_queries(std::string const& name, Index const& index,
+                         std::vector<feature_box> const& queries,
+                         options const& opt, reporter & rep)
+{
+    spatial_queries<Index, Value> b(index, queries);
+    run_benchmark(name, queries.size(), b, opt, rep);
+}
+
+// Builds an rtree per tile and destroys it right away
+template <typename Create>
+struct build_tiles
+{
+    build_tiles(std::vector< std::vector<feature_value> > const& t, bool p, Create const& c)
+        : tiles(&t), pack(p), create(c)
+    {}
+
+    void prepare() {}
+
+    size_t apply()
+    {
+        size_t result = 0;
+        for ( size_t i = 0 ; i < tiles->size() ; ++i )
+        {
+            typename Create::rtree_type * rt = create((*tiles)[i], pack);
+            if ( ! pack )
+                rt->insert((*tiles)[i].begin(), (*tiles)[i].end());
+            result += rt->size();
+            delete rt;
+            create.release();
+        }
+        return result;
+    }
+
+    std::vector< std::vector<feature_value> > const* tiles;
+    bool pack;
+    Create create;
+};
+
+struct create_std
+{
+    typedef feature_rtree rtree_type;
+
+    rtree_type * operator()(std::vector<feature_value> const& values, bool pack) const
+    {
+        return pack ? new rtree_type(values) : new rtree_type();
+    }
+
+    void release() const {}
+};
+
+struct create_arena
+{
+    typedef bgi::rtree
+        <
+            feature_value, bgi::rstar<16, 4>,
+            bgi::indexable<feature_value>, bgi::equal_to<feature_value>,
+            bgi::arena_allocator<feature_value>
+        > rtree_type;
+
+    explicit create_arena(bgi::arena & a) : arena(&a) {}
+
+    rtree_type * operator()(std::vector<feature_value> const& values, bool pack) const
+    {
+        bgi::arena_allocator<feature_value> const allocator(*arena);
+        return pack ? new rtree_type(values, bgi::rstar<16, 4>(), bgi::indexable<feature_value>(),
+                                     bgi::equal_to<feature_value>(), allocator)
+                    : new rtree_type(bgi::rstar<16, 4>(), bgi::indexable<feature_value>(),
+                                     bgi::equal_to<feature_value>(), allocator);
+    }
+
+    void release() const { arena->reset(); }
+
+    bgi::arena * arena;
+};
+
+// Inserts the values into the copy of the rtree one by one
+// or with bulk_insert(level) if level > 0
+struct insert_values
+{
+    insert_values(feature_rtree const& o, std::vector<feature_value> const& v, size_t l)
+        : original(&o), values(&v), level(l)
+    {}
+
+    void prepare() { tree = *original; }
+
+    size_t apply()
+    {
+        if ( level > 0 )
+            tree.insert(*values, bgi::bulk_insert(level));
+        else
+            tree.insert(values->begin(), values->end());
+        return tree.size();
+    }
+
+    feature_rtree const* original;
+    std::vector<feature_value> const* values;
+    size_t level;
+    feature_rtree tree;
+};
+
+// Creates the rtree with the packing policy
+template <typename Policy>
+struct pack_values
+{
+    pack_values(std::vector<feature_value> const& v, Policy const& p)
+        : values(&v), policy(p)
+    {}
+
+    void prepare() { tree.clear(); }
+
+    size_t apply()
+    {
+        feature_rtree tmp(*values, policy);
+        tree = boost::move(tmp);
+        return tree.size();
+    }
+
+    std::vector<feature_value> const* values;
+    Policy policy;
+    feature_rtree tree;
+};
+
+// Counts the values found by the spatial queries with the callback
+struct count_values
+{
+    explicit count_values(size_t & c) : count(&c) {}
+    bool operator()(feature_value const&) const { ++*count; return true; }
+    size_t * count;
+};
+
+struct stop_at_first
+{
+    bool operator()(feature_value const&) const { return false; }
+};
+
+// The spatial queries performed in the way defined by Mode
+template <typename Mode>
+struct mode_queries
+{
+    mode_queries(feature_rtree const& t, std::vector<feature_box> const& q)
+        : tree(&t), queries(&q)
+    {}
+
+    void prepare() {}
+
+    size_t apply()
+    {
+        size_t found = 0;
+        for ( size_t i = 0 ; i < queries->size() ; ++i )
+            found += Mode::apply(*tree, (*queries)[i]);
+        return found;
+    }
+
+    feature_rtree const* tree;
+    std::vector<feature_box> const* queries;
+};
+
+struct count_qbegin
+{
+    static size_t apply(feature_rtree const& t, feature_box const& q)
+    {
+        size_t found = 0;
+        for ( feature_rtree::const_query_iterator it = t.qbegin(bgi::intersects(q)) ; it != t.qend() ; ++it )
+            ++found;
+        return found;
+    }
+};
+
+struct count_callback
+{
+    static size_t apply(feature_rtree const& t, feature_box const& q)
+    {
+        size_t found = 0;
+        t.query(bgi::intersects(q), bgi::callback(count_values(found)));
+        return found;
+    }
+};
+
+struct any_qbegin
+{
+    static size_t apply(feature_rtree const& t, feature_box const& q)
+    {
+        return t.qbegin(bgi::intersects(q)) != t.qend() ? 1 : 0;
+    }
+};
+
+struct any_callback
+{
+    static size_t apply(feature_rtree const& t, feature_box const& q)
+    {
+        return t.query(bgi::intersects(q), bgi::callback(stop_at_first())) > 0 ? 1 : 0;
+    }
+};
+
+// The spatial join compared with a query of the second rtree per value
+// of the first one, threads == 0 means querying
+struct join_rtrees
+{
+    join_rtrees(feature_rtree const& a, feature_rtree const& b, size_t t)
+        : tree_a(&a), tree_b(&b), threads(t)
+    {}
+
+    void prepare() { result.clear(); }
+
+    size_t apply()
+    {
+        if ( threads == 0 )
+        {
+            for ( feature_rtree::const_iterator it = tree_a->begin() ; it != tree_a->end() ; ++it )
+            {
+                query_result.clear();
+                tree_b->query(bgi::intersects(it->first), std::back_inserter(query_result));
+                for ( size_t i = 0 ; i < query_result.size() ; ++i )
+                    result.push_back(std::make_pair(*it, query_result[i]));
+            }
+        }
+        else if ( threads == 1 )
+        {
+            bgi::join(*tree_a, *tree_b, bgi::intersects(), std::back_inserter(result));
+        }
+        else
+        {
+            bgi::join(*tree_a, *tree_b, bgi::intersects(), std::back_inserter(result), bgi::parallel(threads));
+        }
+        return result.size();
+    }
+
+    feature_rtree const* tree_a;
+    feature_rtree const* tree_b;
+    size_t threads;
+    std::vector<feature_value> query_result;
+    std::vector< std::pair<feature_value, feature_value> > result;
+};
+
+// Optimizes the copy of the rtree
+template <typename Rtree>
+struct optimize_rtree
+{
+    explicit optimize_rtree(Rtree const& o) : original(&o) {}
+
+    void prepare() { tree = *original; }
+
+    size_t apply() { return tree.optimize(); }
+
+    Rtree const* original;
+    Rtree tree;
+};
+
+// The queries gathering the statistics, the number of visited nodes
+// is reported as the number of results
+template <typename Rtree>
+struct statistics_queries
+{
+    statistics_queries(Rtree const& t, std::vector<feature_box> const& s, std::vector<feature_point> const& k)
+        : tree(&t), spatial(&s), knn(&k)
+    {}
+
+    void prepare() {}
+
+    size_t apply()
+    {
+        bgi::query_statistics stats;
+        for ( size_t i = 0 ; i < spatial->size() ; ++i )
+        {
+            result.clear();
+            tree->query(bgi::intersects((*spatial)[i]), std::back_inserter(result), stats);
+        }
+        for ( size_t i = 0 ; i < knn->size() ; ++i )
+        {
+            result.clear();
+            tree->query(bgi::nearest((*knn)[i], 10), std::back_inserter(result), stats);
+        }
+        return stats.internal_nodes + stats.leaves;
+    }
+
+    Rtree const* tree;
+    std::vector<feature_box> const* spatial;
+    std::vector<feature_point> const* knn;
+    std::vector<typename Rtree::value_type> result;
+};
+
+// Spatial queries of the rtree using several threads
+struct parallel_queries
+{
+    parallel_queries(feature_rtree const& t, std::vector<feature_box> const& q, size_t th)
+        : tree(&t), queries(&q), threads(th)
+    {}
+
+    void prepare() {}
+
+    size_t apply()
+    {
+        size_t found = 0;
+        for ( size_t i = 0 ; i < queries->size() ; ++i )
+        {
+            result.clear();
+            found += tree->query(bgi::intersects((*queries)[i]), std::back_inserter(result), bgi::parallel(threads));
+        }
+        return found;
+    }
+
+    feature_rtree const* tree;
+    std::vector<feature_box> const* queries;
+    size_t threads;
+    std::vector<feature_value> result;
+};
+
+// e.g. the timestamp older than the threshold
+struct is_older
+{
+    explicit is_older(size_t t) : threshold(t) {}
+    bool operator()(feature_value const& v) const { return v.second < threshold; }
+    size_t threshold;
+};
+
+// Removes the values meeting the predicates from the copy of the rtree
+// with remove_if() or with query() and remove()
+template <typename Predicates>
+struct remove_values
+{
+    remove_values(feature_rtree const& o, Predicates const& p, bool q)
+        : original(&o), predicates(p), query(q)
+    {}
+
+    void prepare() { tree = *original; }
+
+    size_t apply()
+    {
+        if ( ! query )
+            return tree.remove_if(predicates);
+
+        result.clear();
+        tree.query(predicates, std::back_inserter(result));
+        return tree.remove(result);
+    }
+
+    feature_rtree const* original;
+    Predicates predicates;
+    bool query;
+    feature_rtree tree;
+    std::vector<feature_value> result;
+};
+
+// The flat rtree ids of the values
+struct get_id
+{
+    unsigned operator()(feature_value const& v) const { return static_cast<unsigned>(v.second); }
+};
+
+// The exact check of the candidates with the boxes stored outside of the index
+struct exact_intersects
+{
+    exact_intersects(std::vector<feature_value> const& v, feature_box const& b) : values(&v), box(b) {}
+    bool operator()(unsigned id) const { return bg::intersects((*values)[id].first, box); }
+    std::vector<feature_value> const* values;
+    feature_box box;
+};
+
+template <typename View>
+struct exact_queries
+{
+    exact_queries(View const& v, std::vector<feature_value> const& vals, std::vector<feature_box> const& q)
+        : view(&v), values(&vals), queries(&q)
+    {}
+
+    void prepare() {}
+
+    size_t apply()
+    {
+        size_t found = 0;
+        for ( size_t i = 0 ; i < queries->size() ; ++i )
+        {
+            result.clear();
+            found += view->query(bgi::intersects((*queries)[i])
+                              && bgi::satisfies(exact_intersects(*values, (*queries)[i])),
+                                 std::back_inserter(result));
+        }
+        return found;
+    }
+
+    View const* view;
+    std::vector<feature_value> const* values;
+    std::vector<feature_box> const* queries;
+    std::vector<unsigned> result;
+};
+
+// Writes the flat rtree into the aligned buffer
+template <typename Layout>
+std::vector<boost::uint64_t> write_flat(feature_rtree const& t, Layout const& layout, size_t & size)
+{
+    std::ostringstream oss;
+    bgi::write_flat(t, oss, layout, get_id());
+    std::string const str = oss.str();
+    std::vector<boost::uint64_t> buffer(str.size() / sizeof(boost::uint64_t) + 1);
+    std::memcpy(&buffer[0], str.data(), str.size());
+    size = str.size();
+    return buffer;
+}
+
+inline std::vector<boost::uint64_t> write_flat(feature_rtree const& t, size_t & size)
+{
+    std::ostringstream oss;
+    bgi::write_flat(t, oss);
+    std::string const str = oss.str();
+    std::vector<boost::uint64_t> buffer(str.size() / sizeof(boost::uint64_t) + 1);
+    std::memcpy(&buffer[0], str.data(), str.size());
+    size = str.size();
+    return buffer;
+}
+
+struct less_min_x
+{
+    bool operator()(feature_value const& l, feature_value const& r) const
+    {
+        return bg::get<bg::min_corner, 0>(l.first) < bg::get<bg::min_corner, 0>(r.first);
+    }
+};
+
+class benchmark_features
+{
+public:
+    benchmark_features(options const& opt, reporter & rep)
+        : m_options(opt), m_reporter(rep)
+    {}
+
+    void apply()
+    {
+        data<feature_box> const d(uniform, m_options);
+        m_queries = d.spatial_queries;
+        m_points = d.knn_queries;
+        m_values.resize(d.values.size());
+        for ( size_t i = 0 ; i < d.values.size() ; ++i )
+            m_values[i] = feature_value(d.values[i], i);
+
+        arena();
+        bulk_insert();
+        callback();
+        join();
+        optimize();
+        packing();
+        flat();
+        query_parallel();
+        query_statistics();
+        remove_if();
+    }
+
+private:
+    // Many small rtrees created and destroyed with the default allocator
+    // and the arena
+    void arena()
+    {
+        size_t const tile_size = 2000;
+        std::vector< std::vector<feature_value> > tiles((m_values.size() + tile_size - 1) / tile_size);
+        for ( size_t i = 0 ; i < m_values.size() ; ++i )
+            tiles[i / tile_size].push_back(m_values[i]);
+
+        for ( int p = 0 ; p < 2 ; ++p )
+        {
+            bool const pack = p == 1;
+            std::string const suffix = pack ? "/pack" : "/insert";
+            {
+                build_tiles<create_std> b(tiles, pack, create_std());
+                run_benchmark("feature/arena/std" + suffix, m_values.size(), b, m_options, m_reporter);
+            }
+            {
+                bgi::arena arena;
+                build_tiles<create_arena> b(tiles, pack, create_arena(arena));
+                run_benchmark("feature/arena/arena" + suffix, m_values.size(), b, m_options, m_reporter);
+            }
+        }
+    }
+
+    // 10% of the values inserted into the rtree created from 90% of them
+    void bulk_insert()
+    {
+        char const* const names[] = { "insert", "bulk_insert(1)", "bulk_insert(2)", "bulk_insert(3)" };
+        char const* const suffixes[] = { "insert", "insert/query_spatial",
+                                         "bulk_insert(1)", "bulk_insert(1)/query_spatial",
+                                         "bulk_insert(2)", "bulk_insert(2)/query_spatial",
+                                         "bulk_insert(3)", "bulk_insert(3)/query_spatial" };
+        if ( ! any_enabled("feature/bulk_insert/", suffixes) )
+            return;
+
+        size_t const count = m_values.size() - m_values.size() / 10;
+        std::vector<feature_value> const old_values(m_values.begin(), m_values.begin() + count);
+        std::vector<feature_value> const new_values(m_values.begin() + count, m_values.end());
+        feature_rtree const original(old_values);
+
+        for ( size_t level = 0 ; level <= 3 ; ++level )
+        {
+            std::string const prefix = std::string("feature/bulk_insert/") + names[level];
+            std::string const query_name = prefix + "/query_spatial";
+            insert_values b(original, new_values, level);
+            run_benchmark(prefix, new_values.size(), b, m_options, m_reporter,
+                          m_reporter.enabled(query_name));
+            run_spatial_queries<feature_value>(query_name, b.tree, m_queries, m_options, m_reporter);
+        }
+    }
+
+    void callback()
+    {
+        char const* const suffixes[] = { "count/back_inserter", "count/qbegin", "count/callback",
+                                         "any/qbegin", "any/callback" };
+        if ( ! any_enabled("feature/callback/", suffixes) )
+            return;
+
+        feature_rtree const t(m_values);
+        run_spatial_queries<feature_value>("feature/callback/count/back_inserter", t, m_queries, m_options, m_reporter);
+        run_queries<count_qbegin>("feature/callback/count/qbegin", t);
+        run_queries<count_callback>("feature/callback/count/callback", t);
+        run_queries<any_qbegin>("feature/callback/any/qbegin", t);
+        run_queries<any_callback>("feature/callback/any/callback", t);
+    }
+
+    // The rtree of the values joined with the rtree of the query boxes
+    void join()
+    {
+        char const* const suffixes[] = { "queries", "join", "join/2", "join/4", "join/8" };
+        if ( ! any_enabled("feature/join/", suffixes) )
+            return;
+
+        std::vector<feature_value> boxes(m_queries.size());
+        for ( size_t i = 0 ; i < m_queries.size() ; ++i )
+            boxes[i] = feature_value(m_queries[i], i);
+
+        feature_rtree const tree_a(boxes);
+        feature_rtree const tree_b(m_values);
+        for ( size_t threads = 0 ; threads <= 8 ; threads = (std::max)(threads * 2, threads + 1) )
+        {
+            std::string const name = threads == 0 ? "feature/join/queries"
+                                   : threads == 1 ? "feature/join/join"
+                                   : "feature/join/join/" + boost::lexical_cast<std::string>(threads);
+            join_rtrees b(tree_a, tree_b, threads);
+            run_benchmark(name, boxes.size(), b, m_options, m_reporter);
+        }
+    }
+
+    // The values are inserted sorted by the x coordinate and then half of them is removed
+    void optimize()
+    {
+        char const* const suffixes[] = { "linear<16,4>/degraded/query_spatial", "linear<16,4>/optimize",
+                                         "linear<16,4>/optimized/query_spatial",
+                                         "quadratic<16,4>/degraded/query_spatial", "quadratic<16,4>/optimize",
+                                         "quadratic<16,4>/optimized/query_spatial",
+                                         "rstar<16,4>/degraded/query_spatial", "rstar<16,4>/optimize",
+                                         "rstar<16,4>/optimized/query_spatial" };
+        if ( ! any_enabled("feature/optimize/", suffixes) )
+            return;
+
+        std::vector<feature_value> values(m_values);
+        std::sort(values.begin(), values.end(), less_min_x());
+
+        optimize(bgi::rtree<feature_value, bgi::linear<16, 4> >(), "linear<16,4>", values);
+        optimize(bgi::rtree<feature_value, bgi::quadratic<16, 4> >(), "quadratic<16,4>", values);
+        optimize(bgi::rtree<feature_value, bgi::rstar<16, 4> >(), "rstar<16,4>", values);
+    }
+
+    template <typename Rtree>
+    void optimize(Rtree const& empty, std::string const& params, std::vector<feature_value> const& values)
+    {
+        std::string const prefix = "feature/optimize/" + params;
+        std::string const query_name = prefix + "/optimized/query_spatial";
+
+        Rtree degraded(empty);
+        degraded.insert(values.begin(), values.end());
+        for ( size_t i = 0 ; i < values.size() ; i += 2 )
+            degraded.remove(values[i]);
+
+        run_spatial_queries<feature_value>(prefix + "/degraded/query_spatial", degraded, m_queries, m_options, m_reporter);
+
+        optimize_rtree<Rtree> b(degraded);
+        run_benchmark(prefix + "/optimize", degraded.size(), b, m_options, m_reporter,
+                      m_reporter.enabled(query_name));
+        run_spatial_queries<feature_value>(query_name, b.tree, m_queries, m_options, m_reporter);
+    }
+
+    void packing()
+    {
+        pack("default", bgi::parallel(1));
+        pack("default/4", bgi::parallel(4));
+        pack("hilbert", bgi::hilbert_packing());
+        pack("hilbert/4", bgi::hilbert_packing(bgi::parallel(4)));
+        pack("morton", bgi::morton_packing());
+        pack("morton/4", bgi::morton_packing(bgi::parallel(4)));
+        // at most 1/8 of values in memory
+        pack("external_hilbert", bgi::external_hilbert_packing((std::max)(m_values.size() / 8, size_t(1))));
+    }
+
+    template <typename Policy>
+    void pack(std::string const& policy_name, Policy const& policy)
+    {
+        std::string const prefix = "feature/packing/" + policy_name;
+        std::string const query_name = prefix + "/query_spatial";
+        pack_values<Policy> b(m_values, policy);
+        run_benchmark(prefix + "/pack", m_values.size(), b, m_options, m_reporter,
+                      m_reporter.enabled(query_name));
+        run_spatial_queries<feature_value>(query_name, b.tree, m_queries, m_options, m_reporter);
+    }
+
+    // The queries of the flat rtree, with the full precision boxes or
+    // with the quantized boxes returning the candidates, optionally
+    // checked exactly with the boxes stored outside of the index
+    void flat()
+    {
+        char const* const suffixes[] = { "full/query_spatial",
+                                         "quantized<8>/candidates", "quantized<8>/exact",
+                                         "quantized<16>/candidates", "quantized<16>/exact" };
+        if ( ! any_enabled("feature/flat/", suffixes) )
+            return;
+
+        feature_rtree const t(m_values);
+        size_t size = 0;
+
+        {
+            std::vector<boost::uint64_t> const buffer = write_flat(t, size);
+            bgi::rtree_view<feature_value, bgi::rstar<16, 4> > const view(&buffer[0], size);
+            run_spatial_queries<feature_value>("feature/flat/full/query_spatial", view, m_queries, m_options, m_reporter);
+        }
+
+        flat_quantized<8>(t, "feature/flat/quantized<8>");
+        flat_quantized<16>(t, "feature/flat/quantized<16>");
+    }
+
+    template <std::size_t Bits>
+    void flat_quantized(feature_rtree const& t, std::string const& prefix)
+    {
+        typedef bgi::quantized_rtree_view<feature_box, bgi::rstar<16, 4>, bgi::quantized<Bits> > view_type;
+
+        size_t size = 0;
+        std::vector<boost::uint64_t> const buffer = write_flat(t, bgi::quantized<Bits>(), size);
+        view_type const view(&buffer[0], size);
+        run_spatial_queries<unsigned>(prefix + "/candidates", view, m_queries, m_options, m_reporter);
+
+        exact_queries<view_type> b(view, m_values, m_queries);
+        run_benchmark(prefix + "/exact", m_queries.size(), b, m_options, m_reporter);
+    }
+
+    // Big regions containing many values
+    void query_parallel()
+    {
+        char const* const suffixes[] = { "1", "2", "4", "8" };
+        if ( ! any_enabled("feature/query_parallel/", suffixes) )
+            return;
+
+        std::vector<feature_box> queries;
+        for ( size_t i = 0 ; i < m_points.size() && i < 20 ; ++i )
+        {
+            double const x = bg::get<0>(m_points[i]);
+            double const y = bg::get<1>(m_points[i]);
+            queries.push_back(feature_box(feature_point(x - 500, y - 500), feature_point(x + 500, y + 500)));
+        }
+
+        feature_rtree const t(m_values);
+        for ( size_t threads = 1 ; threads <= 8 ; threads *= 2 )
+        {
+            parallel_queries b(t, queries, threads);
+            run_benchmark("feature/query_parallel/" + boost::lexical_cast<std::string>(threads),
+                          queries.size(), b, m_options, m_reporter);
+        }
+    }
+
+    void query_statistics()
+    {
+        char const* const suffixes[] = { "inserted/query_spatial", "inserted/query_with_statistics",
+                                         "packed/query_spatial", "packed/query_with_statistics" };
+        if ( ! any_enabled("feature/query_statistics/", suffixes) )
+            return;
+
+        bgi::rtree<feature_value, bgi::rstar<16, 4> > inserted;
+        inserted.insert(m_values.begin(), m_values.end());
+        query_statistics(inserted, "feature/query_statistics/inserted");
+
+        feature_rtree const packed(m_values);
+        query_statistics(packed, "feature/query_statistics/packed");
+    }
+
+    template <typename Rtree>
+    void query_statistics(Rtree const& t, std::string const& prefix)
+    {
+        run_spatial_queries<feature_value>(prefix + "/query_spatial", t, m_queries, m_options, m_reporter);
+        statistics_queries<Rtree> b(t, m_queries, m_points);
+        run_benchmark(prefix + "/query_with_statistics", m_queries.size() + m_points.size(),
+                      b, m_options, m_reporter);
+    }
+
+    // 10% of the area, half of the values in this area are older
+    void remove_if()
+    {
+        char const* const suffixes[] = { "older/remove_if", "older/query_and_remove",
+                                         "region/remove_if", "region/query_and_remove" };
+        if ( ! any_enabled("feature/remove_if/", suffixes) )
+            return;
+
+        feature_rtree const original(m_values);
+        feature_box const region(feature_point(-1000, -1000), feature_point(-1000 + 2000 * 0.1, 1000));
+        is_older const older(m_values.size() / 2);
+
+        remove(original, bgi::intersects(region) && bgi::satisfies(older), "feature/remove_if/older");
+        remove(original, bgi::intersects(region), "feature/remove_if/region");
+    }
+
+    template <typename Predicates>
+    void remove(feature_rtree const& original, Predicates const& predicates, std::string const& prefix)
+    {
+        for ( int q = 0 ; q < 2 ; ++q )
+        {
+            remove_values<Predicates> b(original, predicates, q == 1);
+            run_benchmark(prefix + (q == 1 ? "/query_and_remove" : "/remove_if"),
+                          1, b, m_options, m_reporter);
+        }
+    }
+
+    // Checks if any of the benchmarks of the feature may be enabled
+    // to avoid the creation of the rtrees
+    template <std::size_t N>
+    bool any_enabled(std::string const& prefix, char const* const (&suffixes)[N]) const
+    {
+        for ( std::size_t i = 0 ; i < N ; ++i )
+            if ( m_reporter.enabled(prefix + suffixes[i]) )
+                return true;
+        return false;
+    }
+
+    template <typename Mode>
+    void run_queries(std::string const& name, feature_rtree const& t)
+    {
+        mode_queries<Mode> b(t, m_queries);
+        run_benchmark(name, m_queries.size(), b, m_options, m_reporter);
+    }
+
+    options const& m_options;
+    reporter & m_reporter;
+    std::vector<feature_value> m_values;
+    std::vector<feature_box> m_queries;
+    std::vector<feature_point> m_points;
+};
+
+bool parse_options(int argc, char** argv, options & opt)
+{
+    for ( int i = 1 ; i < argc ; ++i )
+    {
+        std::string const arg = argv[i];
+        if ( i + 1 >= argc )
+            return false;
+        std::string const val = argv[++i];
+
+        if ( arg == "--values" )
+            opt.values = std::strtoul(val.c_str(), NULL, 10);
+        else if ( arg == "--queries" )
+            opt.queries = std::strtoul(val.c_str(), NULL, 10);
+        else if ( arg == "--repetitions" )
+            opt.repetitions = (std::max)(size_t(std::strtoul(val.c_str(), NULL, 10)), size_t(1));
+        else if ( arg == "--filter" )
+            opt.filter = val;
+        else if ( arg == "--format" && (val == "csv" || val == "json") )
+            opt.json = val == "json";
+        else
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    options opt;
+    if ( ! parse_options(argc, argv, opt) )
+    {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--values N] [--queries N] [--repetitions N]"
+                     " [--filter SUBSTRING] [--format csv|json]\n";
+        return 1;
+    }
+
+    typedef bg::model::point<float, 2, bg::cs::cartesian> P2f;
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P2d;
+    typedef bg::model::point<float, 3, bg::cs::cartesian> P3f;
+    typedef bg::model::point<double, 3, bg::cs::cartesian> P3d;
+
+    reporter rep(opt);
+
+    benchmark_box< bg::model::box<P2f> >(opt, rep).apply();
+    benchmark_box< bg::model::box<P2d> >(opt, rep).apply();
+    benchmark_box< bg::model::box<P3f> >(opt, rep).apply();
+    benchmark_box< bg::model::box<P3d> >(opt, rep).apply();
+    benchmark_features(opt, rep).apply();
+
+    return 0;
+}
@@ -0,0 +1,199 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <boost/geometry/index/arena_allocator.hpp>
+
+// Counts the living objects in order to check if they're destroyed.
+struct counted
+{
+    counted() { ++count; }
+    counted(counted const&) { ++count; }
+    ~counted() { --count; }
+    counted & operator=(counted const&) { return *this; }
+    bool operator==(counted const&) const { return true; }
+
+    static int count;
+};
+
+int counted::count = 0;
+
+void test_arena()
+{
+    bgi::arena arena(256);
+
+    // alignment
+    for ( std::size_t i = 1 ; i < 100 ; ++i )
+    {
+        char * c = static_cast<char*>(arena.allocate(1, 1));
+        BOOST_CHECK(c != 0);
+        void * d = arena.allocate(i, 8);
+        BOOST_CHECK(reinterpret_cast<std::size_t>(d) % 8 == 0);
+        void * e = arena.allocate(3, 64);
+        BOOST_CHECK(reinterpret_cast<std::size_t>(e) % 64 == 0);
+    }
+
+    // bigger than the slab
+    char * big = static_cast<char*>(arena.allocate(10000, 16));
+    std::fill(big, big + 10000, 'x');
+    BOOST_CHECK(reinterpret_cast<std::size_t>(big) % 16 == 0);
+
+    // the biggest slab is kept and reused
+    arena.reset();
+    char * reused = static_cast<char*>(arena.allocate(10000, 16));
+    BOOST_CHECK(reused == big);
+    arena.reset();
+    arena.reset();
+
+    arena.release();
+    arena.release();
+
+    // the allocators referring to the same arena are equal
+    bgi::arena arena2;
+    bgi::arena_allocator<int> a1(arena);
+    bgi::arena_allocator<double> a2(arena);
+    bgi::arena_allocator<int> a3(arena2);
+    BOOST_CHECK(a1 == a2);
+    BOOST_CHECK(a1 != a3);
+    BOOST_CHECK(bgi::arena_allocator<double>(a1) == a2);
+}
+
+template <typename Value, typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+    typedef bgi::rtree
+        <
+            Value, Params, bgi::indexable<Value>, bgi::equal_to<Value>, bgi::arena_allocator<Value>
+        > arena_rtree_t;
+    typedef typename rtree_t::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    std::vector<Value> values;
+    generate::values(values, 1000);
+
+    box_t const qbox(generate::value<point_t>::apply(10, 10), generate::value<point_t>::apply(40, 30));
+
+    rtree_t const expected(values, params);
+
+    bgi::arena arena(1024);
+    bgi::arena_allocator<Value> const allocator(arena);
+
+    for ( int i = 0 ; i < 2 ; ++i )
+    {
+        // packed
+        {
+            arena_rtree_t rt(values, params, bgi::indexable<Value>(), bgi::equal_to<Value>(), allocator);
+            BOOST_CHECK(rt.get_allocator() == allocator);
+            BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+            basictest::exactly_the_same_outputs(rt, rt, expected);
+
+            std::vector<Value> output, expected_output;
+            rt.query(bgi::intersects(qbox), std::back_inserter(output));
+            expected.query(bgi::intersects(qbox), std::back_inserter(expected_output));
+            basictest::exactly_the_same_outputs(rt, output, expected_output);
+
+            rt.clear();
+            BOOST_CHECK(rt.empty());
+            rt.insert(values.begin(), values.end());
+            BOOST_CHECK(rt.size() == values.size());
+        }
+
+        // inserted and removed
+        {
+            arena_rtree_t rt(params, bgi::indexable<Value>(), bgi::equal_to<Value>(), allocator);
+            rt.insert(values.begin(), values.end());
+            BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+            BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+            BOOST_CHECK(rt.remove(values.begin(), values.begin() + values.size() / 2) == values.size() / 2);
+            BOOST_CHECK(rt.size() == values.size() - values.size() / 2);
+            BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+
+            arena_rtree_t copy(rt);
+            BOOST_CHECK(copy.get_allocator() == allocator);
+            basictest::exactly_the_same_outputs(rt, copy, rt);
+        }
+
+        // sort-based packing, the values are sorted by several threads
+        // but the nodes are created in the arena by one thread
+        {
+            arena_rtree_t rt(values, bgi::hilbert_packing(), params,
+                             bgi::indexable<Value>(), bgi::equal_to<Value>(), allocator);
+            BOOST_CHECK(rt.size() == values.size());
+            BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+
+            arena_rtree_t prt(values, bgi::hilbert_packing(bgi::parallel(2)), params,
+                              bgi::indexable<Value>(), bgi::equal_to<Value>(), allocator);
+            BOOST_CHECK(prt.size() == values.size());
+            BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(prt));
+            basictest::exactly_the_same_outputs(rt, prt, rt);
+        }
+
+        // the memory is reused
+        if ( i == 0 )
+            arena.reset();
+        else
+            arena.release();
+    }
+}
+
+template <typename Params>
+void test_non_trivial_value(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef std::pair<point_t, counted> value_t;
+    typedef bgi::rtree
+        <
+            value_t, Params, bgi::indexable<value_t>, bgi::equal_to<value_t>, bgi::arena_allocator<value_t>
+        > rtree_t;
+
+    bgi::arena arena;
+    {
+        rtree_t rt(params, bgi::indexable<value_t>(), bgi::equal_to<value_t>(),
+                   bgi::arena_allocator<value_t>(arena));
+        for ( int i = 0 ; i < 300 ; ++i )
+            rt.insert(value_t(point_t(i % 17, i % 19), counted()));
+        BOOST_CHECK(counted::count == 300);
+
+        rt.clear();
+        BOOST_CHECK(counted::count == 0);
+
+        for ( int i = 0 ; i < 100 ; ++i )
+            rt.insert(value_t(point_t(i % 17, i % 19), counted()));
+        BOOST_CHECK(counted::count == 100);
+    }
+    // the Values are destroyed even if the nodes are allocated in the arena
+    BOOST_CHECK(counted::count == 0);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    test_arena();
+
+    test_rtree<point_t, bgi::linear<4, 2> >();
+    test_rtree<box_t, bgi::quadratic<8, 3> >();
+    test_rtree<std::pair<point_t, int>, bgi::rstar<16, 4> >();
+    test_rtree<point_t>(bgi::dynamic_rstar(5, 2));
+    test_rtree<box_t>(bgi::dynamic_linear(16, 4));
+
+    test_non_trivial_value< bgi::rstar<4> >();
+    test_non_trivial_value(bgi::dynamic_quadratic(8, 2));
+
+    // the generic tests of the rtree using the arena
+    bgi::arena arena;
+    testset::modifiers<point_t>(bgi::rstar<8, 3>(), bgi::arena_allocator<int>(arena));
+    testset::queries<box_t>(bgi::quadratic<6, 2>(), bgi::arena_allocator<int>(arena));
+    testset::additional<point_t>(bgi::dynamic_linear(4, 2), bgi::arena_allocator<int>(arena));
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+template <typename Rtree, typename Value>
+void check_tree(Rtree const& rt, std::vector<Value> const& values)
+{
+    typedef typename Rtree::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    BOOST_CHECK(rt.size() == values.size());
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt));
+
+    // the same values as in the tree created from all of them
+    Rtree const expected(values, rt.parameters());
+    std::vector<Value> output, expected_output;
+    rt.query(bgi::intersects(rt.bounds()), std::back_inserter(output));
+    expected.query(bgi::intersects(expected.bounds()), std::back_inserter(expected_output));
+    basictest::compare_outputs(rt, output, expected_output);
+
+    box_t const qbox(generate::value<point_t>::apply(10, 10), generate::value<point_t>::apply(40, 30));
+    output.clear();
+    expected_output.clear();
+    rt.query(bgi::intersects(qbox), std::back_inserter(output));
+    expected.query(bgi::intersects(qbox), std::back_inserter(expected_output));
+    basictest::compare_outputs(rt, output, expected_output);
+}
+
+template <typename Value, typename Params>
+void test_bulk_insert(Params const& params = Params())
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+
+    std::vector<Value> values;
+    generate::values(values, 3000);
+
+    for ( std::size_t level = 0 ; level <= 4 ; ++level )
+    {
+        bgi::bulk_insert const policy(level);
+
+        // empty tree
+        {
+            rtree_t rt(params);
+            std::vector<Value> inserted(values.begin(), values.begin() + 500);
+            rt.insert(inserted, policy);
+            check_tree(rt, inserted);
+        }
+
+        // the root is a leaf
+        {
+            std::vector<Value> inserted(values.begin(), values.begin() + 2);
+            rtree_t rt(inserted, params);
+            rt.insert(values.begin() + 2, values.begin() + 500, policy);
+            inserted.assign(values.begin(), values.begin() + 500);
+            check_tree(rt, inserted);
+        }
+
+        // small batches
+        {
+            std::vector<Value> inserted(values.begin(), values.begin() + 1000);
+            rtree_t rt(inserted, params);
+            rt.insert(values.begin() + 1000, values.begin() + 1000, policy);
+            check_tree(rt, inserted);
+            rt.insert(values.begin() + 1000, values.begin() + 1001, policy);
+            rt.insert(values.begin() + 1001, values.begin() + 1010, policy);
+            inserted.assign(values.begin(), values.begin() + 1010);
+            check_tree(rt, inserted);
+        }
+
+        // subsequent batches inserted into the packed tree and the tree created by insert
+        {
+            std::vector<Value> inserted(values.begin(), values.begin() + 1500);
+            rtree_t packed(inserted, params);
+            rtree_t rt(params);
+            rt.insert(inserted.begin(), inserted.end());
+            for ( std::size_t i = 1500 ; i < values.size() ; i += 300 )
+            {
+                packed.insert(values.begin() + i, values.begin() + i + 300, policy);
+                rt.insert(values.begin() + i, values.begin() + i + 300, policy);
+                inserted.assign(values.begin(), values.begin() + i + 300);
+                check_tree(packed, inserted);
+                check_tree(rt, inserted);
+            }
+
+            // the values are removed from the tree containing grafted subtrees
+            BOOST_CHECK(rt.remove(values.begin(), values.begin() + 2000) == 2000);
+            inserted.assign(values.begin() + 2000, values.end());
+            check_tree(rt, inserted);
+        }
+
+        // more values than in the tree
+        {
+            std::vector<Value> inserted(values.begin(), values.begin() + 1000);
+            rtree_t rt(inserted, params);
+            rt.insert(values.begin() + 1000, values.end(), policy);
+            check_tree(rt, values);
+        }
+    }
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    test_bulk_insert<point_t, bgi::linear<4, 2> >();
+    test_bulk_insert<box_t, bgi::quadratic<8, 3> >();
+    test_bulk_insert<std::pair<point_t, int>, bgi::rstar<4, 2> >();
+    test_bulk_insert<point_t, bgi::rstar<16, 4> >();
+    test_bulk_insert<point_t>(bgi::dynamic_rstar(5, 2));
+    test_bulk_insert<box_t>(bgi::dynamic_linear(16, 4));
+
+    return 0;
+}
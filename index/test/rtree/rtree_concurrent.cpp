@@ -0,0 +1,301 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+#include <rtree/exceptions/test_throwing.hpp>
+
+#include <algorithm>
+
+#include <boost/geometry/index/concurrent_rtree.hpp>
+
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+#include <thread>
+#include <atomic>
+#endif
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+typedef bg::model::box<point_t> box_t;
+typedef std::pair<point_t, int> value_t;
+
+inline value_t make_value(int i)
+{
+    return value_t(point_t((i * 7919) % 1013, (i * 104729) % 997), i);
+}
+
+template <typename Tree>
+std::vector<int> query_ids(Tree const& tree, box_t const& box)
+{
+    std::vector<value_t> result;
+    tree.query(bgi::intersects(box), std::back_inserter(result));
+    std::vector<int> ids;
+    for ( size_t i = 0 ; i < result.size() ; ++i )
+        ids.push_back(result[i].second);
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+template <typename Tree>
+std::vector<int> all_ids(Tree const& tree)
+{
+    return query_ids(tree, box_t(point_t(-1, -1), point_t(2000, 2000)));
+}
+
+template <typename Snapshot, typename Rtree>
+void check_snapshot(Snapshot const& s, Rtree const& expected)
+{
+    BOOST_CHECK(s.size() == expected.size());
+    BOOST_CHECK(s.empty() == expected.empty());
+    BOOST_CHECK(all_ids(s) == all_ids(expected));
+    if ( ! expected.empty() )
+        BOOST_CHECK(bg::equals(s.bounds(), expected.bounds()));
+
+    box_t const qbox(point_t(100, 200), point_t(500, 600));
+    BOOST_CHECK(query_ids(s, qbox) == query_ids(expected, qbox));
+
+    point_t const pt(300, 400);
+    std::vector<value_t> result, expected_result;
+    s.query(bgi::nearest(pt, 5), std::back_inserter(result));
+    expected.query(bgi::nearest(pt, 5), std::back_inserter(expected_result));
+    BOOST_CHECK(result.size() == expected_result.size());
+    std::vector<double> dists, expected_dists;
+    for ( size_t i = 0 ; i < result.size() ; ++i )
+        dists.push_back(bg::comparable_distance(pt, result[i].first));
+    for ( size_t i = 0 ; i < expected_result.size() ; ++i )
+        expected_dists.push_back(bg::comparable_distance(pt, expected_result[i].first));
+    std::sort(dists.begin(), dists.end());
+    std::sort(expected_dists.begin(), expected_dists.end());
+    BOOST_CHECK(dists == expected_dists);
+}
+
+template <typename Params>
+void test_snapshots(Params const& params)
+{
+    typedef bgi::concurrent_rtree<value_t, Params> tree_t;
+    typedef bgi::rtree<value_t, Params> rtree_t;
+    typedef typename tree_t::snapshot snapshot_t;
+
+    std::vector<value_t> values;
+    for ( int i = 0 ; i < 1000 ; ++i )
+        values.push_back(make_value(i));
+
+    tree_t tree(params);
+    std::vector<snapshot_t> snapshots;
+    std::vector<rtree_t*> expected;
+
+    snapshots.push_back(tree.get_snapshot());
+    expected.push_back(new rtree_t(params));
+
+    // single values and ranges
+    for ( size_t i = 0 ; i < values.size() ; )
+    {
+        size_t const count = (std::min)(values.size() - i, i % 3 == 0 ? size_t(1) : size_t(97));
+        if ( count == 1 )
+            tree.insert(values[i]);
+        else
+            tree.insert(values.begin() + i, values.begin() + i + count);
+        i += count;
+
+        snapshots.push_back(tree.get_snapshot());
+        expected.push_back(new rtree_t(values.begin(), values.begin() + i, params));
+    }
+
+    // removal of existing and not existing values
+    for ( size_t i = 0 ; i < values.size() ; i += 89 )
+    {
+        size_t const count = (std::min)(values.size() - i, size_t(53));
+        BOOST_CHECK(tree.remove(values.begin() + i, values.begin() + i + count) == count);
+        BOOST_CHECK(tree.remove(values[i]) == 0);
+
+        rtree_t * e = new rtree_t(*expected.back());
+        e->remove(values.begin() + i, values.begin() + i + count);
+        snapshots.push_back(tree.get_snapshot());
+        expected.push_back(e);
+    }
+
+    tree.clear();
+    snapshots.push_back(tree.get_snapshot());
+    expected.push_back(new rtree_t(params));
+
+    tree.insert(values.begin(), values.begin() + 100);
+    snapshots.push_back(tree.get_snapshot());
+    expected.push_back(new rtree_t(values.begin(), values.begin() + 100, params));
+
+    // the old snapshots are not affected by the modifications
+    for ( size_t i = 0 ; i < snapshots.size() ; ++i )
+        check_snapshot(snapshots[i], *expected[i]);
+
+    // the old versions are released
+    snapshots.erase(snapshots.begin(), snapshots.end() - 1);
+    tree.insert(values[500]);
+    check_snapshot(snapshots.back(), *expected.back());
+    BOOST_CHECK(tree.size() == 101);
+
+    snapshots.clear();
+    for ( size_t i = 0 ; i < expected.size() ; ++i )
+        delete expected[i];
+
+    // packing
+    tree_t packed(values.begin(), values.end(), params);
+    snapshot_t s = packed.get_snapshot();
+    packed.remove(values.begin(), values.begin() + 500);
+    rtree_t expected_packed(values.begin(), values.end(), params);
+    check_snapshot(s, expected_packed);
+    BOOST_CHECK(packed.size() == 500);
+}
+
+template <typename Params>
+void test_rollback(Params const& params)
+{
+    typedef std::pair<point_t, throwing_value> value_type;
+    typedef bgi::concurrent_rtree<value_type, Params> tree_t;
+    typedef bgi::rtree<value_type, Params> rtree_t;
+
+    std::vector<value_type> values;
+    generate::values(values, 300, 1013, 997);
+
+    box_t const qbox(point_t(-1, -1), point_t(2000, 2000));
+
+    for ( size_t max_calls = 0 ; max_calls < 400 ; max_calls += 13 )
+    {
+        tree_t tree(values.begin(), values.begin() + 200, params);
+        rtree_t expected(values.begin(), values.begin() + 200, params);
+
+        throwing_value::reset_calls_counter();
+        throwing_value::set_max_calls(max_calls);
+
+        bool inserted = true;
+        BOOST_TRY
+        {
+            tree.insert(values.begin() + 200, values.end());
+        }
+        BOOST_CATCH(throwing_value_copy_exception const&)
+        {
+            inserted = false;
+        }
+        BOOST_CATCH_END
+
+        bool removed = true;
+        BOOST_TRY
+        {
+            tree.remove(values.begin() + 50, values.begin() + 150);
+        }
+        BOOST_CATCH(throwing_value_copy_exception const&)
+        {
+            removed = false;
+        }
+        BOOST_CATCH_END
+
+        throwing_value::set_max_calls((std::numeric_limits<size_t>::max)());
+
+        // the container is not modified by the failed operations
+        if ( inserted )
+            expected.insert(values.begin() + 200, values.end());
+        if ( removed )
+            expected.remove(values.begin() + 50, values.begin() + 150);
+
+        std::vector<value_type> result, expected_result;
+        tree.query(bgi::intersects(qbox), std::back_inserter(result));
+        expected.query(bgi::intersects(qbox), std::back_inserter(expected_result));
+        BOOST_CHECK(tree.size() == expected.size());
+        BOOST_CHECK(result.size() == expected_result.size());
+
+        // the container can still be modified
+        tree.insert(values.begin(), values.begin() + 10);
+        BOOST_CHECK(tree.size() == expected.size() + 10);
+    }
+}
+
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_THREADS
+
+// The writer inserts the values with increasing ids and then removes them
+// in the same order, so each version contains a contiguous range of ids.
+template <typename Tree>
+struct reader
+{
+    reader(Tree const& t, std::atomic<bool> const& d, std::atomic<int> & e)
+        : tree(&t), done(&d), errors(&e)
+    {}
+
+    void operator()() const
+    {
+        do
+        {
+            typename Tree::snapshot const s = tree->get_snapshot();
+            std::vector<int> const ids = all_ids(s);
+
+            bool ok = ids.size() == s.size();
+            for ( size_t i = 1 ; ok && i < ids.size() ; ++i )
+                ok = ids[i] == ids[i - 1] + 1;
+
+            if ( ! ok )
+                ++(*errors);
+        }
+        while ( ! done->load() );
+    }
+
+    Tree const* tree;
+    std::atomic<bool> const* done;
+    std::atomic<int> * errors;
+};
+
+template <typename Params>
+void test_concurrent(Params const& params)
+{
+    typedef bgi::concurrent_rtree<value_t, Params> tree_t;
+
+    std::vector<value_t> values;
+    for ( int i = 0 ; i < 2000 ; ++i )
+        values.push_back(make_value(i));
+
+    tree_t tree(params);
+    std::atomic<bool> done(false);
+    std::atomic<int> errors(0);
+
+    std::vector<std::thread> readers;
+    for ( int i = 0 ; i < 3 ; ++i )
+        readers.push_back(std::thread(reader<tree_t>(tree, done, errors)));
+
+    for ( size_t i = 0 ; i < values.size() ; i += 10 )
+        tree.insert(values.begin() + i, values.begin() + i + 10);
+    for ( size_t i = 0 ; i < values.size() ; ++i )
+        tree.remove(values[i]);
+
+    done = true;
+    for ( size_t i = 0 ; i < readers.size() ; ++i )
+        readers[i].join();
+
+    BOOST_CHECK(errors == 0);
+    BOOST_CHECK(tree.empty());
+}
+
+#else
+
+template <typename Params>
+void test_concurrent(Params const& )
+{}
+
+#endif
+
+template <typename Params>
+void test_concurrent_rtree(Params const& params = Params())
+{
+    test_snapshots(params);
+    test_rollback(params);
+    test_concurrent(params);
+}
+
+int test_main(int, char* [])
+{
+    test_concurrent_rtree(bgi::linear<4, 2>());
+    test_concurrent_rtree(bgi::quadratic<8, 3>());
+    test_concurrent_rtree(bgi::rstar<16, 4>());
+    test_concurrent_rtree(bgi::dynamic_rstar(8, 3));
+
+    return 0;
+}
@@ -0,0 +1,196 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+#include <boost/geometry/index/rtree_view.hpp>
+#include <boost/geometry/index/detail/algorithms/intersects_simd.hpp>
+
+// The coordinates are generated on a coarse grid so the boxes often touch.
+template <typename Indexable, typename Tag = typename bg::tag<Indexable>::type>
+struct grid_indexable
+{
+    template <typename Point>
+    static Indexable apply(Point const& p, int)
+    {
+        return p;
+    }
+};
+
+template <typename Box>
+struct grid_indexable<Box, bg::box_tag>
+{
+    template <typename Point>
+    static Box apply(Point const& p, int i)
+    {
+        Point p2 = p;
+        bg::set<0>(p2, bg::get<0>(p) + i % 3);
+        bg::set<1>(p2, bg::get<1>(p) + i % 2);
+        return Box(p, p2);
+    }
+};
+
+template <typename Point>
+Point grid_point(int i)
+{
+    Point p;
+    bg::set<0>(p, (i * 7) % 23);
+    bg::set<1>(p, (i * 13) % 19);
+    if ( bg::dimension<Point>::value > 2 )
+        bg::set<bg::dimension<Point>::value - 1>(p, (i * 5) % 11);
+    return p;
+}
+
+template <typename Rtree, typename Values, typename Predicate>
+void check_query(Rtree const& rtree, Values const& values, Predicate const& pred)
+{
+    typedef typename Rtree::value_type value_t;
+
+    std::vector<int> result, expected;
+
+    std::vector<value_t> output;
+    rtree.query(pred, std::back_inserter(output));
+    for ( size_t i = 0 ; i < output.size() ; ++i )
+        result.push_back(output[i].second);
+
+    for ( size_t i = 0 ; i < values.size() ; ++i )
+        if ( bgi::detail::predicates_check<bgi::detail::value_tag, 0, 1>(pred, values[i], values[i].first,
+                bgi::detail::get_strategy(rtree.parameters())) )
+            expected.push_back(values[i].second);
+
+    std::sort(result.begin(), result.end());
+    std::sort(expected.begin(), expected.end());
+    BOOST_CHECK(result == expected);
+}
+
+// only the nodes are tested with the intersection
+template <typename Rtree, typename Values, typename Box>
+void check_nodes_only(Rtree const& rtree, Values const& values, Box const& qbox, bg::box_tag)
+{
+    check_query(rtree, values, bgi::within(qbox));
+    check_query(rtree, values, bgi::overlaps(qbox));
+}
+
+template <typename Rtree, typename Values, typename Box>
+void check_nodes_only(Rtree const& , Values const& , Box const& , bg::point_tag)
+{}
+
+template <typename Indexable, typename Params>
+void test_rtree_intersects(Params const& params)
+{
+    typedef std::pair<Indexable, int> value_t;
+    typedef bgi::rtree<value_t, Params> rtree_t;
+    typedef typename rtree_t::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    std::vector<value_t> values;
+    for ( int i = 0 ; i < 500 ; ++i )
+        values.push_back(value_t(grid_indexable<Indexable>::apply(grid_point<point_t>(i), i), i));
+
+    rtree_t rtree(params);
+    rtree.insert(values.begin(), values.end());
+    rtree_t packed(values.begin(), values.end(), params);
+
+    std::ostringstream oss;
+    bgi::write_flat(rtree, oss);
+    basictest::flat_buffer const buffer(oss.str());
+    bgi::rtree_view<value_t, Params> view(buffer.data(), buffer.size(), params);
+
+    for ( int i = 0 ; i < 40 ; ++i )
+    {
+        point_t const p1 = grid_point<point_t>(i * 3 + 1);
+        point_t p2 = p1;
+        bg::set<0>(p2, bg::get<0>(p1) + i % 5);
+        bg::set<1>(p2, bg::get<1>(p1) + i % 4);
+        box_t const qbox(p1, p2);
+
+        check_query(rtree, values, bgi::intersects(qbox));
+        check_query(packed, values, bgi::intersects(qbox));
+        check_query(view, values, bgi::intersects(qbox));
+        check_query(rtree, values, bgi::intersects(p1));
+        check_query(view, values, bgi::intersects(p1));
+        check_nodes_only(rtree, values, qbox, typename bg::tag<Indexable>::type());
+        // not handled by the vectorized code
+        check_query(rtree, values, !bgi::intersects(qbox));
+        check_query(rtree, values, bgi::disjoint(qbox));
+    }
+}
+
+template <typename T>
+void test_intersects_mask()
+{
+    static const size_t dimension = 2;
+    static const size_t max_count = 64;
+
+    T mins_data[dimension][max_count];
+    T maxs_data[dimension][max_count];
+    for ( size_t i = 0 ; i < max_count ; ++i )
+    {
+        for ( size_t d = 0 ; d < dimension ; ++d )
+        {
+            mins_data[d][i] = T((i * (d + 3)) % 7);
+            maxs_data[d][i] = mins_data[d][i] + T(i % 3);
+        }
+    }
+    T const* mins[dimension] = { mins_data[0], mins_data[1] };
+    T const* maxs[dimension] = { maxs_data[0], maxs_data[1] };
+    T const qmin[dimension] = { 2, 3 };
+    T const qmax[dimension] = { 4, 3 };
+
+    for ( size_t count = 0 ; count <= max_count ; ++count )
+    {
+        boost::uint64_t expected = 0;
+        for ( size_t i = 0 ; i < count ; ++i )
+        {
+            bool r = true;
+            for ( size_t d = 0 ; d < dimension ; ++d )
+                r = r && mins[d][i] <= qmax[d] && qmin[d] <= maxs[d][i];
+            if ( r )
+                expected |= boost::uint64_t(1) << i;
+        }
+
+        boost::uint64_t const result = bgi::detail::simd::intersects_mask<dimension>(mins, maxs, count, qmin, qmax);
+        BOOST_CHECK(result == expected);
+    }
+}
+
+template <typename T>
+void test_rtree_intersects_all()
+{
+    typedef bg::model::point<T, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef bg::model::point<T, 3, bg::cs::cartesian> point3_t;
+    typedef bg::model::box<point3_t> box3_t;
+
+    BOOST_CHECK(bgi::detail::simd::contiguous_coordinates<box_t>::value);
+    BOOST_CHECK(bgi::detail::simd::contiguous_coordinates<point3_t>::value);
+
+    test_rtree_intersects<point_t>(bgi::linear<16, 4>());
+    test_rtree_intersects<box_t>(bgi::linear<16, 4>());
+    test_rtree_intersects<point3_t>(bgi::quadratic<32, 8>());
+    test_rtree_intersects<box3_t>(bgi::quadratic<32, 8>());
+    test_rtree_intersects<box_t>(bgi::rstar<64, 16>());
+    test_rtree_intersects<point_t>(bgi::dynamic_rstar(4, 2));
+
+    test_intersects_mask<T>();
+}
+
+int test_main(int, char* [])
+{
+    test_rtree_intersects_all<float>();
+    test_rtree_intersects_all<double>();
+
+    // the coordinates of other types are compared with the generic code
+    test_rtree_intersects<bg::model::box<bg::model::point<int, 2, bg::cs::cartesian> > >(bgi::linear<16, 4>());
+
+    return 0;
+}
@@ -0,0 +1,160 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <boost/geometry/index/join.hpp>
+
+typedef std::pair<int, int> ids_pair;
+
+template <typename Value>
+std::vector<Value> generate_values(std::size_t count, int seed)
+{
+    std::vector<Value> values;
+    for ( std::size_t i = 0 ; i < count ; ++i )
+    {
+        int x = static_cast<int>((i * 7919 + seed * 31) % 101);
+        int y = static_cast<int>((i * 104729 + seed * 17) % 97);
+        values.push_back(generate::value<Value>::apply(x, y));
+    }
+    return values;
+}
+
+template <typename Pairs>
+std::vector<ids_pair> sorted_ids(Pairs const& pairs)
+{
+    std::vector<ids_pair> result;
+    for ( typename Pairs::const_iterator it = pairs.begin() ; it != pairs.end() ; ++it )
+        result.push_back(ids_pair(it->first.second, it->second.second));
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+struct intersects_check
+{
+    template <typename G1, typename G2>
+    static bool apply(G1 const& g1, G2 const& g2) { return bg::intersects(g1, g2); }
+};
+
+struct within_check
+{
+    template <typename G1, typename G2>
+    static bool apply(G1 const& g1, G2 const& g2) { return bg::within(g1, g2); }
+};
+
+struct covers_check
+{
+    template <typename G1, typename G2>
+    static bool apply(G1 const& g1, G2 const& g2) { return bg::covered_by(g2, g1); }
+};
+
+template <typename Rtree1, typename Rtree2, typename Predicate, typename Check>
+void test_join(Rtree1 const& rtree1, Rtree2 const& rtree2, Predicate const& predicate, Check)
+{
+    typedef std::pair<typename Rtree1::value_type, typename Rtree2::value_type> pair_t;
+
+    std::vector<ids_pair> expected;
+    for ( typename Rtree1::const_iterator it1 = rtree1.begin() ; it1 != rtree1.end() ; ++it1 )
+        for ( typename Rtree2::const_iterator it2 = rtree2.begin() ; it2 != rtree2.end() ; ++it2 )
+            if ( Check::apply(rtree1.indexable_get()(*it1), rtree2.indexable_get()(*it2)) )
+                expected.push_back(ids_pair(it1->second, it2->second));
+    std::sort(expected.begin(), expected.end());
+
+    {
+        std::vector<pair_t> result;
+        std::size_t n = bgi::join(rtree1, rtree2, predicate, std::back_inserter(result));
+        BOOST_CHECK_EQUAL(n, result.size());
+        BOOST_CHECK(sorted_ids(result) == expected);
+    }
+
+    for ( std::size_t threads = 1 ; threads <= 8 ; threads *= 2 )
+    {
+        std::vector<pair_t> result;
+        std::size_t n = bgi::join(rtree1, rtree2, predicate, std::back_inserter(result),
+                                  bgi::parallel(threads));
+        BOOST_CHECK_EQUAL(n, result.size());
+        BOOST_CHECK(sorted_ids(result) == expected);
+    }
+}
+
+template <typename Value1, typename Value2, typename Params1, typename Params2>
+void test_rtrees(std::size_t count1, std::size_t count2,
+                 Params1 const& params1, Params2 const& params2)
+{
+    typedef bgi::rtree<Value1, Params1> rtree1_t;
+    typedef bgi::rtree<Value2, Params2> rtree2_t;
+
+    std::vector<Value1> values1 = generate_values<Value1>(count1, 0);
+    std::vector<Value2> values2 = generate_values<Value2>(count2, 13);
+
+    // packed trees
+    rtree1_t rtree1(values1, params1);
+    rtree2_t rtree2(values2, params2);
+
+    test_join(rtree1, rtree2, bgi::intersects(), intersects_check());
+    test_join(rtree2, rtree1, bgi::intersects(), intersects_check());
+    test_join(rtree1, rtree2, bgi::within(), within_check());
+    test_join(rtree2, rtree1, bgi::covers(), covers_check());
+
+    // trees created with insertions
+    rtree1_t rtree3(params1);
+    rtree3.insert(values1.begin(), values1.end());
+    test_join(rtree3, rtree2, bgi::intersects(), intersects_check());
+    test_join(rtree3, rtree1, bgi::intersects(), intersects_check());
+}
+
+template <typename Params1, typename Params2>
+void test_rtrees_all(Params1 const& params1 = Params1(), Params2 const& params2 = Params2())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef std::pair<point_t, int> point_value_t;
+    typedef std::pair<box_t, int> box_value_t;
+
+    test_rtrees<point_value_t, box_value_t>(0, 10, params1, params2);
+    test_rtrees<point_value_t, box_value_t>(10, 0, params1, params2);
+    test_rtrees<point_value_t, box_value_t>(1, 1, params1, params2);
+    test_rtrees<point_value_t, box_value_t>(5, 300, params1, params2);
+    test_rtrees<point_value_t, box_value_t>(1000, 700, params1, params2);
+    test_rtrees<box_value_t, box_value_t>(800, 20, params1, params2);
+}
+
+void test_non_cartesian()
+{
+    typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > point_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef std::pair<point_t, int> point_value_t;
+    typedef std::pair<box_t, int> box_value_t;
+
+    std::vector<point_value_t> values1;
+    std::vector<box_value_t> values2;
+    for ( int i = 0 ; i < 300 ; ++i )
+    {
+        double const x = -180 + (i * 7919) % 360;
+        double const y = -80 + (i * 104729) % 160;
+        values1.push_back(point_value_t(point_t(x, y), i));
+        values2.push_back(box_value_t(box_t(point_t(x, y), point_t(x + 10, y + 5)), i));
+    }
+
+    bgi::rtree<point_value_t, bgi::rstar<8> > rtree1(values1);
+    bgi::rtree<box_value_t, bgi::quadratic<4> > rtree2(values2);
+
+    test_join(rtree1, rtree2, bgi::intersects(), intersects_check());
+}
+
+int test_main(int, char* [])
+{
+    test_rtrees_all< bgi::linear<4, 2>, bgi::rstar<16, 4> >();
+    test_rtrees_all< bgi::quadratic<8, 3>, bgi::quadratic<5, 2> >();
+    test_rtrees_all(bgi::dynamic_rstar(4, 2), bgi::dynamic_linear(32, 8));
+
+    test_non_cartesian();
+
+    return 0;
+}
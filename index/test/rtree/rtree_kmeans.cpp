@@ -0,0 +1,85 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <boost/geometry/index/detail/rtree/utilities/statistics.hpp>
+
+// Points gathered in a few dense clusters, like GPS traces.
+template <typename Point>
+std::vector<Point> clustered_points(size_t clusters_count, size_t cluster_size)
+{
+    std::vector<Point> result;
+    for ( size_t c = 0 ; c < clusters_count ; ++c )
+    {
+        double const cx = double((c * 7919) % 1013);
+        double const cy = double((c * 104729) % 997);
+        for ( size_t i = 0 ; i < cluster_size ; ++i )
+        {
+            double const dx = double((i * 31) % 17) / 4.0;
+            double const dy = double((i * 47) % 13) / 4.0;
+            result.push_back(Point(cx + dx, cy + dy));
+        }
+    }
+    return result;
+}
+
+template <typename Parameters>
+void test_clustered(Parameters const& parameters)
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef bgi::rtree<point_t, Parameters> rtree_t;
+
+    std::vector<point_t> const points = clustered_points<point_t>(20, 100);
+
+    rtree_t rt(parameters);
+    for ( size_t i = 0 ; i < points.size() ; ++i )
+        rt.insert(points[i]);
+
+    BOOST_CHECK(rt.size() == points.size());
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt));
+
+    box_t const qbox(point_t(100, 100), point_t(600, 700));
+    std::vector<point_t> expected;
+    for ( size_t i = 0 ; i < points.size() ; ++i )
+        if ( bg::intersects(points[i], qbox) )
+            expected.push_back(points[i]);
+
+    std::vector<point_t> result;
+    rt.query(bgi::intersects(qbox), std::back_inserter(result));
+    BOOST_CHECK(result.size() == expected.size());
+
+    // the nodes still satisfy the min elements requirement after removals
+    for ( size_t i = 0 ; i < points.size() ; i += 2 )
+        rt.remove(points[i]);
+
+    BOOST_CHECK(rt.size() == points.size() / 2);
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt));
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> Point2d;
+    typedef bg::model::box< bg::model::point<double, 3, bg::cs::cartesian> > Box3d;
+
+    testset::modifiers<Point2d>(bgi::kmeans<5, 2>(), std::allocator<int>());
+    testset::queries<Point2d>(bgi::dynamic_kmeans(5, 2), std::allocator<int>());
+    testset::queries<Box3d>(bgi::kmeans<5, 2>(), std::allocator<int>());
+
+    test_clustered(bgi::kmeans<4, 2>());
+    test_clustered(bgi::kmeans<16, 4>());
+    test_clustered(bgi::dynamic_kmeans(8, 3));
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+template <typename Rtree, typename Query, typename Values>
+std::vector<double> sorted_distances(Rtree const& rtree, Query const& query,
+                                     Values const& values)
+{
+    std::vector<double> result;
+    for ( typename Values::const_iterator it = values.begin() ; it != values.end() ; ++it )
+        result.push_back(bg::comparable_distance(query, rtree.indexable_get()(*it)));
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+template <typename Rtree, typename Queries, typename Traversal>
+void test_nearest_batch(Rtree const& rtree, Queries const& queries, unsigned k, bool group,
+                        Traversal const& traversal)
+{
+    typedef typename Rtree::value_type value_t;
+    typedef typename Rtree::size_type size_type;
+
+    std::vector<size_type> offsets;
+    std::vector<value_t> output;
+    size_type n = rtree.nearest_batch(queries, k, std::back_inserter(offsets),
+                                      std::back_inserter(output), group, traversal);
+
+    BOOST_CHECK(n == output.size());
+    BOOST_CHECK(offsets.size() == queries.size() + 1);
+    if ( offsets.size() != queries.size() + 1 )
+        return;
+    BOOST_CHECK(offsets.front() == 0);
+    BOOST_CHECK(offsets.back() == n);
+
+    for ( size_type i = 0 ; i < queries.size() ; ++i )
+    {
+        std::vector<value_t> expected_output;
+        rtree.query(bgi::nearest(queries[i], k), std::back_inserter(expected_output));
+
+        BOOST_CHECK(offsets[i] <= offsets[i + 1]);
+        std::vector<value_t> batch_output(output.begin() + offsets[i], output.begin() + offsets[i + 1]);
+
+        // the values of a query are sorted by distance
+        std::vector<double> distances;
+        for ( size_type j = 0 ; j < batch_output.size() ; ++j )
+            distances.push_back(bg::comparable_distance(queries[i], rtree.indexable_get()(batch_output[j])));
+        BOOST_CHECK(std::is_sorted(distances.begin(), distances.end()));
+
+        // the same distances as in the case of single query, values may differ if distances are equal
+        BOOST_CHECK(sorted_distances(rtree, queries[i], batch_output)
+                 == sorted_distances(rtree, queries[i], expected_output));
+    }
+}
+
+// best-first knn query returns the same distances as the default one
+template <typename Rtree, typename Queries>
+void test_best_first(Rtree const& rtree, Queries const& queries, unsigned k)
+{
+    typedef typename Rtree::value_type value_t;
+
+    // the buffers are reused by all queries
+    std::vector<value_t> expected_output;
+    std::vector<value_t> output;
+    for ( typename Queries::const_iterator it = queries.begin() ; it != queries.end() ; ++it )
+    {
+        expected_output.clear();
+        rtree.query(bgi::nearest(*it, k), std::back_inserter(expected_output));
+
+        output.clear();
+        size_t n = rtree.query(bgi::nearest(*it, k), std::back_inserter(output), bgi::best_first());
+
+        BOOST_CHECK(n == output.size());
+        BOOST_CHECK(sorted_distances(rtree, *it, output)
+                 == sorted_distances(rtree, *it, expected_output));
+
+        output.clear();
+        n = rtree.query(bgi::nearest(*it, k) && bgi::satisfies(basictest::AlwaysFalse()),
+                        std::back_inserter(output), bgi::best_first());
+
+        BOOST_CHECK(n == 0 && output.empty());
+    }
+}
+
+template <typename Value, typename Params, typename Traversal>
+void test_rtree(Params const& params, Traversal const& traversal)
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+    typedef typename rtree_t::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    rtree_t rtree(params);
+    std::vector<Value> input;
+    box_t qbox;
+    generate::rtree(rtree, input, qbox);
+
+    std::vector<point_t> points;
+    std::vector<box_t> boxes;
+    for ( typename std::vector<Value>::const_iterator it = input.begin() ; it != input.end() ; ++it )
+    {
+        points.push_back(bg::return_centroid<point_t>(rtree.indexable_get()(*it)));
+        boxes.push_back(bg::return_envelope<box_t>(rtree.indexable_get()(*it)));
+    }
+    // reversed order, not sorted spatially
+    std::reverse(points.begin(), points.end());
+    points.push_back(generate::outside_point<point_t>::apply());
+    boxes.push_back(qbox);
+
+    test_nearest_batch(rtree, points, 1, false, traversal);
+    test_nearest_batch(rtree, points, 5, false, traversal);
+    test_nearest_batch(rtree, points, 5, true, traversal);
+    test_nearest_batch(rtree, boxes, 3, true, traversal);
+    test_nearest_batch(rtree, points, static_cast<unsigned>(input.size() + 10), true, traversal);
+    test_nearest_batch(rtree, std::vector<point_t>(), 5, true, traversal);
+
+    test_best_first(rtree, points, 1);
+    test_best_first(rtree, points, 5);
+    test_best_first(rtree, boxes, 3);
+
+    rtree_t empty(params);
+    test_nearest_batch(empty, points, 5, false, traversal);
+    test_nearest_batch(empty, points, 5, true, traversal);
+    test_best_first(empty, points, 5);
+}
+
+template <typename Params>
+void test_rtree_all(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point3_t;
+
+    test_rtree<point_t>(params, bgi::depth_first());
+    test_rtree<std::pair<box_t, int> >(params, bgi::depth_first());
+    test_rtree<point3_t>(params, bgi::depth_first());
+
+    test_rtree<point_t>(params, bgi::best_first());
+    test_rtree<std::pair<box_t, int> >(params, bgi::best_first());
+    test_rtree<point3_t>(params, bgi::best_first());
+}
+
+int test_main(int, char* [])
+{
+    test_rtree_all< bgi::linear<5, 2> >();
+    test_rtree_all< bgi::quadratic<16, 4> >();
+    test_rtree_all< bgi::rstar<4> >();
+
+    test_rtree_all(bgi::dynamic_rstar(8, 3));
+
+    return 0;
+}
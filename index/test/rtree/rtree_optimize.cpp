@@ -0,0 +1,172 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <boost/geometry/index/concurrent_rtree.hpp>
+#include <boost/geometry/index/detail/rtree/utilities/quality.hpp>
+
+template <typename Rtree, typename Value>
+void check_tree(Rtree const& rt, std::vector<Value> const& values)
+{
+    typedef typename Rtree::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    BOOST_CHECK(rt.size() == values.size());
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt));
+
+    std::vector<Value> output(rt.begin(), rt.end());
+    basictest::compare_outputs(rt, output, values);
+
+    box_t const qbox(generate::value<point_t>::apply(10, 10), generate::value<point_t>::apply(40, 30));
+    std::vector<Value> expected_output;
+    output.clear();
+    rt.query(bgi::intersects(qbox), std::back_inserter(output));
+    for ( typename std::vector<Value>::const_iterator it = values.begin() ; it != values.end() ; ++it )
+    {
+        if ( bg::intersects(rt.indexable_get()(*it), qbox) )
+            expected_output.push_back(*it);
+    }
+    basictest::compare_outputs(rt, output, expected_output);
+}
+
+// The values are inserted in the order of their coordinates and then
+// some of them are removed so the nodes overlap and are not filled.
+template <typename Value, typename Rtree>
+void degrade(Rtree & rt, std::vector<Value> & values)
+{
+    for ( int x = 0 ; x < 50 ; ++x )
+        for ( int y = 0 ; y < 50 ; ++y )
+            values.push_back(generate::value<Value>::apply(x, (y * 17 + x) % 50));
+    rt.insert(values.begin(), values.end());
+
+    std::vector<Value> remaining;
+    for ( std::size_t i = 0 ; i < values.size() ; ++i )
+    {
+        if ( i % 3 == 0 )
+            rt.remove(values[i]);
+        else
+            remaining.push_back(values[i]);
+    }
+    values.swap(remaining);
+}
+
+template <typename Value, typename Params>
+void test_optimize(Params const& params = Params())
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+    namespace bgu = bgi::detail::rtree::utilities;
+
+    // empty tree and the root leaf
+    {
+        rtree_t rt(params);
+        BOOST_CHECK(rt.optimize() == 0);
+
+        std::vector<bgu::level_quality> const empty = bgu::quality(rt);
+        BOOST_CHECK(empty.size() == 1);
+        BOOST_CHECK(empty[0].nodes == 0 && empty[0].elements == 0);
+        BOOST_CHECK(empty[0].fill_factor == 0 && empty[0].content == 0);
+        BOOST_CHECK(empty[0].comparable_margin == 0);
+
+        std::vector<Value> values;
+        values.push_back(generate::value<Value>::apply(0, 0));
+        values.push_back(generate::value<Value>::apply(1, 1));
+        rt.insert(values.begin(), values.end());
+        BOOST_CHECK(rt.optimize() == 0);
+        check_tree(rt, values);
+    }
+
+    std::vector<Value> values;
+    rtree_t rt(params);
+    degrade<Value>(rt, values);
+    check_tree(rt, values);
+
+    std::vector<bgu::level_quality> const before = bgu::quality(rt);
+    BOOST_CHECK(before.size() == bgu::view<rtree_t>(rt).depth() + 1);
+
+    rt.optimize();
+    check_tree(rt, values);
+
+    // the nodes are reorganized only if the contents of their children decrease
+    std::vector<bgu::level_quality> const after = bgu::quality(rt);
+    BOOST_CHECK(after.size() == before.size());
+    std::size_t elements = 0;
+    for ( std::size_t i = 0 ; i < after.size() && i < before.size() ; ++i )
+    {
+        BOOST_CHECK(after[i].content <= before[i].content * 1.000001);
+        BOOST_CHECK(after[i].fill_factor > 0 && after[i].fill_factor <= 1);
+        BOOST_CHECK(after[i].dead_content >= 0);
+        BOOST_CHECK(after[i].overlap >= 0);
+        BOOST_CHECK(after[i].comparable_margin >= 0);
+        elements = after[i].elements;
+    }
+    BOOST_CHECK(elements == values.size());
+
+    // the tree may be optimized again
+    rt.optimize();
+    check_tree(rt, values);
+
+    // the packed tree is not worse after the optimization
+    rtree_t packed(values, params);
+    std::vector<bgu::level_quality> const packed_before = bgu::quality(packed);
+    packed.optimize();
+    check_tree(packed, values);
+    std::vector<bgu::level_quality> const packed_after = bgu::quality(packed);
+    for ( std::size_t i = 0 ; i < packed_after.size() && i < packed_before.size() ; ++i )
+        BOOST_CHECK(packed_after[i].content <= packed_before[i].content * 1.000001);
+}
+
+template <typename Params>
+void test_optimize_concurrent(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef std::pair<point_t, int> value_t;
+    typedef bgi::concurrent_rtree<value_t, Params> tree_t;
+    typedef bgi::rtree<value_t, Params> rtree_t;
+
+    std::vector<value_t> values;
+    rtree_t expected(params);
+    degrade<value_t>(expected, values);
+
+    tree_t tree(params);
+    tree.insert(values.begin(), values.end());
+
+    typename tree_t::snapshot const s = tree.get_snapshot();
+
+    tree.optimize();
+
+    // the current version and the old snapshot contain the same values
+    std::vector<value_t> output;
+    tree.query(bgi::intersects(tree.bounds()), std::back_inserter(output));
+    basictest::compare_outputs(expected, output, values);
+
+    output.clear();
+    s.query(bgi::intersects(s.bounds()), std::back_inserter(output));
+    basictest::compare_outputs(expected, output, values);
+    BOOST_CHECK(s.size() == values.size());
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    test_optimize<point_t, bgi::linear<4, 2> >();
+    test_optimize<box_t, bgi::quadratic<8, 3> >();
+    test_optimize<std::pair<point_t, int>, bgi::rstar<16, 4> >();
+    test_optimize<point_t>(bgi::dynamic_linear(5, 2));
+    test_optimize<box_t>(bgi::dynamic_rstar(16, 4));
+
+    test_optimize_concurrent(bgi::linear<8, 3>());
+    test_optimize_concurrent(bgi::dynamic_quadratic(6, 2));
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <iterator>
+#include <sstream>
+
+#include <boost/geometry/index/rtree_view.hpp>
+#include <boost/geometry/index/detail/rtree/utilities/statistics.hpp>
+
+#include <boost/tuple/tuple_comparison.hpp>
+
+// Single pass iterator, like std::istream_iterator.
+template <typename It>
+class input_iterator
+{
+public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef typename std::iterator_traits<It>::value_type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef value_type const* pointer;
+    typedef value_type const& reference;
+
+    explicit input_iterator(It it) : m_it(it) {}
+
+    reference operator*() const { return *m_it; }
+    input_iterator & operator++() { ++m_it; return *this; }
+
+    bool operator==(input_iterator const& other) const { return m_it == other.m_it; }
+    bool operator!=(input_iterator const& other) const { return m_it != other.m_it; }
+
+private:
+    It m_it;
+};
+
+template <typename It>
+input_iterator<It> make_input_iterator(It it)
+{
+    return input_iterator<It>(it);
+}
+
+template <typename Rtree>
+void check_same_structure(Rtree const& expected, Rtree const& tree)
+{
+    BOOST_CHECK(expected.size() == tree.size());
+    BOOST_CHECK(bgi::detail::rtree::utilities::statistics(expected)
+             == bgi::detail::rtree::utilities::statistics(tree));
+
+    // the same structure results in the same order of values
+    basictest::exactly_the_same_outputs(expected, expected, tree);
+
+    if ( ! tree.empty() )
+    {
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(tree));
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(tree));
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(tree));
+    }
+}
+
+template <typename Value, typename Params, typename Curve>
+void test_rtree(std::size_t count, std::size_t max_values, Params const& params, Curve,
+                std::string const& directory = std::string())
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+    typedef bgi::rtree_view<Value, Params> view_t;
+    typedef typename rtree_t::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    std::vector<Value> values;
+    generate::values(values, count, 1013, 997);
+
+    rtree_t const sorted(values, bgi::sort_packing<Curve>(), params);
+
+    bgi::external_sort_packing<Curve> const policy(max_values, directory);
+
+    // the range is traversed twice
+    {
+        rtree_t external(values.begin(), values.end(), policy, params);
+        check_same_structure(sorted, external);
+    }
+
+    // the range is traversed once
+    {
+        rtree_t external(make_input_iterator(values.begin()), make_input_iterator(values.end()),
+                         policy, params);
+        check_same_structure(sorted, external);
+    }
+
+    // the flat layout written directly
+    {
+        std::ostringstream oss;
+        bgi::write_flat(make_input_iterator(values.begin()), make_input_iterator(values.end()),
+                        oss, policy, params);
+        BOOST_CHECK(oss.good());
+        std::string const str = oss.str();
+
+        std::ostringstream expected_oss;
+        bgi::write_flat(sorted, expected_oss);
+        std::string const expected_str = expected_oss.str();
+
+        BOOST_CHECK(str.size() == expected_str.size());
+        // the padding of Values may differ
+        if ( boost::is_same<Value, point_t>::value )
+            BOOST_CHECK(str == expected_str);
+
+        basictest::flat_buffer const buffer(str);
+        view_t view(buffer.data(), buffer.size(), params);
+
+        BOOST_CHECK(view.size() == sorted.size());
+        BOOST_CHECK(view.depth() == bgi::detail::rtree::utilities::view<rtree_t>(sorted).depth());
+
+        std::vector<Value> all(view.begin(), view.end());
+        std::vector<Value> expected_all(sorted.begin(), sorted.end());
+        basictest::exactly_the_same_outputs(sorted, all, expected_all);
+
+        box_t qbox(generate::value<point_t>::apply(100, 100),
+                   generate::value<point_t>::apply(500, 300));
+        std::vector<Value> output, expected_output;
+        view.query(bgi::intersects(qbox), std::back_inserter(output));
+        sorted.query(bgi::intersects(qbox), std::back_inserter(expected_output));
+        basictest::exactly_the_same_outputs(sorted, output, expected_output);
+    }
+}
+
+template <typename Params>
+void test_rtree_all(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    // all values in memory
+    test_rtree<point_t>(0, 100, params, bgi::hilbert_curve());
+    test_rtree<point_t>(3, 100, params, bgi::hilbert_curve());
+    test_rtree<point_t>(100, 100, params, bgi::hilbert_curve());
+    // several runs merged at once
+    test_rtree<point_t>(177, 10, params, bgi::hilbert_curve());
+    test_rtree<std::pair<box_t, int> >(1000, 100, params, bgi::hilbert_curve());
+    // the runs merged in several passes
+    test_rtree<point_t>(10000, 100, params, bgi::hilbert_curve());
+    test_rtree<point_t>(10000, 50, params, bgi::morton_curve());
+    // the temporary files in the directory
+    test_rtree<point_t>(1000, 100, params, bgi::hilbert_curve(), ".");
+}
+
+void test_errors()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bgi::rtree<point_t, bgi::linear<4, 2> > rtree_t;
+
+    std::vector<point_t> values(100, point_t(0, 0));
+
+    // the values fit in memory so the temporary files aren't needed
+    rtree_t rt(values, bgi::external_hilbert_packing(100, "nonexistent_directory"));
+    BOOST_CHECK(rt.size() == values.size());
+
+    BOOST_CHECK_THROW(rtree_t(values, bgi::external_hilbert_packing(10, "nonexistent_directory")),
+                      std::runtime_error);
+}
+
+int test_main(int, char* [])
+{
+    test_errors();
+
+    test_rtree_all< bgi::linear<5, 2> >();
+    test_rtree_all< bgi::quadratic<16, 4> >();
+    test_rtree_all< bgi::rstar<4> >();
+
+    test_rtree_all(bgi::dynamic_rstar(8, 3));
+
+    return 0;
+}
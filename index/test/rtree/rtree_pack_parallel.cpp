@@ -0,0 +1,87 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <boost/geometry/index/detail/rtree/utilities/statistics.hpp>
+
+#include <boost/tuple/tuple_comparison.hpp>
+
+template <typename Rtree>
+void check_same_structure(Rtree const& serial, Rtree const& parallel)
+{
+    BOOST_CHECK(serial.size() == parallel.size());
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(serial)
+             == bgi::detail::rtree::utilities::are_levels_ok(parallel));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(serial)
+             == bgi::detail::rtree::utilities::are_boxes_ok(parallel));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(serial)
+             == bgi::detail::rtree::utilities::are_counts_ok(parallel));
+    BOOST_CHECK(bgi::detail::rtree::utilities::statistics(serial)
+             == bgi::detail::rtree::utilities::statistics(parallel));
+
+    // the same structure results in the same order of values
+    basictest::exactly_the_same_outputs(serial, serial, parallel);
+}
+
+template <typename Value, typename Params>
+void test_rtree(std::size_t count, Params const& params = Params())
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+    typedef typename rtree_t::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    std::vector<Value> values;
+    generate::values(values, count, 1013, 997);
+
+    rtree_t serial(values, params);
+
+    for ( std::size_t threads = 1 ; threads <= 8 ; threads *= 2 )
+    {
+        rtree_t parallel(values.begin(), values.end(), bgi::parallel(threads), params);
+        check_same_structure(serial, parallel);
+
+        rtree_t parallel_rng(values, bgi::parallel(threads), params);
+        check_same_structure(serial, parallel_rng);
+
+        box_t qbox(generate::value<point_t>::apply(100, 100),
+                   generate::value<point_t>::apply(500, 300));
+        std::vector<Value> expected_output;
+        serial.query(bgi::intersects(qbox), std::back_inserter(expected_output));
+        basictest::spatial_query(parallel, bgi::intersects(qbox), expected_output);
+    }
+
+    rtree_t parallel_empty(values.begin(), values.begin(), bgi::parallel(4), params);
+    BOOST_CHECK(parallel_empty.empty());
+}
+
+template <typename Params>
+void test_rtree_all(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    test_rtree<point_t>(0, params);
+    test_rtree<point_t>(3, params);
+    test_rtree<point_t>(177, params);
+    test_rtree<point_t>(10000, params);
+    test_rtree<std::pair<box_t, int> >(10000, params);
+}
+
+int test_main(int, char* [])
+{
+    test_rtree_all< bgi::linear<5, 2> >();
+    test_rtree_all< bgi::quadratic<16, 4> >();
+    test_rtree_all< bgi::rstar<4> >();
+
+    test_rtree_all(bgi::dynamic_linear(5, 2));
+    test_rtree_all(bgi::dynamic_rstar(16, 4));
+
+    return 0;
+}
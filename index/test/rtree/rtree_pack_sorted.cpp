@@ -0,0 +1,130 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <boost/geometry/algorithms/detail/space_filling_curve.hpp>
+#include <boost/geometry/index/detail/rtree/utilities/statistics.hpp>
+
+#include <boost/tuple/tuple_comparison.hpp>
+
+struct code_less
+{
+    template <typename Pair>
+    bool operator()(Pair const& p1, Pair const& p2) const
+    {
+        return p1.first < p2.first;
+    }
+};
+
+// Consecutive cells of a regular grid on the Hilbert curve are adjacent.
+void test_hilbert_code()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    box_t const bounds(point_t(0, 0), point_t(15, 15));
+
+    std::vector<std::pair<boost::uint64_t, point_t> > cells;
+    for ( int x = 0 ; x < 16 ; ++x )
+    {
+        for ( int y = 0 ; y < 16 ; ++y )
+        {
+            box_t const b(point_t(x, y), point_t(x, y));
+            cells.push_back(std::make_pair(bg::detail::space_filling_curve::hilbert_code(b, bounds), b.min_corner()));
+        }
+    }
+
+    std::sort(cells.begin(), cells.end(), code_less());
+
+    for ( std::size_t i = 1 ; i < cells.size() ; ++i )
+    {
+        double const dist = bg::distance(cells[i - 1].second, cells[i].second);
+        BOOST_CHECK_EQUAL(dist, 1.0);
+        BOOST_CHECK(cells[i - 1].first < cells[i].first);
+    }
+}
+
+template <typename Rtree>
+void check_same_structure(Rtree const& serial, Rtree const& parallel)
+{
+    BOOST_CHECK(serial.size() == parallel.size());
+    BOOST_CHECK(bgi::detail::rtree::utilities::statistics(serial)
+             == bgi::detail::rtree::utilities::statistics(parallel));
+
+    // the same structure results in the same order of values
+    basictest::exactly_the_same_outputs(serial, serial, parallel);
+}
+
+template <typename Value, typename Params, typename Curve>
+void test_rtree(std::size_t count, Params const& params, Curve)
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+    typedef typename rtree_t::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    std::vector<Value> values;
+    generate::values(values, count, 1013, 997);
+
+    rtree_t packed(values, params);
+    rtree_t sorted(values.begin(), values.end(), bgi::sort_packing<Curve>(), params);
+
+    BOOST_CHECK(sorted.size() == count);
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(sorted));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(sorted));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(sorted));
+
+    box_t qbox(generate::value<point_t>::apply(100, 100),
+               generate::value<point_t>::apply(500, 300));
+    std::vector<Value> expected_output;
+    packed.query(bgi::intersects(qbox), std::back_inserter(expected_output));
+    basictest::spatial_query(sorted, bgi::intersects(qbox), expected_output);
+
+    for ( std::size_t threads = 2 ; threads <= 8 ; threads *= 2 )
+    {
+        rtree_t parallel(values, bgi::sort_packing<Curve>(bgi::parallel(threads)), params);
+        check_same_structure(sorted, parallel);
+    }
+
+    // the tree can be modified
+    sorted.remove(values.begin(), values.begin() + count / 2);
+    BOOST_CHECK(sorted.size() == count - count / 2);
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(sorted));
+
+    rtree_t sorted_empty(values.begin(), values.begin(), bgi::sort_packing<Curve>(), params);
+    BOOST_CHECK(sorted_empty.empty());
+}
+
+template <typename Params>
+void test_rtree_all(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    test_rtree<point_t>(3, params, bgi::hilbert_curve());
+    test_rtree<point_t>(177, params, bgi::hilbert_curve());
+    test_rtree<point_t>(10000, params, bgi::hilbert_curve());
+    test_rtree<std::pair<box_t, int> >(10000, params, bgi::hilbert_curve());
+    test_rtree<point_t>(177, params, bgi::morton_curve());
+    test_rtree<point_t>(100000, params, bgi::morton_curve());
+}
+
+int test_main(int, char* [])
+{
+    test_hilbert_code();
+
+    test_rtree_all< bgi::linear<5, 2> >();
+    test_rtree_all< bgi::quadratic<16, 4> >();
+    test_rtree_all< bgi::rstar<4> >();
+
+    test_rtree_all(bgi::dynamic_linear(5, 2));
+    test_rtree_all(bgi::dynamic_rstar(16, 4));
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <sstream>
+
+#include <boost/geometry/index/concurrent_rtree.hpp>
+#include <boost/geometry/index/rtree_view.hpp>
+
+// Stores the values and stops the query after max_count values.
+template <typename Value>
+struct collect
+{
+    collect(std::vector<Value> & r, std::size_t m)
+        : result(&r), max_count(m)
+    {}
+
+    bool operator()(Value const& v) const
+    {
+        result->push_back(v);
+        return result->size() < max_count;
+    }
+
+    std::vector<Value> * result;
+    std::size_t max_count;
+};
+
+template <typename Value>
+bool any_value(Value const&)
+{
+    return false;
+}
+
+template <typename Value, typename Tree, typename Predicates>
+void test_callback(Tree const& tree, Predicates const& predicates)
+{
+    typedef Value value_t;
+
+    std::vector<value_t> expected_output;
+    std::size_t const count = tree.query(predicates, std::back_inserter(expected_output));
+    BOOST_CHECK_EQUAL(count, expected_output.size());
+
+    // all values
+    {
+        std::vector<value_t> output;
+        std::size_t n = tree.query(predicates, bgi::callback(collect<value_t>(output, count + 1)));
+        BOOST_CHECK_EQUAL(n, count);
+        BOOST_CHECK(output.size() == expected_output.size());
+        BOOST_CHECK(std::equal(output.begin(), output.end(), expected_output.begin(),
+                               bgi::equal_to<value_t>()));
+    }
+
+    // stopped after the first value
+    {
+        std::size_t n = tree.query(predicates, bgi::callback(any_value<value_t>));
+        BOOST_CHECK_EQUAL(n, (std::min)(count, std::size_t(1)));
+    }
+
+    // stopped after half of the values, the same values as in the first part of the output
+    {
+        std::size_t const half = (count + 1) / 2;
+        std::vector<value_t> output;
+        std::size_t n = tree.query(predicates, bgi::callback(collect<value_t>(output, half)));
+        BOOST_CHECK_EQUAL(n, half);
+        BOOST_CHECK_EQUAL(output.size(), half);
+        BOOST_CHECK(std::equal(output.begin(), output.end(), expected_output.begin(),
+                               bgi::equal_to<value_t>()));
+    }
+}
+
+template <typename Value, typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+    typedef bgi::rtree_view<Value, Params> view_t;
+    typedef bgi::concurrent_rtree<Value, Params> concurrent_t;
+    typedef typename rtree_t::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    std::vector<Value> values;
+    generate::values(values, 1000);
+
+    rtree_t tree(values, params);
+
+    box_t const qbox(generate::value<point_t>::apply(10, 10), generate::value<point_t>::apply(40, 30));
+    box_t const empty_box(generate::value<point_t>::apply(200, 200), generate::value<point_t>::apply(300, 300));
+    point_t const qpt = generate::value<point_t>::apply(50, 50);
+
+    test_callback<Value>(tree, bgi::intersects(qbox));
+    test_callback<Value>(tree, bgi::intersects(empty_box));
+    test_callback<Value>(tree, bgi::within(qbox) && !bgi::covered_by(empty_box));
+    test_callback<Value>(tree, bgi::nearest(qpt, 10));
+    test_callback<Value>(tree, bgi::nearest(qpt, 10) && bgi::intersects(qbox));
+    test_callback<Value>(rtree_t(params), bgi::intersects(qbox));
+
+    // the flat layout
+    std::ostringstream oss;
+    bgi::write_flat(tree, oss);
+    basictest::flat_buffer const buffer(oss.str());
+    view_t view(buffer.data(), buffer.size(), params);
+
+    test_callback<Value>(view, bgi::intersects(qbox));
+    test_callback<Value>(view, bgi::nearest(qpt, 10));
+
+    // the snapshot of concurrent rtree
+    concurrent_t concurrent(params);
+    concurrent.insert(values.begin(), values.end());
+    test_callback<Value>(concurrent.get_snapshot(), bgi::intersects(qbox));
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    test_rtree<point_t, bgi::linear<4, 2> >();
+    test_rtree<box_t, bgi::quadratic<8, 3> >();
+    test_rtree<std::pair<point_t, int>, bgi::rstar<16, 4> >();
+    test_rtree<point_t>(bgi::dynamic_rstar(5, 2));
+
+    return 0;
+}
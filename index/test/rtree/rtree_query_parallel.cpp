@@ -0,0 +1,133 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+struct is_even
+{
+    template <typename Point>
+    static bool check(Point const& p)
+    {
+        return static_cast<int>(bg::get<0>(p)) % 2 == 0;
+    }
+
+    template <typename Point>
+    bool operator()(Point const& p) const { return check(p); }
+
+    template <typename Point>
+    bool operator()(bg::model::box<Point> const& b) const { return check(b.min_corner()); }
+
+    template <typename Point>
+    bool operator()(std::pair<Point, int> const& v) const { return check(v.first); }
+};
+
+template <typename Value>
+struct stop_after
+{
+    stop_after(std::size_t c, std::vector<Value> & r) : count(c), result(&r) {}
+    bool operator()(Value const& v) const
+    {
+        result->push_back(v);
+        return result->size() < count;
+    }
+    std::size_t count;
+    std::vector<Value> * result;
+};
+
+template <typename Rtree, typename Predicates>
+void check_query(Rtree const& rt, Predicates const& pred)
+{
+    typedef typename Rtree::value_type value_t;
+
+    std::vector<value_t> expected;
+    std::size_t const expected_count = rt.query(pred, std::back_inserter(expected));
+
+    for ( std::size_t threads = 1 ; threads <= 7 ; threads += 2 )
+    {
+        // the same values in the same order
+        std::vector<value_t> output;
+        BOOST_CHECK(rt.query(pred, std::back_inserter(output), bgi::parallel(threads)) == expected_count);
+        basictest::exactly_the_same_outputs(rt, output, expected);
+
+        // stopped by the callback
+        if ( expected.size() > 1 )
+        {
+            std::size_t const count = expected.size() / 2;
+            output.clear();
+            BOOST_CHECK(rt.query(pred, bgi::callback(stop_after<value_t>(count, output)),
+                                 bgi::parallel(threads)) == count);
+            std::vector<value_t> expected_part(expected.begin(), expected.begin() + count);
+            basictest::exactly_the_same_outputs(rt, output, expected_part);
+        }
+    }
+}
+
+template <typename Value, typename Params>
+void test_query_parallel(Params const& params = Params())
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+    typedef typename rtree_t::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    std::vector<Value> values;
+    generate::values(values, 5000);
+
+    box_t const qbox(generate::value<point_t>::apply(10, 10), generate::value<point_t>::apply(60, 50));
+    box_t const small(generate::value<point_t>::apply(10, 10), generate::value<point_t>::apply(11, 11));
+    box_t const outside(generate::value<point_t>::apply(200, 200), generate::value<point_t>::apply(300, 300));
+    point_t const pt = generate::value<point_t>::apply(30, 30);
+
+    // packed and inserted
+    rtree_t packed(values, params);
+    rtree_t inserted(params);
+    inserted.insert(values.begin(), values.end());
+
+    rtree_t const* trees[] = { &packed, &inserted };
+    for ( int i = 0 ; i < 2 ; ++i )
+    {
+        rtree_t const& rt = *trees[i];
+        check_query(rt, bgi::intersects(qbox));
+        check_query(rt, bgi::intersects(small));
+        check_query(rt, bgi::intersects(outside));
+        check_query(rt, bgi::within(qbox) && bgi::satisfies(is_even()));
+        check_query(rt, !bgi::intersects(qbox));
+        check_query(rt, bgi::covered_by(rt.bounds()));
+
+        // nearest performed sequentially
+        std::vector<Value> output, expected;
+        rt.query(bgi::nearest(pt, 10), std::back_inserter(expected));
+        BOOST_CHECK(rt.query(bgi::nearest(pt, 10), std::back_inserter(output), bgi::parallel(4)) == 10);
+        basictest::exactly_the_same_outputs(rt, output, expected);
+    }
+
+    // a tree containing only the root leaf and an empty tree
+    {
+        rtree_t rt(values.begin(), values.begin() + 2, params);
+        check_query(rt, bgi::intersects(rt.bounds()));
+
+        rtree_t empty(params);
+        std::vector<Value> output;
+        BOOST_CHECK(empty.query(bgi::intersects(qbox), std::back_inserter(output), bgi::parallel(4)) == 0);
+        BOOST_CHECK(output.empty());
+    }
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    test_query_parallel<point_t, bgi::linear<4, 2> >();
+    test_query_parallel<box_t, bgi::quadratic<8, 3> >();
+    test_query_parallel<std::pair<point_t, int>, bgi::rstar<16, 4> >();
+    test_query_parallel<point_t>(bgi::dynamic_rstar(5, 2));
+    test_query_parallel<box_t>(bgi::dynamic_linear(16, 4));
+
+    return 0;
+}
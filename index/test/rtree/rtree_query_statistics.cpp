@@ -0,0 +1,145 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <boost/geometry/index/detail/rtree/utilities/statistics.hpp>
+
+template <typename Rtree, typename Predicates>
+bgi::query_statistics check_query(Rtree const& rt, Predicates const& pred)
+{
+    typedef typename Rtree::value_type value_t;
+
+    std::vector<value_t> expected;
+    rt.query(pred, std::back_inserter(expected));
+
+    // the same result
+    bgi::query_statistics stats;
+    std::vector<value_t> output;
+    BOOST_CHECK(rt.query(pred, std::back_inserter(output), stats) == expected.size());
+    basictest::exactly_the_same_outputs(rt, output, expected);
+    BOOST_CHECK(stats.found == expected.size());
+    BOOST_CHECK(stats.found <= stats.values);
+
+    // the statistics gathered by the query iterator, the neighbors with
+    // the same distances may be returned in different order than by query()
+    bgi::query_statistics it_stats;
+    output.clear();
+    std::copy(rt.qbegin(pred, it_stats), rt.qend(), std::back_inserter(output));
+    BOOST_CHECK(output.size() == expected.size());
+    BOOST_CHECK(it_stats.found == expected.size());
+    BOOST_CHECK(it_stats.found <= it_stats.values);
+    BOOST_CHECK(it_stats.heap_max <= it_stats.heap_pushes);
+
+    return stats;
+}
+
+template <typename Value, typename Params>
+void test_query_statistics(Params const& params = Params())
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+    typedef typename rtree_t::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    std::vector<Value> values;
+    generate::values(values, 3000);
+
+    rtree_t rt(values, params);
+
+    std::size_t levels, nodes, leaves, values_count, values_min, values_max;
+    boost::tie(levels, nodes, leaves, values_count, values_min, values_max)
+        = bgi::detail::rtree::utilities::statistics(rt);
+
+    box_t const all(generate::value<point_t>::apply(-10, -10), generate::value<point_t>::apply(200, 200));
+    box_t const qbox(generate::value<point_t>::apply(10, 10), generate::value<point_t>::apply(40, 30));
+    box_t const outside(generate::value<point_t>::apply(200, 200), generate::value<point_t>::apply(300, 300));
+    point_t const pt = generate::value<point_t>::apply(30, 30);
+
+    // all of the nodes and values are visited
+    {
+        bgi::query_statistics stats = check_query(rt, bgi::intersects(all));
+        BOOST_CHECK(stats.internal_nodes == nodes);
+        BOOST_CHECK(stats.leaves == leaves);
+        BOOST_CHECK(stats.boxes == nodes + leaves - 1);
+        BOOST_CHECK(stats.values == values_count);
+        BOOST_CHECK(stats.found == values.size());
+        BOOST_CHECK(stats.heap_pushes == 0 && stats.heap_max == 0);
+    }
+
+    // only some of the nodes are visited
+    {
+        bgi::query_statistics stats = check_query(rt, bgi::intersects(qbox));
+        BOOST_CHECK(0 < stats.leaves && stats.leaves < leaves);
+        BOOST_CHECK(stats.values < values_count);
+        BOOST_CHECK(stats.heap_pushes == 0 && stats.heap_max == 0);
+    }
+
+    // only the children of the root are tested
+    {
+        bgi::query_statistics stats = check_query(rt, bgi::intersects(outside));
+        BOOST_CHECK(stats.internal_nodes == 1);
+        BOOST_CHECK(stats.leaves == 0);
+        BOOST_CHECK(stats.boxes <= rt.parameters().get_max_elements());
+        BOOST_CHECK(stats.values == 0 && stats.found == 0);
+    }
+
+    // knn query
+    {
+        bgi::query_statistics stats = check_query(rt, bgi::nearest(pt, 10));
+        BOOST_CHECK(stats.found == 10);
+        BOOST_CHECK(0 < stats.heap_pushes && stats.heap_pushes < nodes + leaves);
+        BOOST_CHECK(0 < stats.heap_max && stats.heap_max <= stats.heap_pushes);
+        BOOST_CHECK(stats.leaves < leaves);
+
+        check_query(rt, bgi::nearest(pt, 10) && bgi::intersects(qbox));
+    }
+
+    // the counters are accumulated
+    {
+        bgi::query_statistics stats;
+        std::vector<Value> output;
+        rt.query(bgi::intersects(qbox), std::back_inserter(output), stats);
+        bgi::query_statistics const first = stats;
+        rt.query(bgi::intersects(qbox), std::back_inserter(output), stats);
+        BOOST_CHECK(stats.internal_nodes == 2 * first.internal_nodes);
+        BOOST_CHECK(stats.leaves == 2 * first.leaves);
+        BOOST_CHECK(stats.boxes == 2 * first.boxes);
+        BOOST_CHECK(stats.values == 2 * first.values);
+        BOOST_CHECK(stats.found == output.size());
+
+        stats.reset();
+        BOOST_CHECK(stats.internal_nodes == 0 && stats.leaves == 0 && stats.boxes == 0
+                 && stats.values == 0 && stats.found == 0 && stats.heap_pushes == 0 && stats.heap_max == 0);
+    }
+
+    // an empty tree
+    {
+        rtree_t empty(params);
+        bgi::query_statistics stats;
+        std::vector<Value> output;
+        BOOST_CHECK(empty.query(bgi::intersects(all), std::back_inserter(output), stats) == 0);
+        BOOST_CHECK(empty.query(bgi::nearest(pt, 5), std::back_inserter(output), stats) == 0);
+        BOOST_CHECK(empty.qbegin(bgi::nearest(pt, 5), stats) == empty.qend());
+        BOOST_CHECK(stats.internal_nodes == 0 && stats.leaves == 0 && stats.values == 0 && stats.found == 0);
+    }
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    test_query_statistics<point_t, bgi::linear<4, 2> >();
+    test_query_statistics<box_t, bgi::quadratic<8, 3> >();
+    test_query_statistics<std::pair<point_t, int>, bgi::rstar<16, 4> >();
+    test_query_statistics<point_t>(bgi::dynamic_rstar(5, 2));
+    test_query_statistics<box_t>(bgi::dynamic_linear(16, 4));
+
+    return 0;
+}
@@ -0,0 +1,219 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+struct is_odd
+{
+    template <typename P>
+    bool operator()(std::pair<P, int> const& v) const { return v.second % 2 == 1; }
+};
+
+template <typename Rtree, typename Value>
+void check_tree(Rtree const& rt, std::vector<Value> const& values)
+{
+    typedef typename Rtree::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    BOOST_CHECK(rt.size() == values.size());
+    // the root may be removed if all of the values are removed
+    if ( ! rt.empty() )
+    {
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt));
+    }
+
+    std::vector<Value> output(rt.begin(), rt.end());
+    basictest::compare_outputs(rt, output, values);
+
+    box_t const qbox(generate::value<point_t>::apply(10, 10), generate::value<point_t>::apply(40, 30));
+    std::vector<Value> expected_output;
+    output.clear();
+    rt.query(bgi::intersects(qbox), std::back_inserter(output));
+    for ( typename std::vector<Value>::const_iterator it = values.begin() ; it != values.end() ; ++it )
+    {
+        if ( bg::intersects(rt.indexable_get()(*it), qbox) )
+            expected_output.push_back(*it);
+    }
+    basictest::compare_outputs(rt, output, expected_output);
+}
+
+template <typename Rtree, typename Value, typename Predicate>
+void remove_expected(Rtree const& rt, std::vector<Value> & values, Predicate const& pred)
+{
+    std::vector<Value> remaining;
+    for ( typename std::vector<Value>::const_iterator it = values.begin() ; it != values.end() ; ++it )
+    {
+        if ( ! pred(rt.indexable_get()(*it), *it) )
+            remaining.push_back(*it);
+    }
+    values.swap(remaining);
+}
+
+template <typename Box>
+struct intersects_box
+{
+    explicit intersects_box(Box const& b) : box(b) {}
+    template <typename I, typename V>
+    bool operator()(I const& i, V const&) const { return bg::intersects(i, box); }
+    Box box;
+};
+
+template <typename Box>
+struct intersects_box_and_odd
+{
+    explicit intersects_box_and_odd(Box const& b) : box(b) {}
+    template <typename I, typename V>
+    bool operator()(I const& i, V const& v) const { return bg::intersects(i, box) && is_odd()(v); }
+    Box box;
+};
+
+template <typename Rtree>
+void test_remove_regions(Rtree & rt, std::vector<typename Rtree::value_type> values)
+{
+    typedef typename Rtree::value_type value_t;
+    typedef typename Rtree::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    check_tree(rt, values);
+
+    // nothing removed
+    box_t const outside(generate::value<point_t>::apply(200, 200), generate::value<point_t>::apply(300, 300));
+    BOOST_CHECK(rt.remove_if(bgi::intersects(outside)) == 0);
+    check_tree(rt, values);
+
+    // subsequent regions
+    for ( int i = 0 ; i < 5 ; ++i )
+    {
+        box_t const b(generate::value<point_t>::apply(i * 20, 10), generate::value<point_t>::apply(i * 20 + 25, 60));
+        std::size_t const size = values.size();
+        remove_expected(rt, values, intersects_box<box_t>(b));
+        BOOST_CHECK(bgi::remove_if(rt, bgi::intersects(b)) == size - values.size());
+        check_tree(rt, values);
+    }
+
+    // everything left
+    box_t const all(generate::value<point_t>::apply(-10, -10), generate::value<point_t>::apply(200, 200));
+    std::size_t const size = values.size();
+    BOOST_CHECK(rt.remove_if(bgi::intersects(all)) == size);
+    values.clear();
+    check_tree(rt, values);
+    BOOST_CHECK(rt.empty());
+    BOOST_CHECK(rt.remove_if(bgi::intersects(all)) == 0);
+
+    // the tree is usable afterwards
+    value_t const v = generate::value<value_t>::apply(1, 2);
+    rt.insert(v);
+    values.push_back(v);
+    check_tree(rt, values);
+}
+
+template <typename Value, typename Params>
+void test_remove_if(Params const& params = Params())
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+    typedef typename rtree_t::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    std::vector<Value> values;
+    generate::values(values, 2000);
+
+    // packed
+    {
+        rtree_t rt(values, params);
+        test_remove_regions(rt, values);
+    }
+
+    // inserted
+    {
+        rtree_t rt(params);
+        rt.insert(values.begin(), values.end());
+        test_remove_regions(rt, values);
+    }
+
+    // the same values as removed one by one
+    {
+        box_t const b(generate::value<point_t>::apply(5, 5), generate::value<point_t>::apply(60, 70));
+        rtree_t rt(values, params);
+        rtree_t rt2(values, params);
+        std::vector<Value> removed;
+        rt2.query(bgi::intersects(b), std::back_inserter(removed));
+        BOOST_CHECK(rt2.remove(removed) == removed.size());
+        BOOST_CHECK(rt.remove_if(bgi::intersects(b)) == removed.size());
+        std::vector<Value> expected(rt2.begin(), rt2.end());
+        check_tree(rt, expected);
+    }
+
+    // the tree containing few values
+    {
+        std::vector<Value> few(values.begin(), values.begin() + 3);
+        rtree_t rt(few, params);
+        box_t const b(generate::value<point_t>::apply(0, 0), generate::value<point_t>::apply(200, 200));
+        BOOST_CHECK(rt.remove_if(bgi::intersects(b)) == 3);
+        few.clear();
+        check_tree(rt, few);
+    }
+}
+
+template <typename Params>
+void test_remove_if_satisfies(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef std::pair<point_t, int> value_t;
+    typedef bgi::rtree<value_t, Params> rtree_t;
+
+    std::vector<value_t> values;
+    for ( int i = 0 ; i < 3000 ; ++i )
+        values.push_back(value_t(point_t((i * 7919) % 101, (i * 104729) % 97), i));
+
+    rtree_t rt(values, params);
+
+    box_t const b(point_t(10, 10), point_t(70, 50));
+    std::size_t const size = values.size();
+    remove_expected(rt, values, intersects_box_and_odd<box_t>(b));
+    BOOST_CHECK(rt.remove_if(bgi::intersects(b) && bgi::satisfies(is_odd())) == size - values.size());
+    check_tree(rt, values);
+
+    // all odd values
+    std::size_t const size2 = values.size();
+    std::vector<value_t> remaining;
+    for ( std::size_t i = 0 ; i < values.size() ; ++i )
+        if ( values[i].second % 2 == 0 )
+            remaining.push_back(values[i]);
+    BOOST_CHECK(rt.remove_if(bgi::satisfies(is_odd())) == size2 - remaining.size());
+    check_tree(rt, remaining);
+
+    // the values not intersecting the box
+    values.clear();
+    for ( std::size_t i = 0 ; i < remaining.size() ; ++i )
+        if ( bg::intersects(remaining[i].first, b) )
+            values.push_back(remaining[i]);
+    BOOST_CHECK(rt.remove_if(!bgi::intersects(b)) == remaining.size() - values.size());
+    check_tree(rt, values);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    test_remove_if<point_t, bgi::linear<4, 2> >();
+    test_remove_if<box_t, bgi::quadratic<8, 3> >();
+    test_remove_if<std::pair<point_t, int>, bgi::rstar<4, 2> >();
+    test_remove_if<point_t, bgi::rstar<16, 4> >();
+    test_remove_if<point_t>(bgi::dynamic_rstar(5, 2));
+    test_remove_if<box_t>(bgi::dynamic_linear(16, 4));
+
+    test_remove_if_satisfies(bgi::rstar<4, 2>());
+    test_remove_if_satisfies(bgi::dynamic_quadratic(8, 3));
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include <boost/geometry/index/rtree_view.hpp>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+template <typename Rtree, typename View, typename Box>
+void test_view_queries(Rtree const& rtree, View const& view, Box const& qbox)
+{
+    typedef typename Rtree::value_type value_t;
+    typedef typename bg::point_type<Box>::type point_t;
+
+    BOOST_CHECK(view.size() == rtree.size());
+    BOOST_CHECK(view.empty() == rtree.empty());
+    BOOST_CHECK(view.depth() == bgi::detail::rtree::utilities::view<Rtree>(rtree).depth());
+    if ( !rtree.empty() )
+        BOOST_CHECK(bg::equals(view.bounds(), rtree.bounds()));
+
+    std::vector<value_t> all(view.begin(), view.end());
+    std::vector<value_t> expected_all(rtree.begin(), rtree.end());
+    basictest::exactly_the_same_outputs(rtree, all, expected_all);
+
+    // the values are visited in the same order
+    {
+        std::vector<value_t> output, expected_output;
+        size_t n = view.query(bgi::intersects(qbox), std::back_inserter(output));
+        rtree.query(bgi::intersects(qbox), std::back_inserter(expected_output));
+        BOOST_CHECK(n == output.size());
+        basictest::exactly_the_same_outputs(rtree, output, expected_output);
+
+        std::vector<value_t> output2;
+        std::copy(view.qbegin(bgi::intersects(qbox)), view.qend(), std::back_inserter(output2));
+        basictest::exactly_the_same_outputs(rtree, output2, expected_output);
+
+        basictest::check_fwd_iterators(view.qbegin(bgi::intersects(qbox)), view.qend());
+    }
+
+    {
+        std::vector<value_t> output, expected_output;
+        view.query(bgi::disjoint(qbox), std::back_inserter(output));
+        rtree.query(bgi::disjoint(qbox), std::back_inserter(expected_output));
+        basictest::exactly_the_same_outputs(rtree, output, expected_output);
+    }
+
+    {
+        std::vector<value_t> output, expected_output;
+        view.query(bgi::within(qbox), std::back_inserter(output));
+        rtree.query(bgi::within(qbox), std::back_inserter(expected_output));
+        basictest::exactly_the_same_outputs(rtree, output, expected_output);
+    }
+
+    {
+        std::vector<value_t> output, expected_output;
+        view.query(bgi::intersects(qbox.max_corner()), std::back_inserter(output));
+        rtree.query(bgi::intersects(qbox.max_corner()), std::back_inserter(expected_output));
+        basictest::exactly_the_same_outputs(rtree, output, expected_output);
+    }
+
+    point_t const pts[2] = { qbox.min_corner(), generate::outside_point<point_t>::apply() };
+    unsigned const ks[3] = { 1, 7, static_cast<unsigned>(rtree.size() + 1) };
+    for ( size_t i = 0 ; i < 2 ; ++i )
+    {
+        for ( size_t j = 0 ; j < 3 ; ++j )
+        {
+            std::vector<value_t> output, output2, expected_output;
+            size_t n = view.query(bgi::nearest(pts[i], ks[j]), std::back_inserter(output));
+            rtree.query(bgi::nearest(pts[i], ks[j]), std::back_inserter(expected_output));
+            BOOST_CHECK(n == output.size());
+            BOOST_CHECK(output.size() == expected_output.size());
+            if ( output.size() != expected_output.size() )
+                continue;
+
+            std::copy(view.qbegin(bgi::nearest(pts[i], ks[j])), view.qend(), std::back_inserter(output2));
+            BOOST_CHECK(output2.size() == expected_output.size());
+            basictest::check_sorted_by_distance(rtree, output2, pts[i]);
+
+            // values may differ if distances are equal
+            if ( !expected_output.empty() )
+            {
+                double greatest_distance = 0;
+                for ( size_t k = 0 ; k < expected_output.size() ; ++k )
+                    greatest_distance = (std::max)(greatest_distance,
+                        double(bg::comparable_distance(pts[i], rtree.indexable_get()(expected_output[k]))));
+                basictest::compare_nearest_outputs(rtree, output, expected_output, pts[i], greatest_distance);
+                basictest::compare_nearest_outputs(rtree, output2, expected_output, pts[i], greatest_distance);
+            }
+
+            basictest::check_fwd_iterators(view.qbegin(bgi::nearest(pts[i], ks[j])), view.qend());
+        }
+    }
+
+    {
+        std::vector<value_t> output, expected_output;
+        view.query(bgi::nearest(qbox, 5) && bgi::intersects(qbox), std::back_inserter(output));
+        rtree.query(bgi::nearest(qbox, 5) && bgi::intersects(qbox), std::back_inserter(expected_output));
+        BOOST_CHECK(output.size() == expected_output.size());
+    }
+}
+
+template <typename Value, typename Params, typename Order>
+void test_rtree_view(Params const& params, Order const& order)
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+    typedef bgi::rtree_view<Value, Params> view_t;
+    typedef typename rtree_t::bounds_type box_t;
+
+    rtree_t rtree(params);
+    std::vector<Value> input;
+    box_t qbox;
+    generate::rtree(rtree, input, qbox);
+
+    std::ostringstream oss;
+    bgi::write_flat(rtree, oss, order);
+    BOOST_CHECK(oss.good());
+    std::string const str = oss.str();
+
+    // in-memory buffer
+    {
+        basictest::flat_buffer const buffer(str);
+
+        view_t view(buffer.data(), buffer.size(), params);
+        BOOST_CHECK(view.is_valid());
+        test_view_queries(rtree, view, qbox);
+
+        // truncated data
+        BOOST_CHECK_THROW(view_t(buffer.data(), buffer.size() - 1, params), std::invalid_argument);
+        // misaligned data
+        BOOST_CHECK_THROW(view_t(static_cast<char const*>(buffer.data()) + 1, buffer.size() - 1, params),
+                          std::invalid_argument);
+        // different type
+        typedef bg::model::point<float, 2, bg::cs::cartesian> pointf_t;
+        BOOST_CHECK_THROW((bgi::rtree_view<pointf_t, Params>(buffer.data(), buffer.size(), params)),
+                          std::invalid_argument);
+
+        // corrupted nodes referring to nodes or values outside the data
+        {
+            namespace flat = bgi::detail::rtree::flat;
+            flat::header const h = *static_cast<flat::header const*>(buffer.data());
+
+            basictest::flat_buffer corrupted(buffer);
+            flat::node_entry * nodes = reinterpret_cast<flat::node_entry*>(
+                static_cast<char*>(corrupted.data()) + h.nodes_offset);
+            nodes[0].count = (std::numeric_limits<boost::uint32_t>::max)();
+            BOOST_CHECK(! view_t(corrupted.data(), corrupted.size(), params).is_valid());
+
+            corrupted = buffer;
+            nodes = reinterpret_cast<flat::node_entry*>(
+                static_cast<char*>(corrupted.data()) + h.nodes_offset);
+            nodes[h.nodes_count - 1].first = (std::numeric_limits<boost::uint64_t>::max)() - 1;
+            BOOST_CHECK(! view_t(corrupted.data(), corrupted.size(), params).is_valid());
+        }
+    }
+
+    // memory-mapped file
+    {
+        namespace bip = boost::interprocess;
+        char const* const filename = "rtree_view_test.bin";
+        {
+            std::ofstream ofs(filename, std::ios::binary);
+            bgi::write_flat(rtree, ofs, order);
+            BOOST_CHECK(ofs.good());
+        }
+        {
+            bip::file_mapping file(filename, bip::read_only);
+            bip::mapped_region region(file, bip::read_only);
+
+            view_t view(region.get_address(), region.get_size(), params);
+            test_view_queries(rtree, view, qbox);
+        }
+        std::remove(filename);
+    }
+
+    // empty rtree
+    {
+        rtree_t empty(params);
+        std::ostringstream eoss;
+        bgi::write_flat(empty, eoss, order);
+        basictest::flat_buffer const buffer(eoss.str());
+
+        view_t view(buffer.data(), buffer.size(), params);
+        test_view_queries(empty, view, qbox);
+
+        view_t default_view(params);
+        BOOST_CHECK(default_view.empty());
+        BOOST_CHECK(default_view.qbegin(bgi::intersects(qbox)) == default_view.qend());
+    }
+}
+
+template <typename Params>
+void test_rtree_view_all(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point3_t;
+    typedef bg::model::box<point3_t> box3_t;
+
+    test_rtree_view<point_t>(params, bgi::level_order());
+    test_rtree_view<std::pair<box_t, int> >(params, bgi::level_order());
+    test_rtree_view<point3_t>(params, bgi::level_order());
+    test_rtree_view<std::pair<box3_t, int> >(params, bgi::level_order());
+
+    test_rtree_view<point_t>(params, bgi::van_emde_boas_order());
+    test_rtree_view<std::pair<box_t, int> >(params, bgi::van_emde_boas_order());
+    test_rtree_view<point3_t>(params, bgi::van_emde_boas_order());
+    test_rtree_view<std::pair<box3_t, int> >(params, bgi::van_emde_boas_order());
+}
+
+int test_main(int, char* [])
+{
+    test_rtree_view_all< bgi::linear<5, 2> >();
+    test_rtree_view_all< bgi::quadratic<16, 4> >();
+    test_rtree_view_all< bgi::rstar<4> >();
+
+    test_rtree_view_all(bgi::dynamic_rstar(8, 3));
+
+    return 0;
+}
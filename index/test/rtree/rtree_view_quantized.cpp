@@ -0,0 +1,219 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+#include <boost/geometry/index/rtree_view.hpp>
+
+struct get_id
+{
+    template <typename Indexable>
+    unsigned operator()(std::pair<Indexable, unsigned> const& v) const { return v.second; }
+};
+
+// The exact check performed for the candidates
+template <typename Values, typename Box>
+struct exact_intersects
+{
+    exact_intersects(Values const& v, Box const& b) : values(&v), box(b) {}
+    bool operator()(unsigned id) const { return bg::intersects((*values)[id].first, box); }
+    Values const* values;
+    Box box;
+};
+
+template <typename Value, typename Predicate>
+std::vector<unsigned> expected_ids(std::vector<Value> const& values, Predicate const& pred)
+{
+    std::vector<unsigned> result;
+    for ( std::size_t i = 0 ; i < values.size() ; ++i )
+    {
+        if ( pred(values[i].first) )
+            result.push_back(values[i].second);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+template <typename Geometry>
+struct intersects_pred
+{
+    explicit intersects_pred(Geometry const& g) : geometry(g) {}
+    template <typename Indexable>
+    bool operator()(Indexable const& i) const { return bg::intersects(i, geometry); }
+    Geometry geometry;
+};
+
+template <typename Geometry>
+struct covers_pred
+{
+    explicit covers_pred(Geometry const& g) : geometry(g) {}
+    template <typename Indexable>
+    bool operator()(Indexable const& i) const { return bg::covered_by(geometry, i); }
+    Geometry geometry;
+};
+
+// All of the expected ids are found
+bool includes(std::vector<unsigned> output, std::vector<unsigned> const& expected)
+{
+    std::sort(output.begin(), output.end());
+    return std::includes(output.begin(), output.end(), expected.begin(), expected.end());
+}
+
+template <typename View, typename Rtree, typename Value>
+void test_view_queries(View const& view, Rtree const& rtree, std::vector<Value> const& values)
+{
+    typedef typename Rtree::bounds_type box_t;
+    typedef typename bg::point_type<box_t>::type point_t;
+
+    BOOST_CHECK(view.size() == rtree.size());
+    BOOST_CHECK(view.empty() == rtree.empty());
+    BOOST_CHECK(view.depth() == bgi::detail::rtree::utilities::view<Rtree>(rtree).depth());
+    if ( rtree.empty() )
+        return;
+
+    BOOST_CHECK(bg::equals(view.bounds(), rtree.bounds()));
+
+    std::vector<unsigned> all(view.begin(), view.end());
+    std::sort(all.begin(), all.end());
+    BOOST_CHECK(all == expected_ids(values, intersects_pred<box_t>(rtree.bounds())));
+
+    box_t const qboxes[3] = { box_t(point_t(10, 10), point_t(40, 30)),
+                              box_t(point_t(20.05, 20.05), point_t(20.1, 20.1)),
+                              box_t(point_t(200, 200), point_t(300, 300)) };
+    for ( int i = 0 ; i < 3 ; ++i )
+    {
+        box_t const& qbox = qboxes[i];
+        std::vector<unsigned> const expected = expected_ids(values, intersects_pred<box_t>(qbox));
+
+        // the candidates contain all of the values
+        std::vector<unsigned> output;
+        std::size_t n = view.query(bgi::intersects(qbox), std::back_inserter(output));
+        BOOST_CHECK(n == output.size());
+        BOOST_CHECK(includes(output, expected));
+
+        output.clear();
+        view.query(!bgi::disjoint(qbox), std::back_inserter(output));
+        BOOST_CHECK(includes(output, expected));
+
+        // the exact check performed for the candidates
+        output.clear();
+        view.query(bgi::intersects(qbox) && bgi::satisfies(exact_intersects<std::vector<Value>, box_t>(values, qbox)),
+                   std::back_inserter(output));
+        std::sort(output.begin(), output.end());
+        BOOST_CHECK(output == expected);
+    }
+
+    point_t const pt(20.07, 20.07);
+    std::vector<unsigned> output;
+    view.query(bgi::contains(pt), std::back_inserter(output));
+    BOOST_CHECK(includes(output, expected_ids(values, covers_pred<point_t>(pt))));
+}
+
+template <unsigned Bits, typename Indexable, typename Params, typename Order>
+void test_quantized_view(Params const& params, Order const& order)
+{
+    typedef std::pair<Indexable, unsigned> value_t;
+    typedef bgi::rtree<value_t, Params> rtree_t;
+    typedef bgi::quantized_rtree_view<Indexable, Params, bgi::quantized<Bits> > view_t;
+
+    std::vector<value_t> values;
+    for ( unsigned i = 0 ; i < 3000 ; ++i )
+    {
+        double const x = (i * 7919 % 10007) / 100.0;
+        double const y = (i * 104729 % 10009) / 100.0;
+        values.push_back(value_t(generate::value<Indexable>::apply(x, y), i));
+    }
+
+    rtree_t rtree(values, params);
+
+    std::ostringstream oss;
+    bgi::write_flat(rtree, oss, bgi::quantized<Bits>(), get_id(), order);
+    BOOST_CHECK(oss.good());
+    std::string const str = oss.str();
+
+    // the data is smaller than in the full precision layout
+    std::ostringstream full;
+    bgi::write_flat(rtree, full);
+    BOOST_CHECK(str.size() < full.str().size());
+
+    basictest::flat_buffer const buffer(str);
+
+    view_t view(buffer.data(), buffer.size(), params);
+    BOOST_CHECK(view.is_valid());
+    test_view_queries(view, rtree, values);
+
+    // truncated data
+    BOOST_CHECK_THROW(view_t(buffer.data(), buffer.size() - 1, params), std::invalid_argument);
+    // different quantization
+    typedef bgi::quantized_rtree_view<Indexable, Params, bgi::quantized<Bits == 8 ? 16 : 8> > other_view_t;
+    BOOST_CHECK_THROW(other_view_t(buffer.data(), buffer.size(), params), std::invalid_argument);
+    // the full precision layout
+    {
+        basictest::flat_buffer const fbuffer(full.str());
+        BOOST_CHECK_THROW(view_t(fbuffer.data(), fbuffer.size(), params), std::invalid_argument);
+    }
+    // corrupted nodes referring to nodes or values outside the data
+    {
+        namespace flat = bgi::detail::rtree::flat;
+        flat::quantized_header const h = *static_cast<flat::quantized_header const*>(buffer.data());
+
+        basictest::flat_buffer corrupted(buffer);
+        flat::node_entry * nodes = reinterpret_cast<flat::node_entry*>(
+            static_cast<char*>(corrupted.data()) + h.nodes_offset);
+        nodes[0].count = (std::numeric_limits<boost::uint32_t>::max)();
+        BOOST_CHECK(! view_t(corrupted.data(), corrupted.size(), params).is_valid());
+
+        corrupted = buffer;
+        nodes = reinterpret_cast<flat::node_entry*>(
+            static_cast<char*>(corrupted.data()) + h.nodes_offset);
+        nodes[h.nodes_count - 1].first = (std::numeric_limits<boost::uint64_t>::max)() - 1;
+        BOOST_CHECK(! view_t(corrupted.data(), corrupted.size(), params).is_valid());
+    }
+
+    // empty rtree
+    {
+        rtree_t empty(params);
+        std::ostringstream eoss;
+        bgi::write_flat(empty, eoss, bgi::quantized<Bits>(), get_id(), order);
+        basictest::flat_buffer const ebuffer(eoss.str());
+
+        view_t eview(ebuffer.data(), ebuffer.size(), params);
+        test_view_queries(eview, empty, std::vector<value_t>());
+
+        view_t default_view(params);
+        BOOST_CHECK(default_view.empty());
+    }
+}
+
+template <typename Params>
+void test_quantized_view_all(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef bg::model::point<float, 2, bg::cs::cartesian> pointf_t;
+
+    test_quantized_view<16, point_t>(params, bgi::level_order());
+    test_quantized_view<16, box_t>(params, bgi::level_order());
+    test_quantized_view<8, box_t>(params, bgi::level_order());
+    test_quantized_view<8, pointf_t>(params, bgi::van_emde_boas_order());
+    test_quantized_view<16, box_t>(params, bgi::van_emde_boas_order());
+}
+
+int test_main(int, char* [])
+{
+    test_quantized_view_all< bgi::linear<5, 2> >();
+    test_quantized_view_all< bgi::rstar<16, 4> >();
+    test_quantized_view_all(bgi::dynamic_quadratic(8, 3));
+
+    return 0;
+}
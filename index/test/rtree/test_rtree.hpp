@@ -14,9 +14,12 @@
 #ifndef BOOST_GEOMETRY_INDEX_TEST_RTREE_HPP
 #define BOOST_GEOMETRY_INDEX_TEST_RTREE_HPP
 
+#include <boost/cstdint.hpp>
 #include <boost/foreach.hpp>
 #include <vector>
 #include <algorithm>
+#include <cstring>
+#include <string>
 
 #include <geometry_index_test_common.hpp>
 
@@ -679,10 +682,45 @@ void rtree(Rtree & tree, Elements & input, Box & qbox)
     tree.insert(input.begin(), input.end());
 }
 
+// generate values of pseudo-random coordinates, x in [0, x_range) and y in [0, y_range)
+
+template <typename Value>
+inline void values(std::vector<Value> & output, std::size_t count,
+                   int x_range = 101, int y_range = 97)
+{
+    for ( std::size_t i = 0 ; i < count ; ++i )
+    {
+        int const x = static_cast<int>(i * 7919 % x_range);
+        int const y = static_cast<int>(i * 104729 % y_range);
+        output.push_back(generate::value<Value>::apply(x, y));
+    }
+}
+
 } // namespace generate
 
 namespace basictest {
 
+// the data of the flat layout copied into the memory aligned for rtree_view
+
+class flat_buffer
+{
+public:
+    explicit flat_buffer(std::string const& str)
+        : m_buffer(str.size() / sizeof(boost::uint64_t) + 1)
+        , m_size(str.size())
+    {
+        std::memcpy(&m_buffer[0], str.data(), str.size());
+    }
+
+    void * data() { return &m_buffer[0]; }
+    void const* data() const { return &m_buffer[0]; }
+    std::size_t size() const { return m_size; }
+
+private:
+    std::vector<boost::uint64_t> m_buffer;
+    std::size_t m_size;
+};
+
 // low level test functions
 
 template <typename Rtree, typename Iter, typename Value>
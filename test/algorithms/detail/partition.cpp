@@ -647,6 +647,123 @@ void test_heterogenuous_collections(int seed1, int seed2, int size, int count)
     BOOST_CHECK_EQUAL(visitor2.count, expected_count);
 }
 
+// Records the ids of the intersecting boxes in the order of visiting,
+// the process is interrupted when the pair of the ids given is visited
+struct recording_visitor
+{
+    std::vector<std::pair<int, int> > pairs;
+    std::pair<int, int> stop;
+
+    recording_visitor()
+        : stop(-1, -1)
+    {}
+
+    template <typename Item1, typename Item2>
+    inline bool apply(Item1 const& item1, Item2 const& item2)
+    {
+        if (bg::intersects(item1.box, item2.box))
+        {
+            pairs.push_back(std::make_pair(item1.id, item2.id));
+        }
+        return std::make_pair(item1.id, item2.id) != stop;
+    }
+
+    recording_visitor clone() const
+    {
+        recording_visitor result;
+        result.stop = stop;
+        return result;
+    }
+
+    void merge(recording_visitor& other)
+    {
+        pairs.insert(pairs.end(), other.pairs.begin(), other.pairs.end());
+    }
+};
+
+void test_parallel(int seed1, int seed2, int size, int count)
+{
+    typedef bg::model::box<point_item> box_type;
+    typedef bg::partition
+        <
+            box_type,
+            bg::detail::partition::include_all_policy,
+            bg::detail::partition::include_all_policy
+        > partition_type;
+
+    std::vector<box_item<box_type> > boxes1, boxes2;
+    fill_boxes(boxes1, seed1, size, count);
+    fill_boxes(boxes2, seed2, size, count);
+
+    for (std::size_t min_elements = 2; min_elements <= 32; min_elements *= 4)
+    {
+        // One range
+        recording_visitor expected;
+        partition_type::apply(boxes1, expected, get_box(), ovelaps_box(),
+                              min_elements);
+        BOOST_CHECK(! expected.pairs.empty());
+
+        // Two ranges
+        recording_visitor expected2;
+        partition_type::apply(boxes1, boxes2, expected2, get_box(), ovelaps_box(),
+                              get_box(), ovelaps_box(), min_elements);
+        BOOST_CHECK(! expected2.pairs.empty());
+
+        // Interrupted in the middle
+        recording_visitor expected_stop;
+        expected_stop.stop = expected.pairs[expected.pairs.size() / 2];
+        BOOST_CHECK(! partition_type::apply(boxes1, expected_stop, get_box(), ovelaps_box(),
+                                            min_elements));
+
+        recording_visitor expected_stop2;
+        expected_stop2.stop = expected2.pairs[expected2.pairs.size() / 2];
+        BOOST_CHECK(! partition_type::apply(boxes1, boxes2, expected_stop2,
+                                            get_box(), ovelaps_box(),
+                                            get_box(), ovelaps_box(), min_elements));
+
+        for (std::size_t threads = 1; threads <= 8; threads *= 2)
+        {
+            // The pairs are visited in the same order
+            recording_visitor visitor;
+            BOOST_CHECK(partition_type::apply_parallel(boxes1, visitor,
+                                                       get_box(), ovelaps_box(),
+                                                       threads, min_elements));
+            BOOST_CHECK(visitor.pairs == expected.pairs);
+
+            recording_visitor visitor2;
+            BOOST_CHECK(partition_type::apply_parallel(boxes1, boxes2, visitor2,
+                                                       get_box(), ovelaps_box(),
+                                                       get_box(), ovelaps_box(),
+                                                       threads, min_elements));
+            BOOST_CHECK(visitor2.pairs == expected2.pairs);
+
+            // The process is interrupted at the same pair
+            recording_visitor visitor_stop;
+            visitor_stop.stop = expected_stop.stop;
+            BOOST_CHECK(! partition_type::apply_parallel(boxes1, visitor_stop,
+                                                         get_box(), ovelaps_box(),
+                                                         threads, min_elements));
+            BOOST_CHECK(visitor_stop.pairs == expected_stop.pairs);
+
+            recording_visitor visitor_stop2;
+            visitor_stop2.stop = expected_stop2.stop;
+            BOOST_CHECK(! partition_type::apply_parallel(boxes1, boxes2, visitor_stop2,
+                                                         get_box(), ovelaps_box(),
+                                                         get_box(), ovelaps_box(),
+                                                         threads, min_elements));
+            BOOST_CHECK(visitor_stop2.pairs == expected_stop2.pairs);
+        }
+    }
+
+    // Less elements than min_elements
+    std::vector<box_item<box_type> > few(boxes1.begin(), boxes1.begin() + 10);
+    recording_visitor expected;
+    partition_type::apply(few, expected, get_box(), ovelaps_box());
+    recording_visitor visitor;
+    partition_type::apply_parallel(few, visitor, get_box(), ovelaps_box(), 4);
+    BOOST_CHECK(visitor.pairs == expected.pairs);
+}
+
 int test_main( int , char* [] )
 {
     test_all<bg::model::d2::point_xy<double> >();
@@ -671,5 +788,8 @@ int test_main( int , char* [] )
 
     test_heterogenuous_collections(67890, 98765, 20, 60);
 
+    test_parallel(12345, 54321, 40, 400);
+    test_parallel(67890, 98765, 100, 2000);
+
     return 0;
 }
@@ -0,0 +1,283 @@
+// Boost.Geometry
+// Unit Test Helper
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// The inputs and the comparison of the turns shared by the tests of
+// the intersection strategies wrapping other strategies, e.g. parallel
+// and plane_sweep.
+
+#ifndef BOOST_GEOMETRY_TEST_ALGORITHMS_OVERLAY_GET_TURNS_COMMON_HPP
+#define BOOST_GEOMETRY_TEST_ALGORITHMS_OVERLAY_GET_TURNS_COMMON_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/detail/overlay/self_turn_points.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
+
+
+// The ring with the radius changing along the circle, so the rings
+// with different parameters intersect many times
+template <typename Ring>
+void wavy_ring(Ring& ring, double cx, double cy, double radius,
+               double amplitude, int waves, int count)
+{
+    typedef typename bg::point_type<Ring>::type point_type;
+
+    double const pi = bg::math::pi<double>();
+
+    for (int i = 0; i < count; i++)
+    {
+        double const a = -2.0 * pi * i / count;
+        double const r = radius + amplitude * std::sin(waves * a);
+        bg::append(ring, point_type(cx + r * std::cos(a), cy + r * std::sin(a)));
+    }
+    bg::append(ring, bg::range::front(ring));
+}
+
+// The wavy polygon with an optional wavy hole around the center
+template <typename Polygon>
+Polygon wavy_polygon(double cx, double cy, double radius, double amplitude,
+                     int waves, int count, bool hole)
+{
+    Polygon result;
+    wavy_ring(bg::exterior_ring(result), cx, cy, radius, amplitude, waves, count);
+
+    if (hole)
+    {
+        bg::interior_rings(result).resize(1);
+        wavy_ring(bg::interior_rings(result).back(), cx, cy, radius / 4,
+                  amplitude, waves, count / 4);
+        bg::reverse(bg::interior_rings(result).back());
+    }
+
+    return result;
+}
+
+// Nested bands between contour lines, consisting of many short segments
+template <typename MultiPolygon>
+MultiPolygon contours(double cx, double cy, int rings, int points = 400)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+    MultiPolygon result;
+    for (int i = 0; i < rings; i += 2)
+    {
+        polygon_type polygon;
+        wavy_ring(bg::exterior_ring(polygon), cx, cy, 10.0 * (i + 2), 2, 7 + i, points);
+        bg::interior_rings(polygon).resize(1);
+        wavy_ring(bg::interior_rings(polygon).back(), cx, cy, 10.0 * (i + 1), 2, 11 + i, points);
+        bg::reverse(bg::interior_rings(polygon).back());
+        result.push_back(polygon);
+    }
+    return result;
+}
+
+// Every other cell of a raster converted to polygons, so the cells of
+// one raster touch only at the corners
+template <typename MultiPolygon>
+MultiPolygon raster(double x0, double y0, int cells)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename bg::point_type<MultiPolygon>::type point_type;
+
+    MultiPolygon result;
+    for (int j = 0; j < cells; j++)
+    {
+        for (int i = (j % 2); i < cells; i += 2)
+        {
+            double const x = x0 + i;
+            double const y = y0 + j;
+            polygon_type polygon;
+            bg::append(polygon, point_type(x, y));
+            bg::append(polygon, point_type(x, y + 1));
+            bg::append(polygon, point_type(x + 1, y + 1));
+            bg::append(polygon, point_type(x + 1, y));
+            bg::append(polygon, point_type(x, y));
+            result.push_back(polygon);
+        }
+    }
+    return result;
+}
+
+
+template <typename Geometry>
+struct turn_info_type
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef typename bg::rescale_policy_type<point_type>::type rescale_policy_type;
+    typedef bg::detail::overlay::turn_info
+        <
+            point_type,
+            typename bg::detail::segment_ratio_type<point_type, rescale_policy_type>::type
+        > type;
+};
+
+template <typename Geometry1, typename Geometry2, typename Strategy>
+std::vector<typename turn_info_type<Geometry1>::type>
+    calculate_turns(Geometry1 const& g1, Geometry2 const& g2, Strategy const& strategy)
+{
+    typedef typename turn_info_type<Geometry1>::rescale_policy_type rescale_policy_type;
+
+    rescale_policy_type const rescale_policy
+            = bg::get_rescale_policy<rescale_policy_type>(g1, g2);
+
+    std::vector<typename turn_info_type<Geometry1>::type> turns;
+    bg::detail::get_turns::no_interrupt_policy policy;
+    bg::get_turns<false, false, bg::detail::overlay::assign_null_policy>(
+            g1, g2, strategy, rescale_policy, turns, policy);
+    return turns;
+}
+
+template <typename Geometry, typename Strategy>
+std::vector<typename turn_info_type<Geometry>::type>
+    calculate_self_turns(Geometry const& g, Strategy const& strategy)
+{
+    typedef typename turn_info_type<Geometry>::rescale_policy_type rescale_policy_type;
+
+    rescale_policy_type const rescale_policy
+            = bg::get_rescale_policy<rescale_policy_type>(g);
+
+    std::vector<typename turn_info_type<Geometry>::type> turns;
+    bg::detail::get_turns::no_interrupt_policy policy;
+    bg::self_turns<bg::detail::overlay::assign_null_policy>(
+            g, strategy, rescale_policy, turns, policy);
+    return turns;
+}
+
+struct less_turn
+{
+    template <typename Turn>
+    bool operator()(Turn const& left, Turn const& right) const
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            if (! (left.operations[j].seg_id == right.operations[j].seg_id))
+            {
+                return left.operations[j].seg_id < right.operations[j].seg_id;
+            }
+        }
+        if (bg::get<0>(left.point) != bg::get<0>(right.point))
+        {
+            return bg::get<0>(left.point) < bg::get<0>(right.point);
+        }
+        return bg::get<1>(left.point) < bg::get<1>(right.point);
+    }
+};
+
+// The operations of a turn of a geometry with itself in the order
+// of the segments, the sections of a pair may be visited in any order
+template <typename Turns>
+void normalize_operations(Turns& turns)
+{
+    for (std::size_t i = 0; i < turns.size(); i++)
+    {
+        if (turns[i].operations[1].seg_id < turns[i].operations[0].seg_id)
+        {
+            std::swap(turns[i].operations[0], turns[i].operations[1]);
+        }
+    }
+}
+
+
+#if ! defined(BOOST_GEOMETRY_NO_BOOST_TEST)
+
+// The turns are the same and in the same order
+template <typename Turns>
+void check_equal_turns(Turns const& turns, Turns const& expected)
+{
+    BOOST_CHECK_EQUAL(turns.size(), expected.size());
+    for (std::size_t i = 0; i < turns.size() && i < expected.size(); i++)
+    {
+        BOOST_CHECK(bg::equals(turns[i].point, expected[i].point));
+        BOOST_CHECK(turns[i].method == expected[i].method);
+        for (int j = 0; j < 2; j++)
+        {
+            BOOST_CHECK(turns[i].operations[j].seg_id == expected[i].operations[j].seg_id);
+            BOOST_CHECK(turns[i].operations[j].operation == expected[i].operations[j].operation);
+        }
+    }
+}
+
+// The turns are the same but may be generated in a different order
+template <typename Turns>
+void check_equal_turns_unordered(Turns turns, Turns expected)
+{
+    std::sort(turns.begin(), turns.end(), less_turn());
+    std::sort(expected.begin(), expected.end(), less_turn());
+    check_equal_turns(turns, expected);
+}
+
+// The results of the overlay operations and the predicates calculated with
+// the tested strategy are the same as calculated with the wrapped strategy
+template <typename Geometry1, typename Geometry2, typename Strategy, typename TestedStrategy>
+void check_equal_algorithms(Geometry1 const& g1, Geometry2 const& g2,
+                            Strategy const& strategy,
+                            TestedStrategy const& tested_strategy)
+{
+    typedef typename bg::point_type<Geometry1>::type point_type;
+    typedef bg::model::multi_polygon<bg::model::polygon<point_type> > multi_polygon;
+
+    {
+        multi_polygon expected, result;
+        bg::intersection(g1, g2, expected, strategy);
+        bg::intersection(g1, g2, result, tested_strategy);
+        BOOST_CHECK(! expected.empty());
+        BOOST_CHECK_EQUAL(bg::num_points(result), bg::num_points(expected));
+        BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+    }
+
+    {
+        multi_polygon expected, result;
+        bg::union_(g1, g2, expected, strategy);
+        bg::union_(g1, g2, result, tested_strategy);
+        BOOST_CHECK_EQUAL(bg::num_points(result), bg::num_points(expected));
+        BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+    }
+
+    {
+        multi_polygon expected, result;
+        bg::difference(g1, g2, expected, strategy);
+        bg::difference(g1, g2, result, tested_strategy);
+        BOOST_CHECK_EQUAL(bg::num_points(result), bg::num_points(expected));
+        BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+    }
+
+    {
+        multi_polygon expected, result;
+        bg::sym_difference(g1, g2, expected, strategy);
+        bg::sym_difference(g1, g2, result, tested_strategy);
+        BOOST_CHECK_EQUAL(bg::num_points(result), bg::num_points(expected));
+        BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+    }
+
+    // the full matrix and the predicates which may stop the calculation
+    BOOST_CHECK_EQUAL(bg::relation(g1, g2, tested_strategy).str(),
+                      bg::relation(g1, g2, strategy).str());
+    BOOST_CHECK_EQUAL(bg::intersects(g1, g2, tested_strategy),
+                      bg::intersects(g1, g2, strategy));
+    BOOST_CHECK_EQUAL(bg::touches(g1, g2, tested_strategy),
+                      bg::touches(g1, g2, strategy));
+    BOOST_CHECK_EQUAL(bg::within(g1, g2, tested_strategy),
+                      bg::within(g1, g2, strategy));
+    BOOST_CHECK_EQUAL(bg::relate(g1, g2, bg::de9im::mask("T*F**F***"), tested_strategy),
+                      bg::relate(g1, g2, bg::de9im::mask("T*F**F***"), strategy));
+}
+
+#endif // ! BOOST_GEOMETRY_NO_BOOST_TEST
+
+
+#endif // BOOST_GEOMETRY_TEST_ALGORITHMS_OVERLAY_GET_TURNS_COMMON_HPP
@@ -0,0 +1,155 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <algorithms/overlay/get_turns_common.hpp>
+
+#include <boost/geometry/policies/disjoint_interrupt_policy.hpp>
+#include <boost/geometry/strategies/intersection_parallel.hpp>
+
+
+template <typename Geometry1, typename Geometry2, typename Strategy>
+void test_get_turns(Geometry1 const& g1, Geometry2 const& g2,
+                    Strategy const& strategy, std::size_t threads)
+{
+    bg::strategy::intersection::parallel<Strategy> const parallel_strategy(threads, strategy);
+
+    std::vector<typename turn_info_type<Geometry1>::type> const
+        expected = calculate_turns(g1, g2, strategy);
+
+    BOOST_CHECK(! expected.empty());
+    check_equal_turns(calculate_turns(g1, g2, parallel_strategy), expected);
+}
+
+// Returns true if the process was interrupted at the first turn
+template <typename Geometry, typename Strategy, typename Turns>
+bool interrupted_self_turns(Geometry const& g, Strategy const& strategy, Turns& turns)
+{
+    typedef typename turn_info_type<Geometry>::rescale_policy_type rescale_policy_type;
+
+    rescale_policy_type const rescale_policy
+            = bg::get_rescale_policy<rescale_policy_type>(g);
+
+    bg::detail::disjoint::disjoint_interrupt_policy policy;
+    bg::self_turns<bg::detail::overlay::assign_null_policy>(
+            g, strategy, rescale_policy, turns, policy);
+    return policy.has_intersections;
+}
+
+template <typename Geometry, typename Strategy>
+void test_self_turns(Geometry const& g, Strategy const& strategy, std::size_t threads)
+{
+    bg::strategy::intersection::parallel<Strategy> const parallel_strategy(threads, strategy);
+
+    std::vector<typename turn_info_type<Geometry>::type> const
+        all_turns = calculate_self_turns(g, strategy);
+    check_equal_turns(calculate_self_turns(g, parallel_strategy), all_turns);
+
+    std::vector<typename turn_info_type<Geometry>::type> turns;
+    BOOST_CHECK_EQUAL(interrupted_self_turns(g, parallel_strategy, turns),
+                      ! all_turns.empty());
+    BOOST_CHECK_EQUAL(turns.empty(), all_turns.empty());
+    BOOST_CHECK(turns.size() <= all_turns.size());
+
+    std::string expected_message, message;
+    BOOST_CHECK_EQUAL(bg::is_valid(g, message, parallel_strategy),
+                      bg::is_valid(g, expected_message, strategy));
+    BOOST_CHECK_EQUAL(message, expected_message);
+    BOOST_CHECK_EQUAL(bg::is_simple(g, parallel_strategy),
+                      bg::is_simple(g, strategy));
+}
+
+template <typename Geometry1, typename Geometry2>
+void test_algorithms(Geometry1 const& g1, Geometry2 const& g2, std::size_t threads)
+{
+    typedef bg::model::multi_polygon<Geometry1> multi_polygon;
+    typedef bg::strategy::intersection::cartesian_segments<> strategy_type;
+
+    bg::strategy::intersection::parallel<strategy_type> const parallel_strategy(threads);
+
+    check_equal_algorithms(g1, g2, strategy_type(), parallel_strategy);
+
+    // disjoint geometries
+    Geometry1 const far = wavy_polygon<Geometry1>(1000, 1000, 10, 1, 7, 500, false);
+    BOOST_CHECK(! bg::intersects(g1, far, parallel_strategy));
+    multi_polygon result;
+    bg::intersection(g1, far, result, parallel_strategy);
+    BOOST_CHECK(result.empty());
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::linestring<P> linestring;
+
+    polygon const p1 = wavy_polygon<polygon>(0, 0, 100, 5, 37, 4000, true);
+    polygon const p2 = wavy_polygon<polygon>(3, 2, 100, 7, 41, 3000, true);
+
+    linestring ls;
+    for (int i = 0; i < 1000; i++)
+    {
+        bg::append(ls, P(-150 + 0.3 * i, (i % 2 == 0) ? -120 : 120));
+    }
+
+    typedef bg::strategy::intersection::cartesian_segments<> strategy_type;
+
+    for (std::size_t threads = 1; threads <= 8; threads *= 2)
+    {
+        test_get_turns(p1, p2, strategy_type(), threads);
+        test_get_turns(ls, p1, strategy_type(), threads);
+        test_get_turns(ls, ls, strategy_type(), threads);
+    }
+
+    // small geometries, there are less section pairs than threads
+    polygon small1, small2;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0))", small1);
+    bg::read_wkt("POLYGON((5 5,5 15,15 15,15 5,5 5))", small2);
+    test_get_turns(small1, small2, strategy_type(), 8);
+
+    // the ring of the second polygon appended to the ring of the first one
+    // intersects itself many times
+    polygon self_intersecting = p1;
+    bg::interior_rings(self_intersecting).clear();
+    bg::append(self_intersecting, bg::exterior_ring(p2));
+    bg::append(self_intersecting, bg::range::front(bg::exterior_ring(p1)));
+
+    for (std::size_t threads = 1; threads <= 8; threads *= 2)
+    {
+        test_self_turns(p1, strategy_type(), threads);
+        test_self_turns(self_intersecting, strategy_type(), threads);
+    }
+    test_self_turns(small1, strategy_type(), 8);
+
+    test_algorithms(p1, p2, 4);
+    test_algorithms(small1, small2, 4);
+}
+
+void test_spherical()
+{
+    typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > point_type;
+    typedef bg::model::polygon<point_type> polygon;
+    typedef bg::strategy::intersection::spherical_segments<> strategy_type;
+
+    polygon const p1 = wavy_polygon<polygon>(0, 0, 30, 2, 37, 2000, false);
+    polygon const p2 = wavy_polygon<polygon>(1, 1, 30, 3, 41, 1500, false);
+
+    test_get_turns(p1, p2, strategy_type(), 4);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+    test_spherical();
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+
+#include <algorithms/overlay/get_turns_common.hpp>
+
+#include <boost/geometry/strategies/intersection_parallel.hpp>
+#include <boost/geometry/strategies/intersection_plane_sweep.hpp>
+
+
+template <typename Geometry1, typename Geometry2, typename Strategy>
+void test_get_turns(Geometry1 const& g1, Geometry2 const& g2,
+                    Strategy const& strategy, bool expect_turns = true)
+{
+    typedef bg::strategy::intersection::parallel<Strategy> parallel_type;
+    typedef bg::strategy::intersection::plane_sweep<Strategy> sweep_type;
+
+    std::vector<typename turn_info_type<Geometry1>::type> const
+        expected = calculate_turns(g1, g2, strategy);
+    BOOST_CHECK_EQUAL(! expected.empty(), expect_turns);
+
+    sweep_type const sweep_strategy(strategy);
+    check_equal_turns_unordered(calculate_turns(g1, g2, sweep_strategy), expected);
+
+    // the wrappers combined in any order
+    bg::strategy::intersection::parallel<sweep_type> const
+        parallel_sweep_strategy(4, sweep_strategy);
+    bg::strategy::intersection::plane_sweep<parallel_type> const
+        sweep_parallel_strategy(parallel_type(4, strategy));
+    check_equal_turns_unordered(calculate_turns(g1, g2, parallel_sweep_strategy), expected);
+    check_equal_turns_unordered(calculate_turns(g1, g2, sweep_parallel_strategy), expected);
+}
+
+template <typename Geometry, typename Strategy>
+void test_self_turns(Geometry const& g, Strategy const& strategy)
+{
+    typedef std::vector<typename turn_info_type<Geometry>::type> turns_type;
+    typedef bg::strategy::intersection::parallel<Strategy> parallel_type;
+    typedef bg::strategy::intersection::plane_sweep<Strategy> sweep_type;
+
+    turns_type expected = calculate_self_turns(g, strategy);
+    normalize_operations(expected);
+
+    sweep_type const sweep_strategy(strategy);
+    turns_type turns = calculate_self_turns(g, sweep_strategy);
+    normalize_operations(turns);
+    check_equal_turns_unordered(turns, expected);
+
+    // the wrappers combined in any order
+    bg::strategy::intersection::parallel<sweep_type> const
+        parallel_sweep_strategy(4, sweep_strategy);
+    turns = calculate_self_turns(g, parallel_sweep_strategy);
+    normalize_operations(turns);
+    check_equal_turns_unordered(turns, expected);
+
+    bg::strategy::intersection::plane_sweep<parallel_type> const
+        sweep_parallel_strategy(parallel_type(4, strategy));
+    turns = calculate_self_turns(g, sweep_parallel_strategy);
+    normalize_operations(turns);
+    check_equal_turns_unordered(turns, expected);
+
+    // the reported self-intersection may be different
+    BOOST_CHECK_EQUAL(bg::is_valid(g, sweep_strategy),
+                      bg::is_valid(g, strategy));
+}
+
+template <typename Geometry1, typename Geometry2>
+void test_algorithms(Geometry1 const& g1, Geometry2 const& g2)
+{
+    typedef bg::strategy::intersection::cartesian_segments<> strategy_type;
+
+    check_equal_algorithms(g1, g2, strategy_type(),
+        bg::strategy::intersection::plane_sweep<strategy_type>());
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::strategy::intersection::cartesian_segments<> strategy_type;
+
+    multi_polygon const c1 = contours<multi_polygon>(0, 0, 12);
+    multi_polygon const c2 = contours<multi_polygon>(3, 2, 12);
+
+    linestring ls;
+    for (int i = 0; i < 1000; i++)
+    {
+        bg::append(ls, P(-150 + 0.3 * i, (i % 2 == 0) ? -120 : 120));
+    }
+
+    test_get_turns(c1, c2, strategy_type());
+    test_get_turns(ls, c1, strategy_type());
+    test_get_turns(ls, ls, strategy_type());
+
+    // many small sections, overlapping and touching
+    multi_polygon const r = raster<multi_polygon>(0, 0, 40);
+    test_get_turns(r, raster<multi_polygon>(0.5, 0.5, 40), strategy_type());
+    test_get_turns(r, raster<multi_polygon>(1, 0, 40), strategy_type());
+    test_get_turns(r, raster<multi_polygon>(0, 1, 40), strategy_type());
+
+    // touching sections
+    polygon small1, small2, far;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0))", small1);
+    bg::read_wkt("POLYGON((10 10,10 20,20 20,20 10,10 10))", small2);
+    bg::read_wkt("POLYGON((100 100,100 110,110 110,110 100,100 100))", far);
+    test_get_turns(small1, small2, strategy_type());
+    test_get_turns(small1, far, strategy_type(), false);
+
+    // the rings of the second geometry appended to the rings
+    // of the first one intersect themselves many times
+    multi_polygon self_intersecting = c1;
+    for (std::size_t i = 0; i < self_intersecting.size(); i++)
+    {
+        bg::append(self_intersecting[i], bg::exterior_ring(c2[i]));
+        bg::append(self_intersecting[i], bg::range::front(bg::exterior_ring(c1[i])));
+    }
+
+    test_self_turns(c1, strategy_type());
+    test_self_turns(self_intersecting, strategy_type());
+    test_self_turns(small1, strategy_type());
+    test_self_turns(r, strategy_type());
+
+    test_algorithms(c1, c2);
+}
+
+void test_spherical()
+{
+    typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > point_type;
+    typedef bg::model::polygon<point_type> polygon;
+    typedef bg::strategy::intersection::spherical_segments<> strategy_type;
+
+    // crossing the antimeridian
+    polygon const p1 = wavy_polygon<polygon>(180, 0, 30, 2, 37, 2000, false);
+    polygon const p2 = wavy_polygon<polygon>(179, 1, 30, 3, 41, 1500, false);
+
+    test_get_turns(p1, p2, strategy_type());
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+    test_spherical();
+
+    return 0;
+}
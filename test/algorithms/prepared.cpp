@@ -0,0 +1,310 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/crosses.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/overlaps.hpp>
+#include <boost/geometry/algorithms/prepared.hpp>
+#include <boost/geometry/algorithms/relate.hpp>
+#include <boost/geometry/algorithms/relation.hpp>
+#include <boost/geometry/algorithms/touches.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// The results for the prepared geometry and the original geometry
+// passed as the second and the first argument
+template <typename Geometry, typename Areal>
+void check_predicates(Geometry const& geometry, Areal const& areal,
+                      bg::prepared<Areal> const& prepared)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    std::string const id = out.str();
+
+    BOOST_CHECK_MESSAGE(bg::within(geometry, prepared) == bg::within(geometry, areal),
+                        "within " << id);
+    BOOST_CHECK_MESSAGE(bg::covered_by(geometry, prepared) == bg::covered_by(geometry, areal),
+                        "covered_by " << id);
+    BOOST_CHECK_MESSAGE(bg::intersects(geometry, prepared) == bg::intersects(geometry, areal),
+                        "intersects " << id);
+    BOOST_CHECK_MESSAGE(bg::disjoint(geometry, prepared) == bg::disjoint(geometry, areal),
+                        "disjoint " << id);
+    BOOST_CHECK_MESSAGE(bg::touches(geometry, prepared) == bg::touches(geometry, areal),
+                        "touches " << id);
+    BOOST_CHECK_MESSAGE(bg::touches(prepared, geometry) == bg::touches(areal, geometry),
+                        "touches reversed " << id);
+    BOOST_CHECK_MESSAGE(bg::relate(geometry, prepared, bg::de9im::mask("T*F**F***"))
+                        == bg::relate(geometry, areal, bg::de9im::mask("T*F**F***")),
+                        "relate " << id);
+    BOOST_CHECK_EQUAL(bg::relation(geometry, prepared).str(),
+                      bg::relation(geometry, areal).str());
+    BOOST_CHECK_EQUAL(bg::relation(prepared, geometry).str(),
+                      bg::relation(areal, geometry).str());
+}
+
+// The results for the prepared geometry passed as the first argument,
+// within() and covered_by() are implemented only for the areal geometries
+template <typename Geometry, typename Areal>
+void check_reversed(Geometry const& geometry, Areal const& areal,
+                    bg::prepared<Areal> const& prepared)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    std::string const id = out.str();
+
+    BOOST_CHECK_MESSAGE(bg::within(prepared, geometry) == bg::within(areal, geometry),
+                        "within reversed " << id);
+    BOOST_CHECK_MESSAGE(bg::covered_by(prepared, geometry) == bg::covered_by(areal, geometry),
+                        "covered_by reversed " << id);
+    BOOST_CHECK_MESSAGE(bg::intersects(prepared, geometry) == bg::intersects(areal, geometry),
+                        "intersects reversed " << id);
+    BOOST_CHECK_MESSAGE(bg::overlaps(geometry, prepared) == bg::overlaps(geometry, areal),
+                        "overlaps " << id);
+    BOOST_CHECK_MESSAGE(bg::overlaps(prepared, geometry) == bg::overlaps(areal, geometry),
+                        "overlaps reversed " << id);
+    BOOST_CHECK_MESSAGE(bg::equals(geometry, prepared) == bg::equals(geometry, areal),
+                        "equals " << id);
+    BOOST_CHECK_MESSAGE(bg::equals(prepared, geometry) == bg::equals(areal, geometry),
+                        "equals reversed " << id);
+}
+
+// The results for the prepared geometry and a linear geometry
+template <typename Linear, typename Areal>
+void check_linear(Linear const& linear, Areal const& areal,
+                  bg::prepared<Areal> const& prepared)
+{
+    std::ostringstream out;
+    out << bg::wkt(linear);
+    std::string const id = out.str();
+
+    BOOST_CHECK_MESSAGE(bg::crosses(linear, prepared) == bg::crosses(linear, areal),
+                        "crosses " << id);
+    BOOST_CHECK_MESSAGE(bg::crosses(prepared, linear) == bg::crosses(areal, linear),
+                        "crosses reversed " << id);
+}
+
+template <typename Polygon, typename Areal>
+void check_intersection(Polygon const& polygon, Areal const& areal,
+                        bg::prepared<Areal> const& prepared)
+{
+    typedef bg::model::multi_polygon<Polygon> multi_polygon;
+
+    multi_polygon result, expected, reversed;
+    bg::intersection(polygon, prepared, result);
+    bg::intersection(polygon, areal, expected);
+    bg::intersection(prepared, polygon, reversed);
+
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+    BOOST_CHECK_CLOSE(bg::area(reversed), bg::area(expected), 0.0001);
+    BOOST_CHECK_EQUAL(result.size(), expected.size());
+}
+
+template <typename Linestring, typename Areal>
+void check_linear_intersection(Linestring const& linestring, Areal const& areal,
+                               bg::prepared<Areal> const& prepared)
+{
+    typedef bg::model::multi_linestring<Linestring> multi_linestring;
+
+    multi_linestring result, expected;
+    bg::intersection(linestring, prepared, result);
+    bg::intersection(linestring, areal, expected);
+
+    BOOST_CHECK_CLOSE(bg::length(result), bg::length(expected), 0.0001);
+    BOOST_CHECK_EQUAL(result.size(), expected.size());
+}
+
+template <typename Areal>
+void test_areal(std::string const& wkt)
+{
+    typedef typename bg::point_type<Areal>::type point_type;
+    typedef bg::model::box<point_type> box_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::linestring<point_type> linestring_type;
+    typedef bg::model::multi_point<point_type> multi_point_type;
+    typedef bg::model::segment<point_type> segment_type;
+
+    Areal areal;
+    bg::read_wkt(wkt, areal);
+    bg::correct(areal);
+
+    bg::prepared<Areal> const prepared(areal);
+
+    // points inside, outside, in the holes, on the edges and the vertices
+    for (int j = -2; j <= 22; j++)
+    {
+        for (int i = -2; i <= 22; i++)
+        {
+            point_type const point(i * 0.5, j * 0.5);
+            BOOST_CHECK_EQUAL(prepared.point_in_geometry(point),
+                              bg::detail::within::point_in_geometry(point, areal));
+            check_predicates(point, areal, prepared);
+        }
+    }
+
+    // boxes of different sizes far from and close to the boundary
+    for (int s = 1; s <= 4; s *= 2)
+    {
+        for (int j = -1; j <= 11; j++)
+        {
+            for (int i = -1; i <= 11; i++)
+            {
+                double const x = i + 0.25, y = j + 0.25;
+                double const size = 0.25 * s;
+
+                box_type const box(point_type(x, y), point_type(x + size, y + size));
+                polygon_type polygon;
+                bg::convert(box, polygon);
+                check_predicates(polygon, areal, prepared);
+                check_reversed(polygon, areal, prepared);
+                check_intersection(polygon, areal, prepared);
+
+                linestring_type linestring;
+                bg::append(linestring, point_type(x, y));
+                bg::append(linestring, point_type(x + size, y + size));
+                bg::append(linestring, point_type(x + size, y));
+                check_predicates(linestring, areal, prepared);
+                check_linear(linestring, areal, prepared);
+                check_linear_intersection(linestring, areal, prepared);
+
+                segment_type const segment(point_type(x, y), point_type(x, y + size));
+                BOOST_CHECK_EQUAL(bg::intersects(segment, prepared),
+                                  bg::intersects(segment, areal));
+                BOOST_CHECK_EQUAL(bg::disjoint(segment, prepared),
+                                  bg::disjoint(segment, areal));
+
+                multi_point_type multi_point;
+                bg::append(multi_point, point_type(x, y));
+                bg::append(multi_point, point_type(x + size, y + size));
+                check_predicates(multi_point, areal, prepared);
+            }
+        }
+    }
+
+    // the geometry containing the prepared one
+    polygon_type big;
+    bg::read_wkt("POLYGON((-1 -1,-1 12,12 12,12 -1,-1 -1))", big);
+    bg::correct(big);
+    check_predicates(big, areal, prepared);
+    check_reversed(big, areal, prepared);
+    check_intersection(big, areal, prepared);
+
+    // the same geometry
+    BOOST_CHECK(bg::equals(prepared, areal));
+    BOOST_CHECK(bg::equals(areal, prepared));
+
+    // two prepared geometries
+    bg::prepared<polygon_type> const prepared_big(big);
+    BOOST_CHECK(bg::within(prepared, prepared_big) == bg::within(areal, big));
+    BOOST_CHECK(bg::intersects(prepared_big, prepared));
+
+    // empty geometry
+    linestring_type const empty;
+    BOOST_CHECK_EQUAL(bg::intersects(empty, prepared), bg::intersects(empty, areal));
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false, false> polygon_ccw_open;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    std::string const with_holes
+        = "POLYGON((0 0,0 10,4 10,4 6,6 6,6 10,10 10,10 0,0 0),"
+          "(1 1,3 1,3 3,1 3,1 1),(5 1,9 1,9 3,7 2,5 3,5 1))";
+
+    test_areal<polygon>(with_holes);
+    test_areal<polygon_ccw_open>(with_holes);
+    test_areal<multi_polygon>(
+        "MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0),(1 1,3 1,3 3,1 3,1 1)),"
+        "((2 2,2 2.5,2.5 2.5,2.5 2,2 2)),"
+        "((6 0,6 10,10 10,10 0,6 0)),((0 6,0 8,3 10,4 6,0 6)))");
+}
+
+// The margins of the proxy boxes of the geometries close to the limits
+// of the coordinate type have to be representable
+template <typename P>
+void test_integer()
+{
+    typedef bg::model::polygon<P> polygon_type;
+    typedef bg::model::box<P> box_type;
+
+    int const m = 1000000000;
+
+    polygon_type polygon;
+    bg::convert(box_type(P(0, 0), P(m, m)), polygon);
+    bg::prepared<polygon_type> const prepared(polygon);
+
+    polygon_type inside, outside;
+    bg::convert(box_type(P(m - 20, m - 20), P(m - 10, m - 10)), inside);
+    bg::convert(box_type(P(-m, -m), P(-m + 10, -m + 10)), outside);
+
+    BOOST_CHECK(bg::within(inside, prepared));
+    BOOST_CHECK(bg::covered_by(inside, prepared));
+    BOOST_CHECK(! bg::within(outside, prepared));
+    BOOST_CHECK(bg::disjoint(outside, prepared));
+    BOOST_CHECK_EQUAL(bg::relation(inside, prepared).str(),
+                      bg::relation(inside, polygon).str());
+    BOOST_CHECK_EQUAL(bg::relation(outside, prepared).str(),
+                      bg::relation(outside, polygon).str());
+
+    // the proxy box of the geometry at the limits can't be created
+    int const max = (std::numeric_limits<int>::max)();
+    polygon_type limits, at_limits;
+    bg::convert(box_type(P(0, 0), P(max, max)), limits);
+    bg::convert(box_type(P(max - 2, max - 2), P(max - 1, max - 1)), at_limits);
+    bg::prepared<polygon_type> const prepared_limits(limits);
+    BOOST_CHECK(bg::within(at_limits, prepared_limits));
+}
+
+void test_spherical()
+{
+    typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+
+    polygon_type polygon;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))", polygon);
+    bg::correct(polygon);
+
+    bg::prepared<polygon_type> const prepared(polygon);
+
+    for (int i = -2; i <= 12; i++)
+    {
+        point_type const point(i, 5);
+        check_predicates(point, polygon, prepared);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_integer<bg::model::d2::point_xy<int> >();
+    test_spherical();
+
+    return 0;
+}
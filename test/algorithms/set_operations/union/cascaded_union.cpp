@@ -0,0 +1,179 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/cascaded_union.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/strategies/intersection_parallel.hpp>
+#include <boost/geometry/strategies/intersection_plane_sweep.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Overlapping squares of a grid, like parcels with the boundaries
+// not matching exactly
+template <typename Polygon>
+std::vector<Polygon> parcels(double x0, double y0, int count, double size)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    std::vector<Polygon> result;
+    for (int j = 0; j < count; j++)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            double const x = x0 + i;
+            double const y = y0 + j;
+            Polygon polygon;
+            bg::append(polygon, point_type(x, y));
+            bg::append(polygon, point_type(x, y + size));
+            bg::append(polygon, point_type(x + size, y + size));
+            bg::append(polygon, point_type(x + size, y));
+            bg::append(polygon, point_type(x, y));
+            result.push_back(polygon);
+        }
+    }
+    return result;
+}
+
+template <typename Range, typename MultiPolygon>
+void pairwise_union(Range const& geometries, MultiPolygon& result)
+{
+    for (std::size_t i = 0; i < geometries.size(); i++)
+    {
+        MultiPolygon temp;
+        bg::union_(result, geometries[i], temp);
+        result.swap(temp);
+    }
+}
+
+template <typename Range>
+void test_one(std::string const& caseid, Range const& geometries,
+              std::size_t expected_count, double expected_area)
+{
+    typedef typename boost::range_value<Range>::type geometry_type;
+    typedef typename bg::point_type<geometry_type>::type point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+    multi_polygon_type result;
+    bg::cascaded_union(geometries, result);
+
+    BOOST_CHECK_MESSAGE(result.size() == expected_count,
+                        caseid << " count: " << result.size()
+                        << " expected: " << expected_count);
+    BOOST_CHECK_CLOSE(bg::area(result), expected_area, 0.0001);
+    BOOST_CHECK_MESSAGE(bg::is_valid(result), caseid << " invalid result");
+
+    multi_polygon_type expected;
+    pairwise_union(geometries, expected);
+    BOOST_CHECK_EQUAL(result.size(), expected.size());
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+
+    // the output collection may be a vector of polygons
+    std::vector<polygon_type> polygons;
+    bg::cascaded_union(geometries, polygons);
+    BOOST_CHECK_EQUAL(polygons.size(), result.size());
+
+    // the tree of the reduction doesn't depend on the number of threads
+    typedef bg::strategy::intersection::cartesian_segments<> strategy_type;
+    for (std::size_t threads = 1; threads <= 8; threads *= 2)
+    {
+        bg::strategy::intersection::parallel<strategy_type> const strategy(threads);
+        multi_polygon_type parallel_result;
+        bg::cascaded_union(geometries, parallel_result, strategy);
+        BOOST_CHECK_EQUAL(parallel_result.size(), result.size());
+        BOOST_CHECK_EQUAL(bg::num_points(parallel_result), bg::num_points(result));
+        BOOST_CHECK_CLOSE(bg::area(parallel_result), bg::area(result), 0.0001);
+    }
+
+    // the threads of the parallel strategy wrapped in another strategy
+    typedef bg::strategy::intersection::parallel<strategy_type> parallel_type;
+    bg::strategy::intersection::plane_sweep<parallel_type> const
+        sweep_strategy(parallel_type(4));
+    multi_polygon_type sweep_result;
+    bg::cascaded_union(geometries, sweep_result, sweep_strategy);
+    BOOST_CHECK_EQUAL(sweep_result.size(), result.size());
+    BOOST_CHECK_CLOSE(bg::area(sweep_result), bg::area(result), 0.0001);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_one("grid", parcels<polygon>(0, 0, 20, 1.1), 1, 20.1 * 20.1);
+    test_one("single", parcels<polygon>(0, 0, 1, 1), 1, 1);
+    test_one("touching", parcels<polygon>(0, 0, 10, 1), 1, 100);
+    test_one("disjoint", parcels<polygon>(0, 0, 10, 0.5), 100, 25);
+
+    // groups of parcels far from each other
+    std::vector<polygon> groups;
+    for (int i = 0; i < 4; i++)
+    {
+        std::vector<polygon> const group = parcels<polygon>(i * 100, (i % 2) * 100, 6, 1.25);
+        groups.insert(groups.end(), group.begin(), group.end());
+    }
+    test_one("groups", groups, 4, 4 * 6.25 * 6.25);
+
+    // a polygon with a hole filled by another one
+    std::vector<polygon> hole(2);
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))", hole[0]);
+    bg::read_wkt("POLYGON((1 1,1 9,9 9,9 1,1 1))", hole[1]);
+    test_one("hole", hole, 1, 100);
+
+    // multi polygons
+    std::vector<multi_polygon> multi(3);
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0)),((5 0,5 2,7 2,7 0,5 0)))", multi[0]);
+    bg::read_wkt("MULTIPOLYGON(((1 1,1 3,3 3,3 1,1 1)))", multi[1]);
+    bg::read_wkt("MULTIPOLYGON(((10 10,10 11,11 11,11 10,10 10)))", multi[2]);
+    test_one("multi", multi, 3, 4 + 4 + 4 - 1 + 1);
+
+    // empty geometries are skipped
+    std::vector<polygon> empty(3);
+    bg::read_wkt("POLYGON((0 0,0 1,1 1,1 0,0 0))", empty[1]);
+    test_one("empty", empty, 1, 1);
+
+    multi_polygon result;
+    bg::cascaded_union(std::vector<polygon>(), result);
+    BOOST_CHECK(result.empty());
+}
+
+void test_spherical()
+{
+    typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > point_type;
+    typedef bg::model::polygon<point_type> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    std::vector<polygon> const geometries = parcels<polygon>(-5, 40, 10, 1.25);
+
+    multi_polygon result, expected;
+    bg::cascaded_union(geometries, result);
+    pairwise_union(geometries, expected);
+
+    BOOST_CHECK_EQUAL(result.size(), 1u);
+    BOOST_CHECK_EQUAL(result.size(), expected.size());
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_spherical();
+
+    return 0;
+}
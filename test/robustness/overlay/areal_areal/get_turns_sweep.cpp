@@ -0,0 +1,135 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the times of get_turns using the partition of the sections
+// and the plane sweep of the sections, for the inputs with many short
+// segments (contour lines, vectorized rasters) and with long segments.
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define BOOST_GEOMETRY_NO_BOOST_TEST
+
+#include <algorithms/overlay/get_turns_common.hpp>
+
+#include <boost/geometry/strategies/intersection_plane_sweep.hpp>
+
+#include <boost/program_options.hpp>
+#include <boost/timer.hpp>
+
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+
+// Two polygons consisting of long segments
+multi_polygon_type stars(double cx, double cy, int points)
+{
+    double const pi = bg::math::pi<double>();
+
+    polygon_type polygon;
+    for (int i = 0; i < points; i++)
+    {
+        double const a = -2.0 * pi * i / points;
+        double const r = (i % 2 == 0) ? 1000.0 : 100.0;
+        bg::append(polygon, point_type(cx + r * std::cos(a), cy + r * std::sin(a)));
+    }
+    bg::append(polygon, bg::range::front(bg::exterior_ring(polygon)));
+
+    multi_polygon_type result;
+    result.push_back(polygon);
+    return result;
+}
+
+void test(std::string const& name,
+          multi_polygon_type const& mp1, multi_polygon_type const& mp2,
+          int count)
+{
+    typedef bg::strategy::intersection::cartesian_segments<> strategy_type;
+
+    std::size_t turns_partition = 0, turns_sweep = 0;
+
+    boost::timer t1;
+    for (int i = 0; i < count; i++)
+    {
+        turns_partition = calculate_turns(mp1, mp2, strategy_type()).size();
+    }
+    double const time_partition = t1.elapsed();
+
+    boost::timer t2;
+    for (int i = 0; i < count; i++)
+    {
+        turns_sweep = calculate_turns(mp1, mp2,
+                        bg::strategy::intersection::plane_sweep<strategy_type>()).size();
+    }
+    double const time_sweep = t2.elapsed();
+
+    std::cout << name
+        << " points: " << bg::num_points(mp1) + bg::num_points(mp2)
+        << " turns: " << turns_partition
+        << " partition: " << time_partition
+        << " sweep: " << time_sweep
+        << (turns_partition != turns_sweep ? " DIFFERENT TURNS" : "")
+        << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    BoostGeometryWriteTestConfiguration();
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== get_turns_sweep ===\nAllowed options");
+
+        int count = 1;
+        int rings = 20;
+        int points = 20000;
+        int cells = 300;
+        int star_points = 2000;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<int>(&count)->default_value(1), "Number of repetitions")
+            ("rings", po::value<int>(&rings)->default_value(20), "Number of contour lines")
+            ("points", po::value<int>(&points)->default_value(20000), "Number of points of a contour line")
+            ("cells", po::value<int>(&cells)->default_value(300), "Number of raster cells in each direction")
+            ("star_points", po::value<int>(&star_points)->default_value(2000), "Number of points of a star")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        test("contours", contours<multi_polygon_type>(0, 0, rings, points),
+                         contours<multi_polygon_type>(3, 2, rings, points), count);
+        test("raster", raster<multi_polygon_type>(0, 0, cells),
+                       raster<multi_polygon_type>(0.5, 0.5, cells), count);
+        test("stars", stars(0, 0, star_points), stars(1, 1, star_points), count);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}